@@ -48,6 +48,9 @@ namespace lsp
                 inline bool     is_empty() const            { return nSize == 0;                    }
                 inline size_t   size() const                { return nSize;                         }
                 inline size_t   capacity() const            { return nCapacity * sizeof(umword_t);  }
+                inline size_t   words() const               { return nCapacity;                     }
+                inline umword_t        *data()              { return vData;                         }
+                inline const umword_t  *data() const        { return vData;                         }
 
             public:
                 bool            resize(size_t size);
@@ -56,12 +59,17 @@ namespace lsp
 
             public:
                 bool            get(size_t index) const;
+                size_t          get(size_t index, size_t count, bool *values) const;
+                size_t          get(size_t index, size_t count, uint8_t *values) const;
+                size_t          get_packed(size_t index, size_t count, uint8_t *bits) const;
 
                 void            set_all();
                 bool            set(size_t index);
                 bool            set(size_t index, bool value);
                 size_t          set(size_t index, size_t count);
                 size_t          set(size_t index, size_t count, const bool *values);
+                size_t          set(size_t index, size_t count, const uint8_t *values);
+                size_t          set_packed(size_t index, size_t count, const uint8_t *bits);
 
                 void            unset_all();
                 bool            unset(size_t index);
@@ -71,6 +79,10 @@ namespace lsp
                 bool            toggle(size_t index);
                 size_t          toggle(size_t index, size_t count);
 
+            public:
+                ssize_t         next_set(size_t index) const;
+                ssize_t         next_unset(size_t index) const;
+
             public:
                 void            swap(bitset *dst);
         };
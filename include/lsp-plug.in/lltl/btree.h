@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_BTREE_H_
+#define LSP_PLUG_IN_LLTL_BTREE_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/iterator.h>
+#include <lsp-plug.in/lltl/freelist.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw B+-tree of plain data keys and values. All items are stored in leaves
+         * which are linked into the list in the order of keys, inner nodes store
+         * only separator keys and pointers to children: all keys of child i are less
+         * than separator i and all keys of child i+1 are not less than separator i.
+         *
+         * All nodes have the same size of about NODE_SIZE bytes, so each node holds
+         * as many keys as possible and search within the node touches few cache lines.
+         * Nodes are allocated from the free-list and returned to it on removal.
+         * Insertion splits full nodes and removal refills underfull nodes on the way
+         * down, so both operations are done in a single pass from the root.
+         */
+        struct raw_btree
+        {
+            public:
+                enum constants_t
+                {
+                    NODE_SIZE       = 512,                                  // Desired size of the node
+                    NODE_ALIGN      = 16,                                   // Alignment of keys and values within node
+                    MIN_KEYS        = 4,                                    // Minimum capacity of node
+                };
+
+                typedef struct node_t
+                {
+                    node_t     *pNext;                                      // Next leaf
+                    node_t     *pPrev;                                      // Previous leaf
+                    uint32_t    nCount;                                     // Number of keys
+                    uint32_t    bLeaf;                                      // Leaf flag
+                } node_t;
+
+                enum put_mode_t
+                {
+                    PUT_ANY,                                                // Insert or replace value
+                    PUT_CREATE,                                             // Insert value only if key does not exist
+                };
+
+            public:
+                node_t         *pRoot;                                      // Root node
+                node_t         *pFirst;                                     // First leaf
+                node_t         *pLast;                                      // Last leaf
+                size_t          nItems;                                     // Number of items
+                size_t          nChanges;                                   // Modification counter
+                size_t          nKeySize;                                   // Size of key
+                size_t          nValueSize;                                 // Size of value
+                size_t          nLeafCap;                                   // Maximum number of items in leaf
+                size_t          nInnerCap;                                  // Maximum number of keys in inner node
+                size_t          nKeyOff;                                    // Offset of keys in node
+                size_t          nValueOff;                                  // Offset of values in leaf
+                size_t          nChildOff;                                  // Offset of children in inner node
+                compare_iface   cmp;                                        // Compare interface
+                raw_freelist    vPool;                                      // Pool of nodes
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
+
+            protected:
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+
+                inline uint8_t *key(node_t *n, size_t idx) const            { return reinterpret_cast<uint8_t *>(n) + nKeyOff + idx * nKeySize;     }
+                inline uint8_t *value(node_t *n, size_t idx) const          { return reinterpret_cast<uint8_t *>(n) + nValueOff + idx * nValueSize; }
+                inline node_t **children(node_t *n) const                   { return reinterpret_cast<node_t **>(reinterpret_cast<uint8_t *>(n) + nChildOff);   }
+                inline size_t   min_count(const node_t *n) const            { return (n->bLeaf) ? nLeafCap / 2 : (nInnerCap - 1) / 2;   }
+                inline size_t   max_count(const node_t *n) const            { return (n->bLeaf) ? nLeafCap : nInnerCap;                 }
+
+                node_t         *alloc_node(bool leaf);
+                void            free_node(node_t *n);
+                void            free_tree(node_t *n);
+
+                size_t          lower_bound(node_t *n, const void *k);
+                size_t          upper_bound(node_t *n, const void *k);
+                node_t         *find_leaf(const void *k);
+
+                bool            split_child(node_t *p, size_t idx);
+                void            borrow_left(node_t *p, size_t idx);
+                void            borrow_right(node_t *p, size_t idx);
+                void            merge_children(node_t *p, size_t idx);
+                size_t          fix_child(node_t *p, size_t idx);
+
+                raw_iterator    make_iter(node_t *n, size_t idx, node_t *end, size_t end_idx);
+
+            public:
+                static uint8_t *iter_key(const raw_iterator *i);
+
+            public:
+                void            init(size_t ksize, size_t vsize, compare_func_t func);
+                void            flush();
+                void            clear();
+                void            swap(raw_btree *src);
+
+                uint8_t        *get(const void *k);
+                uint8_t        *put(const void *k, const void *v, put_mode_t mode);
+                uint8_t        *replace(const void *k, const void *v);
+                bool            remove(const void *k, void *v);
+                bool            load(size_t n, const void *k, const void *v);
+
+                raw_iterator    iter();
+                raw_iterator    lower_bound(const void *k);
+                raw_iterator    upper_bound(const void *k);
+                raw_iterator    floor(const void *k);
+                raw_iterator    range(const void *first, const void *last);
+        };
+
+        /**
+         * Iterator over values of the B+-tree which also provides access to keys
+         */
+        template <class K, class V>
+            class btree_iterator: public iterator<V>
+            {
+                public:
+                    explicit inline btree_iterator(const raw_iterator &src): iterator<V>(src)   {}
+
+                public:
+                    /**
+                     * Get key of the current item
+                     * @return key of the current item or NULL if there is no item
+                     */
+                    inline const K *key() const
+                    {
+                        return (this->it.has_more()) ? reinterpret_cast<const K *>(raw_btree::iter_key(&this->it)) : NULL;
+                    }
+            };
+
+        /**
+         * Ordered map of plain data keys and values organized as B+-tree.
+         * Keys are ordered by the compare interface, the default compare
+         * interface orders arithmetic keys numerically and other keys bytewise.
+         * Pointers to values remain valid until the next modification of the tree.
+         */
+        template <class K, class V>
+            class btree
+            {
+                private:
+                    btree(const btree<K, V> &src);                                  // Disable copying
+                    btree<K, V> & operator = (const btree<K, V> & src);             // Disable copying
+
+                private:
+                    mutable raw_btree       v;
+
+                    inline static V *cast(void *ptr)                                { return reinterpret_cast<V *>(ptr);        }
+
+                public:
+                    typedef btree_iterator<K, V>    iterator;
+
+                public:
+                    explicit inline btree()
+                    {
+                        compare_spec<K> cmp;
+                        v.init(sizeof(K), sizeof(V), cmp.compare);
+                    }
+
+                    explicit inline btree(const compare_iface &cmp)                 { v.init(sizeof(K), sizeof(V), cmp.compare);    }
+                    explicit inline btree(compare_func_t cmp)                       { v.init(sizeof(K), sizeof(V), cmp);            }
+                    ~btree()                                                        { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.nItems;                      }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                 }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+                    inline void swap(btree<K, V> &src)                              { v.swap(&src.v);                       }
+                    inline void swap(btree<K, V> *src)                              { v.swap(&src->v);                      }
+
+                public:
+                    // Accessing values
+                    inline V *get(const K *key)                                     { return cast(v.get(key));              }
+                    inline V *get(const K &key)                                     { return cast(v.get(&key));             }
+                    inline const V *get(const K *key) const                         { return cast(v.get(key));              }
+                    inline const V *get(const K &key) const                         { return cast(v.get(&key));             }
+                    inline bool contains(const K *key) const                        { return v.get(key) != NULL;            }
+                    inline bool contains(const K &key) const                        { return v.get(&key) != NULL;           }
+
+                public:
+                    // Modification, return pointer to the stored value or NULL on error
+                    /**
+                     * Insert or replace the value
+                     * @param key key
+                     * @param value value
+                     * @return pointer to the stored value or NULL on allocation error
+                     */
+                    inline V *put(const K *key, const V *value)                     { return cast(v.put(key, value, raw_btree::PUT_ANY));       }
+                    inline V *put(const K &key, const V &value)                     { return cast(v.put(&key, &value, raw_btree::PUT_ANY));     }
+
+                    /**
+                     * Insert the value only if the key does not exist
+                     * @param key key
+                     * @param value value, may be NULL to leave the value uninitialized
+                     * @return pointer to the stored value or NULL if the key exists or on allocation error
+                     */
+                    inline V *create(const K *key, const V *value)                  { return cast(v.put(key, value, raw_btree::PUT_CREATE));    }
+                    inline V *create(const K &key, const V &value)                  { return cast(v.put(&key, &value, raw_btree::PUT_CREATE));  }
+                    inline V *create(const K &key)                                  { return cast(v.put(&key, NULL, raw_btree::PUT_CREATE));    }
+
+                    /**
+                     * Replace the value only if the key exists
+                     * @param key key
+                     * @param value value
+                     * @return pointer to the stored value or NULL if the key does not exist
+                     */
+                    inline V *replace(const K *key, const V *value)                 { return cast(v.replace(key, value));   }
+                    inline V *replace(const K &key, const V &value)                 { return cast(v.replace(&key, &value)); }
+
+                    inline bool remove(const K *key, V *value = NULL)               { return v.remove(key, value);          }
+                    inline bool remove(const K &key, V *value = NULL)               { return v.remove(&key, value);         }
+
+                    /**
+                     * Replace the content of the tree with the sorted data. Items are
+                     * distributed evenly over the minimum possible number of leaves
+                     * and the tree is built bottom-up in O(n)
+                     * @param n number of items
+                     * @param keys array of keys sorted in ascending order without duplicates
+                     * @param values array of values
+                     * @return true on success, false if keys are not sorted or on allocation error
+                     */
+                    inline bool load(size_t n, const K *keys, const V *values)      { return v.load(n, keys, values);       }
+
+                public:
+                    // Iteration in the order of keys
+                    inline iterator values() const                                  { return iterator(v.iter());            }
+
+                    /**
+                     * Get iterator pointing to the first item which key is not less than the key
+                     * @param key key
+                     * @return iterator
+                     */
+                    inline iterator lower_bound(const K &key) const                 { return iterator(v.lower_bound(&key)); }
+
+                    /**
+                     * Get iterator pointing to the first item which key is greater than the key
+                     * @param key key
+                     * @return iterator
+                     */
+                    inline iterator upper_bound(const K &key) const                 { return iterator(v.upper_bound(&key)); }
+
+                    /**
+                     * Get iterator pointing to the last item which key is not greater than the key
+                     * @param key key
+                     * @return iterator
+                     */
+                    inline iterator floor(const K &key) const                       { return iterator(v.floor(&key));       }
+
+                    /**
+                     * Get iterator over items which keys are in range [first, last)
+                     * @param first the first key of range
+                     * @param last the key after the last key of range
+                     * @return iterator
+                     */
+                    inline iterator range(const K &first, const K &last) const      { return iterator(v.range(&first, &last));  }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_BTREE_H_ */
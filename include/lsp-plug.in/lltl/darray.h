@@ -29,34 +29,62 @@
 
 #include <lsp-plug.in/lltl/version.h>
 #include <lsp-plug.in/lltl/spec.h>
+#include <lsp-plug.in/lltl/iterator.h>
+#include <lsp-plug.in/lltl/parallel.h>
 
 namespace lsp
 {
     namespace lltl
     {
         /**
-         * Raw data array implementation with fixed set of routines
+         * Raw data array implementation with fixed set of routines.
+         * The storage is allocated with malloc() unless the alignment is set,
+         * in this case the storage is aligned to the specified boundary.
          */
         struct raw_darray
         {
+            public:
+                enum constants_t
+                {
+                    MALLOC_ALIGN    = sizeof(void *) * 2    // Alignment guaranteed by malloc()
+                };
+
             public:
                 size_t      nItems;
                 uint8_t    *vItems;
                 size_t      nCapacity;
                 size_t      nSizeOf;
+                size_t      nChanges;
+                size_t      nAlign;                         // Alignment of storage, 0 for malloc() default
 
             public:
                 typedef     ssize_t (* cmp_func_t)(const void *a, const void *b);
+                typedef     bool (* pred_func_t)(const void *item, void *arg);
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
 
             protected:
                 static int  closure_cmp(const void *a, const void *b, void *c);
                 static int  raw_cmp(const void *a, const void *b, void *c);
 
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+
+                uint8_t    *alloc_data(size_t capacity) const;
+                void        free_data(uint8_t *ptr) const;
+                bool        reallocate(size_t capacity);
+
             public:
                 void        init(size_t n_sizeof);
+                void        init(size_t n_sizeof, size_t align);
                 bool        grow(size_t capacity);
                 bool        truncate(size_t capacity);
                 void        flush();
+                uint8_t    *release();
+                bool        set_alignment(size_t align);
+                inline size_t alignment() const             { return (nAlign > 0) ? nAlign : size_t(MALLOC_ALIGN);   }
 
                 void        swap(raw_darray *src);
                 bool        xswap(size_t i1, size_t i2);
@@ -83,8 +111,19 @@ namespace lsp
                 uint8_t    *iremove(size_t idx, size_t n, void *dst);
                 uint8_t    *iremove(size_t idx, size_t n, raw_darray *cs);
 
+                ssize_t     find(const void *value, size_t first);
+                ssize_t     find(const void *value, size_t first, sort_closure_t *c);
+                ssize_t     find_if(pred_func_t f, void *arg, size_t first);
+                size_t      count(const void *value);
+                size_t      count(const void *value, sort_closure_t *c);
+
                 void        qsort(cmp_func_t f);
                 void        qsort(sort_closure_t *c);
+                void        psort(cmp_func_t f, size_t threads, size_t cutoff);
+                void        psort(sort_closure_t *c, size_t threads, size_t cutoff);
+                bool        radix_sort(size_t offset, size_t width, radix_key_t key);
+
+                raw_iterator    iter();
         };
 
         /**
@@ -113,31 +152,64 @@ namespace lsp
                         v.vItems        = NULL;
                         v.nCapacity     = 0;
                         v.nSizeOf       = sizeof(T);
+                        v.nChanges      = 0;
+                        v.nAlign        = 0;
+                    }
+
+                    /**
+                     * Create array with aligned storage
+                     * @param align alignment of the storage in bytes, rounded up to the power of two
+                     */
+                    explicit inline darray(size_t align)
+                    {
+                        v.init(sizeof(T));
+                        v.set_alignment(align);
                     }
 
                     ~darray() { v.flush(); };
 
                 public:
                     // Size and capacity
+                    inline raw_darray *raw()                                        { return &v;                        }
                     inline size_t size() const                                      { return v.nItems;                  }
                     inline size_t capacity() const                                  { return v.nCapacity;               }
                     inline bool is_empty() const                                    { return v.nItems <= 0;             }
 
+                    /**
+                     * Get alignment of the storage which can be used to select aligned
+                     * SIMD load and store operations
+                     * @return alignment of the storage in bytes
+                     */
+                    inline size_t alignment() const                                 { return v.alignment();             }
+
+                    /**
+                     * Set alignment of the storage, the existing data is moved to the aligned storage
+                     * @param align alignment of the storage in bytes, rounded up to the power of two,
+                     *   values not greater than the malloc() alignment reset to the default allocation
+                     * @return true on success
+                     */
+                    inline bool set_alignment(size_t align)                         { return v.set_alignment(align);    }
+
                 public:
                     // Whole collection manipulations
-                    inline void clear()                                             { v.nItems  = 0;                    }
+                    inline void clear()                                             { v.nItems  = 0; ++v.nChanges;      }
                     inline void flush()                                             { v.flush();                        }
                     inline void truncate()                                          { v.flush();                        }
                     inline bool truncate(size_t size)                               { return v.truncate(size);          }
                     inline bool reserve(size_t capacity)                            { return v.grow(capacity);          }
                     inline void swap(darray<T> &src)                                { v.swap(&src.v);                   }
                     inline void swap(darray<T> *src)                                { v.swap(&src->v);                  }
+
+                    /**
+                     * Release the storage of the array to the caller, the array becomes empty.
+                     * The call never allocates memory and never fails: NULL is returned only
+                     * for the array without storage. For the aligned storage the data is moved
+                     * to the beginning of the allocated block and loses the alignment.
+                     * @return pointer to the items that should be freed with free(), or NULL
+                     */
                     inline T   *release()
                     {
-                        T *ptr          = cast(v.vItems);
-                        v.nItems        = 0;
-                        v.vItems        = NULL;
-                        v.nCapacity     = 0;
+                        T *ptr          = cast(v.release());
                         v.nSizeOf       = sizeof(T);
                         return ptr;
                     }
@@ -164,6 +236,17 @@ namespace lsp
                     inline const T *array() const                                   { return ccast(v.vItems); }
                     inline const T *slice(size_t idx, size_t size) const            { return ccast(v.slice(idx, size));  }
 
+                public:
+                    // Contiguous range access, [begin(), end()) is a plain pointer range
+                    inline T *begin()                                               { return cast(v.vItems);            }
+                    inline T *end()                                                 { return cast(v.vItems) + v.nItems;  }
+                    inline const T *begin() const                                   { return ccast(v.vItems);           }
+                    inline const T *end() const                                     { return ccast(v.vItems) + v.nItems; }
+
+                public:
+                    // Iterators
+                    inline iterator<T> values()                                     { return iterator<T>(v.iter());     }
+
                 public:
                     // Single modifications
                     inline T *append()                                              { return cast(v.append(1));         }
@@ -281,6 +364,35 @@ namespace lsp
                     inline T *remove_n(size_t idx, size_t n, darray<T> &x)          { return remove_n(idx, n, &x);                              }
                     inline T *premove_n(const T *ptr, size_t n, darray<T> &x)       { return premove_n(ptr, n, &x);                             }
 
+                public:
+                    // Searching by value, values of 4 and 8 bytes are compared bitwise with SIMD
+                    inline ssize_t find(const T *value, size_t first = 0) const     { return v.find(value, first);      }
+                    inline ssize_t find(const T &value, size_t first = 0) const     { return v.find(&value, first);     }
+                    inline size_t count(const T *value) const                       { return v.count(value);            }
+                    inline size_t count(const T &value) const                       { return v.count(&value);           }
+
+                    inline ssize_t find(const T *value, const compare_iface &cmp, size_t first = 0) const
+                    {
+                        sort_closure_t c;
+                        c.compare       = cmp.compare;
+                        c.size          = sizeof(T);
+                        return v.find(value, first, &c);
+                    }
+
+                    inline size_t count(const T *value, const compare_iface &cmp) const
+                    {
+                        sort_closure_t c;
+                        c.compare       = cmp.compare;
+                        c.size          = sizeof(T);
+                        return v.count(value, &c);
+                    }
+
+                    template <class A>
+                    inline ssize_t find_if(bool (* pred)(const T *item, A *arg), A *arg, size_t first = 0) const
+                    {
+                        return v.find_if(reinterpret_cast<raw_darray::pred_func_t>(pred), arg, first);
+                    }
+
                 public:
                     // Sorts
                     inline void qsort(cmp_func_t cmp)                               { v.qsort(reinterpret_cast<raw_darray::cmp_func_t>(cmp));   }
@@ -309,6 +421,46 @@ namespace lsp
                         v.qsort(&c);
                     }
 
+                public:
+                    // Parallel sorts
+                    inline void psort(cmp_func_t cmp, size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        v.psort(reinterpret_cast<raw_darray::cmp_func_t>(cmp), threads, cutoff);
+                    }
+
+                    inline void psort(compare_func_t cmp, size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        sort_closure_t c;
+                        c.compare       = cmp;
+                        c.size          = sizeof(T);
+                        v.psort(&c, threads, cutoff);
+                    }
+
+                    inline void psort(const compare_iface &cmp, size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        sort_closure_t c;
+                        c.compare       = cmp.compare;
+                        c.size          = sizeof(T);
+                        v.psort(&c, threads, cutoff);
+                    }
+
+                    inline void psort(size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        compare_spec<T> spec;
+                        sort_closure_t c;
+                        c.compare       = spec.compare;
+                        c.size          = sizeof(T);
+                        v.psort(&c, threads, cutoff);
+                    }
+
+                public:
+                    // Radix sorts, stable
+                    inline bool radix_sort()                                        { return v.radix_sort(0, sizeof(T), radix_spec<T>::key);    }
+                    inline bool radix_sort(size_t offset, size_t width, radix_key_t key)
+                    {
+                        return v.radix_sort(offset, width, key);
+                    }
+
                 public:
                     // Operators
                     inline T *operator[](size_t idx)                                { return get(idx);                  }
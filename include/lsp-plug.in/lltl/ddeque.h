@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_DDEQUE_H_
+#define LSP_PLUG_IN_LLTL_DDEQUE_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw double-ended queue over the power-of-two ring buffer.
+         * Elements may wrap around the end of the buffer, so the content is
+         * represented by at most two contiguous segments.
+         */
+        struct raw_ddeque
+        {
+            public:
+                uint8_t    *vItems;                                         // Ring buffer
+                size_t      nHead;                                          // Position of the first element
+                size_t      nItems;                                         // Number of elements
+                size_t      nCapacity;                                      // Capacity, power of two
+                size_t      nSizeOf;                                        // Size of element
+                size_t      nChanges;                                       // Modification counter
+
+            protected:
+                inline uint8_t *at(size_t idx)                              { return &vItems[((nHead + idx) & (nCapacity - 1)) * nSizeOf];  }
+                void            write(size_t idx, const uint8_t *src, size_t n);
+                void            read(size_t idx, uint8_t *dst, size_t n);
+
+            public:
+                void        init(size_t n_sizeof);
+                bool        grow(size_t capacity);
+                void        flush();
+                void        clear();
+
+                uint8_t    *get(size_t idx);
+                size_t      segments(uint8_t **a, size_t *na, uint8_t **b, size_t *nb);
+
+                uint8_t    *append(const void *src);
+                uint8_t    *prepend(const void *src);
+                bool        append(size_t n, const void *src);
+                bool        prepend(size_t n, const void *src);
+
+                uint8_t    *pop(void *dst);
+                uint8_t    *shift(void *dst);
+                size_t      pop(size_t n, void *dst);
+                size_t      shift(size_t n, void *dst);
+        };
+
+        /**
+         * Double-ended queue of plain data structures with O(1) insertion and
+         * removal at both ends.
+         */
+        template <class T>
+            class ddeque
+            {
+                private:
+                    ddeque(const ddeque<T> &src);                                   // Disable copying
+                    ddeque<T> & operator = (const ddeque<T> & src);                 // Disable copying
+
+                private:
+                    mutable raw_ddeque      v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+                    inline static const T *ccast(const void *ptr)                   { return static_cast<const T *>(ptr);   }
+
+                public:
+                    explicit inline ddeque()                                        { v.init(sizeof(T));                    }
+                    ~ddeque()                                                       { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.nItems;                      }
+                    inline size_t capacity() const                                  { return v.nCapacity;                   }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                 }
+                    inline bool reserve(size_t capacity)                            { return v.grow(capacity);              }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+
+                public:
+                    // Accessing elements
+                    inline T *get(size_t idx)                                       { return cast(v.get(idx));              }
+                    inline const T *get(size_t idx) const                           { return ccast(v.get(idx));             }
+                    inline T *first()                                               { return cast(v.get(0));                }
+                    inline const T *first() const                                   { return ccast(v.get(0));               }
+                    inline T *last()                                                { return cast(v.get(v.nItems - 1));     }
+                    inline const T *last() const                                    { return ccast(v.get(v.nItems - 1));    }
+
+                    /**
+                     * Get contiguous segments of the queue content
+                     * @param a pointer to store the first segment
+                     * @param na pointer to store the size of the first segment
+                     * @param b pointer to store the second segment
+                     * @param nb pointer to store the size of the second segment
+                     * @return number of non-empty segments
+                     */
+                    inline size_t segments(T **a, size_t *na, T **b, size_t *nb)
+                    {
+                        return v.segments(reinterpret_cast<uint8_t **>(a), na, reinterpret_cast<uint8_t **>(b), nb);
+                    }
+
+                public:
+                    // Adding elements, return pointer to the added element
+                    inline T *append()                                              { return cast(v.append(NULL));          }
+                    inline T *add()                                                 { return cast(v.append(NULL));          }
+                    inline T *push()                                                { return cast(v.append(NULL));          }
+                    inline T *unshift()                                             { return cast(v.prepend(NULL));         }
+                    inline T *prepend()                                             { return cast(v.prepend(NULL));         }
+
+                    inline T *append(const T *x)                                    { return cast(v.append(x));             }
+                    inline T *add(const T *x)                                       { return cast(v.append(x));             }
+                    inline T *push(const T *x)                                      { return cast(v.append(x));             }
+                    inline T *unshift(const T *x)                                   { return cast(v.prepend(x));            }
+                    inline T *prepend(const T *x)                                   { return cast(v.prepend(x));            }
+
+                    inline T *append(const T &x)                                    { return cast(v.append(&x));            }
+                    inline T *add(const T &x)                                       { return cast(v.append(&x));            }
+                    inline T *push(const T &x)                                      { return cast(v.append(&x));            }
+                    inline T *unshift(const T &x)                                   { return cast(v.prepend(&x));           }
+                    inline T *prepend(const T &x)                                   { return cast(v.prepend(&x));           }
+
+                    inline bool append_n(size_t n, const T *x)                      { return v.append(n, x);                }
+                    inline bool add_n(size_t n, const T *x)                         { return v.append(n, x);                }
+                    inline bool push_n(size_t n, const T *x)                        { return v.append(n, x);                }
+                    inline bool unshift_n(size_t n, const T *x)                     { return v.prepend(n, x);               }
+                    inline bool prepend_n(size_t n, const T *x)                     { return v.prepend(n, x);               }
+
+                public:
+                    // Removing elements
+                    inline bool pop()                                               { return v.pop(NULL) != NULL;           }
+                    inline bool shift()                                             { return v.shift(NULL) != NULL;         }
+                    inline T *pop(T *x)                                             { return cast(v.pop(x));                }
+                    inline T *shift(T *x)                                           { return cast(v.shift(x));              }
+                    inline T *pop(T &x)                                             { return cast(v.pop(&x));               }
+                    inline T *shift(T &x)                                           { return cast(v.shift(&x));             }
+
+                    inline size_t pop_n(size_t n)                                   { return v.pop(n, NULL);                }
+                    inline size_t shift_n(size_t n)                                 { return v.shift(n, NULL);              }
+                    inline size_t pop_n(size_t n, T *x)                             { return v.pop(n, x);                   }
+                    inline size_t shift_n(size_t n, T *x)                           { return v.shift(n, x);                 }
+
+                public:
+                    // Operators
+                    inline T *operator[](size_t idx)                                { return get(idx);                      }
+                    inline const T *operator[](size_t idx) const                    { return get(idx);                      }
+            };
+
+        /**
+         * Double-ended queue of pointers with O(1) insertion and removal at both ends.
+         */
+        template <class T>
+            class pdeque
+            {
+                private:
+                    pdeque(const pdeque<T> &src);                                   // Disable copying
+                    pdeque<T> & operator = (const pdeque<T> & src);                 // Disable copying
+
+                private:
+                    mutable raw_ddeque      v;
+
+                    inline static T **pcast(void *ptr)                              { return static_cast<T **>(ptr);        }
+                    inline static T *item(void *ptr)                                { return (ptr != NULL) ? *static_cast<T **>(ptr) : NULL;    }
+
+                public:
+                    explicit inline pdeque()                                        { v.init(sizeof(T *));                  }
+                    ~pdeque()                                                       { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.nItems;                      }
+                    inline size_t capacity() const                                  { return v.nCapacity;                   }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                 }
+                    inline bool reserve(size_t capacity)                            { return v.grow(capacity);              }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+
+                public:
+                    // Accessing elements
+                    inline T *get(size_t idx) const                                 { return item(v.get(idx));              }
+                    inline T *first() const                                         { return item(v.get(0));                }
+                    inline T *last() const                                          { return item(v.get(v.nItems - 1));     }
+
+                    inline size_t segments(T ***a, size_t *na, T ***b, size_t *nb)
+                    {
+                        return v.segments(reinterpret_cast<uint8_t **>(a), na, reinterpret_cast<uint8_t **>(b), nb);
+                    }
+
+                public:
+                    // Adding elements
+                    inline bool append(T *x)                                        { return v.append(&x) != NULL;          }
+                    inline bool add(T *x)                                           { return v.append(&x) != NULL;          }
+                    inline bool push(T *x)                                          { return v.append(&x) != NULL;          }
+                    inline bool unshift(T *x)                                       { return v.prepend(&x) != NULL;         }
+                    inline bool prepend(T *x)                                       { return v.prepend(&x) != NULL;         }
+
+                    inline bool append_n(size_t n, T * const *x)                    { return v.append(n, x);                }
+                    inline bool add_n(size_t n, T * const *x)                       { return v.append(n, x);                }
+                    inline bool push_n(size_t n, T * const *x)                      { return v.append(n, x);                }
+                    inline bool unshift_n(size_t n, T * const *x)                   { return v.prepend(n, x);               }
+                    inline bool prepend_n(size_t n, T * const *x)                   { return v.prepend(n, x);               }
+
+                public:
+                    // Removing elements, NULL is returned if the queue is empty
+                    inline T *pop()
+                    {
+                        T *x;
+                        return (v.pop(&x) != NULL) ? x : NULL;
+                    }
+
+                    inline T *shift()
+                    {
+                        T *x;
+                        return (v.shift(&x) != NULL) ? x : NULL;
+                    }
+
+                    inline size_t pop_n(size_t n)                                   { return v.pop(n, NULL);                }
+                    inline size_t shift_n(size_t n)                                 { return v.shift(n, NULL);              }
+                    inline size_t pop_n(size_t n, T **x)                            { return v.pop(n, x);                   }
+                    inline size_t shift_n(size_t n, T **x)                          { return v.shift(n, x);                 }
+
+                public:
+                    // Operators
+                    inline T *operator[](size_t idx) const                          { return get(idx);                      }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_DDEQUE_H_ */
@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_DHEAP_H_
+#define LSP_PLUG_IN_LLTL_DHEAP_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw 4-ary heap with stable handles of elements. The element with
+         * the minimum value according to the comparator is on the top.
+         * Elements are stored densely in the array of items, the handle of
+         * each element is kept in the parallel array and the position of each
+         * handle is kept in the array of positions. Handles of removed
+         * elements are reused.
+         */
+        struct raw_dheap
+        {
+            public:
+                static const size_t ARITY       = 4;                        // Number of children of each node
+                static const size_t INVALID     = size_t(-1);               // Invalid handle or position
+
+            public:
+                raw_darray      vItems;                                     // Items ordered as heap
+                raw_darray      vHeap;                                      // Handle of each item in the heap
+                raw_darray      vPos;                                       // Position of item for each handle or next free handle
+                size_t          nFree;                                      // First free handle
+                uint8_t        *pTemp;                                      // Temporary storage for one item
+                compare_func_t  pCmp;                                       // Comparison function
+                size_t          nCmpSize;                                   // Size of compared objects
+                bool            bIndirect;                                  // Items are pointers to compared objects
+
+            protected:
+                inline uint8_t *item(size_t pos)                            { return &vItems.vItems[pos * vItems.nSizeOf];              }
+                inline size_t  *heap()                                      { return reinterpret_cast<size_t *>(vHeap.vItems);          }
+                inline size_t  *pos()                                       { return reinterpret_cast<size_t *>(vPos.vItems);           }
+
+                inline ssize_t  compare(const uint8_t *a, const uint8_t *b)
+                {
+                    return (bIndirect) ?
+                        pCmp(*reinterpret_cast<void * const *>(a), *reinterpret_cast<void * const *>(b), nCmpSize) :
+                        pCmp(a, b, nCmpSize);
+                }
+
+                size_t          alloc_handle();
+                void            free_handle(size_t h);
+                void            place(size_t idx, const uint8_t *src, size_t h);
+                size_t          sift_up(size_t idx, const uint8_t *src, size_t h);
+                size_t          sift_down(size_t idx, const uint8_t *src, size_t h);
+                void            restore(size_t idx, const uint8_t *src, size_t h);
+                void            heapify();
+                bool            reserve(size_t size);
+                ssize_t         item_offset(const void *src) const;
+                void            remove_at(size_t idx, void *dst);
+
+            public:
+                void            init(size_t n_sizeof, compare_func_t cmp, size_t cmp_size, bool indirect);
+                bool            grow(size_t capacity);
+                void            flush();
+                void            clear();
+                void            swap(raw_dheap *src);
+
+                uint8_t        *top();
+                uint8_t        *get(size_t h);
+                ssize_t         top_handle();
+                bool            contains(size_t h);
+
+                ssize_t         push(const void *src);
+                bool            push(size_t n, const void *src, size_t *handles);
+                bool            pop(void *dst);
+                bool            remove(size_t h, void *dst);
+                bool            update(size_t h, const void *src);
+                bool            merge(raw_dheap *src);
+        };
+
+        /**
+         * Priority queue of plain data structures organized as 4-ary heap.
+         * The minimum element according to the comparator is on the top,
+         * invert the comparator to get the max-heap. The default comparator
+         * orders arithmetic types numerically and other types bytewise.
+         *
+         * Each added element gets the handle which remains valid until the
+         * element is removed from the heap and allows to update or remove the
+         * element in O(log n). Handles of removed elements are reused.
+         */
+        template <class T>
+            class dheap
+            {
+                private:
+                    dheap(const dheap<T> &src);                                     // Disable copying
+                    dheap<T> & operator = (const dheap<T> & src);                   // Disable copying
+
+                private:
+                    mutable raw_dheap       v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+                    inline static const T *ccast(const void *ptr)                   { return static_cast<const T *>(ptr);   }
+
+                public:
+                    explicit inline dheap()
+                    {
+                        compare_spec<T> cmp;
+                        v.init(sizeof(T), cmp.compare, sizeof(T), false);
+                    }
+
+                    explicit inline dheap(const compare_iface &cmp)                 { v.init(sizeof(T), cmp.compare, sizeof(T), false); }
+                    explicit inline dheap(compare_func_t cmp)                       { v.init(sizeof(T), cmp, sizeof(T), false);         }
+                    ~dheap()                                                        { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.vItems.nItems;               }
+                    inline size_t capacity() const                                  { return v.vItems.nCapacity;            }
+                    inline bool is_empty() const                                    { return v.vItems.nItems <= 0;          }
+                    inline bool reserve(size_t capacity)                            { return v.grow(capacity);              }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+                    inline void swap(dheap<T> &src)                                 { v.swap(&src.v);                       }
+                    inline void swap(dheap<T> *src)                                 { v.swap(&src->v);                      }
+
+                public:
+                    // Accessing elements
+                    inline T *top()                                                 { return cast(v.top());                 }
+                    inline const T *top() const                                     { return ccast(v.top());                }
+                    inline ssize_t top_handle() const                               { return v.top_handle();                }
+                    inline const T *get(size_t h) const                             { return ccast(v.get(h));               }
+                    inline bool contains(size_t h) const                            { return v.contains(h);                 }
+
+                    /**
+                     * Get items of the heap in the heap order
+                     * @return pointer to the first item
+                     */
+                    inline const T *array() const                                   { return ccast(v.vItems.vItems);        }
+
+                public:
+                    // Adding elements, return handle of the added element or negative value on error
+                    inline ssize_t push(const T *x)                                 { return v.push(x);                     }
+                    inline ssize_t push(const T &x)                                 { return v.push(&x);                    }
+
+                    /**
+                     * Add multiple elements, the heap is rebuilt at once if the number
+                     * of added elements is comparable with the size of the heap
+                     * @param n number of elements
+                     * @param x array of elements
+                     * @param handles array to store handles of added elements, may be NULL
+                     * @return true on success
+                     */
+                    inline bool push_n(size_t n, const T *x, size_t *handles = NULL){ return v.push(n, x, handles);         }
+
+                    /**
+                     * Move all elements of other heap to this heap, other heap becomes empty.
+                     * Handles of moved elements become invalid
+                     * @param src heap to merge
+                     * @return true on success
+                     */
+                    inline bool merge(dheap<T> &src)                                { return v.merge(&src.v);               }
+                    inline bool merge(dheap<T> *src)                                { return v.merge(&src->v);              }
+
+                public:
+                    // Removing elements
+                    inline bool pop()                                               { return v.pop(NULL);                   }
+                    inline T *pop(T *x)                                             { return (v.pop(x)) ? x : NULL;         }
+                    inline T *pop(T &x)                                             { return (v.pop(&x)) ? &x : NULL;       }
+                    inline bool remove(size_t h)                                    { return v.remove(h, NULL);             }
+                    inline T *remove(size_t h, T *x)                                { return (v.remove(h, x)) ? x : NULL;   }
+                    inline T *remove(size_t h, T &x)                                { return (v.remove(h, &x)) ? &x : NULL; }
+
+                public:
+                    /**
+                     * Replace value of the element and restore the heap order, may be used
+                     * for both decrease-key and increase-key operations
+                     * @param h handle of the element
+                     * @param x new value of the element
+                     * @return true on success, false if handle is not valid
+                     */
+                    inline bool update(size_t h, const T *x)                        { return v.update(h, x);                }
+                    inline bool update(size_t h, const T &x)                        { return v.update(h, &x);               }
+            };
+
+        /**
+         * Priority queue of pointers organized as 4-ary heap, the pointed
+         * objects are compared. The minimum element according to the comparator
+         * is on the top. Pointers should not be NULL.
+         */
+        template <class T>
+            class pheap
+            {
+                private:
+                    pheap(const pheap<T> &src);                                     // Disable copying
+                    pheap<T> & operator = (const pheap<T> & src);                   // Disable copying
+
+                private:
+                    mutable raw_dheap       v;
+
+                    inline static T *item(void *ptr)                                { return (ptr != NULL) ? *static_cast<T **>(ptr) : NULL;    }
+
+                public:
+                    explicit inline pheap()
+                    {
+                        compare_spec<T> cmp;
+                        v.init(sizeof(T *), cmp.compare, sizeof(T), true);
+                    }
+
+                    explicit inline pheap(const compare_iface &cmp)                 { v.init(sizeof(T *), cmp.compare, sizeof(T), true);    }
+                    explicit inline pheap(compare_func_t cmp)                       { v.init(sizeof(T *), cmp, sizeof(T), true);            }
+                    ~pheap()                                                        { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.vItems.nItems;               }
+                    inline size_t capacity() const                                  { return v.vItems.nCapacity;            }
+                    inline bool is_empty() const                                    { return v.vItems.nItems <= 0;          }
+                    inline bool reserve(size_t capacity)                            { return v.grow(capacity);              }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+                    inline void swap(pheap<T> &src)                                 { v.swap(&src.v);                       }
+                    inline void swap(pheap<T> *src)                                 { v.swap(&src->v);                      }
+
+                public:
+                    // Accessing elements
+                    inline T *top() const                                           { return item(v.top());                 }
+                    inline ssize_t top_handle() const                               { return v.top_handle();                }
+                    inline T *get(size_t h) const                                   { return item(v.get(h));                }
+                    inline bool contains(size_t h) const                            { return v.contains(h);                 }
+                    inline T * const *array() const                                 { return reinterpret_cast<T * const *>(v.vItems.vItems);    }
+
+                public:
+                    // Adding elements, return handle of the added element or negative value on error
+                    inline ssize_t push(T *x)                                       { return v.push(&x);                    }
+                    inline bool push_n(size_t n, T * const *x, size_t *handles = NULL)  { return v.push(n, x, handles);     }
+                    inline bool merge(pheap<T> &src)                                { return v.merge(&src.v);               }
+                    inline bool merge(pheap<T> *src)                                { return v.merge(&src->v);              }
+
+                public:
+                    // Removing elements, NULL is returned if there is no element
+                    inline T *pop()
+                    {
+                        T *x;
+                        return (v.pop(&x)) ? x : NULL;
+                    }
+
+                    inline T *remove(size_t h)
+                    {
+                        T *x;
+                        return (v.remove(h, &x)) ? x : NULL;
+                    }
+
+                public:
+                    /**
+                     * Replace the element and restore the heap order. Should be also called
+                     * after the pointed object has been modified in place
+                     * @param h handle of the element
+                     * @param x new pointer
+                     * @return true on success, false if handle is not valid
+                     */
+                    inline bool update(size_t h, T *x)                              { return v.update(h, &x);               }
+                    inline bool update(size_t h)
+                    {
+                        T *x = get(h);
+                        return (x != NULL) ? v.update(h, &x) : false;
+                    }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_DHEAP_H_ */
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_FREELIST_H_
+#define LSP_PLUG_IN_LLTL_FREELIST_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+
+#include <new>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw lock-free free-list of preallocated objects.
+         * Objects are stored in chunks which are never released until flush() is called,
+         * each next chunk is twice larger than the previous one. Each object is preceded
+         * by the header which contains the index of the object and the index of the next
+         * free object. The head of the list is the 64-bit word which contains the index of
+         * the first free object and the modification tag, so the tag prevents the ABA
+         * problem on compare-and-swap.
+         */
+        struct raw_freelist
+        {
+            public:
+                enum constants_t
+                {
+                    CHUNK_SIZE      = 32,                                   // Number of objects in the first chunk
+                    MAX_CHUNKS      = 26,                                   // Maximum number of chunks
+                    HEADER_SIZE     = 16,                                   // Size of object header and alignment
+                };
+
+                typedef struct node_t
+                {
+                    uint32_t    index;                                      // Index of the object
+                    uint32_t    next;                                       // Index of next free object + 1, 0 for end of list
+                } node_t;
+
+            public:
+                uint64_t    nHead;                                          // Index of first free object + 1 and modification tag
+                size_t      nFree;                                          // Number of free objects
+                uint8_t     vPad0[CACHE_LINE_SIZE - sizeof(uint64_t) - sizeof(size_t)];
+
+                size_t      nChunks;                                        // Number of allocated chunks
+                size_t      nCapacity;                                      // Overall number of allocated objects
+                size_t      nSizeOf;                                        // Size of object
+                size_t      nStride;                                        // Size of object with header
+                uint8_t    *vChunks[MAX_CHUNKS];                            // Aligned chunk data
+                uint8_t    *vData[MAX_CHUNKS];                              // Allocated chunk data
+
+            protected:
+                node_t     *node(uint32_t index);
+                void        push(node_t *first, node_t *last, size_t count);
+                bool        grow();
+
+            public:
+                void        init(size_t n_sizeof);
+                void        flush();
+                bool        prefill(size_t count);
+
+                void       *alloc();
+                void        free(void *ptr);
+                size_t      drain(void **items, size_t count);
+                void        fill(void * const *items, size_t count);
+        };
+
+        /**
+         * Lock-free free-list of objects. Allows to allocate and recycle memory for objects
+         * without calling system allocator, so it is safe to use it from real-time thread.
+         * The free-list should be prefilled (for example, from a background thread) with
+         * enough number of objects. All methods except flush() are thread-safe.
+         */
+        template <class T>
+            class freelist
+            {
+                private:
+                    freelist(const freelist<T> &src);                               // Disable copying
+                    freelist<T> & operator = (const freelist<T> & src);             // Disable copying
+
+                private:
+                    mutable raw_freelist    v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+
+                public:
+                    explicit inline freelist()                                      { v.init(sizeof(T));                    }
+                    ~freelist()                                                     { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline bool prefill(size_t count)                               { return v.prefill(count);              }
+                    inline void flush()                                             { v.flush();                            }
+                    inline size_t size() const                                      { return __atomic_load_n(&v.nFree, __ATOMIC_RELAXED);       }
+                    inline size_t capacity() const                                  { return __atomic_load_n(&v.nCapacity, __ATOMIC_RELAXED);   }
+                    inline bool is_empty() const                                    { return size() <= 0;                   }
+
+                public:
+                    // Allocation of raw memory for object, no constructors or destructors are called
+                    inline T *alloc()                                               { return cast(v.alloc());               }
+                    inline void free(T *ptr)                                        { if (ptr != NULL) v.free(ptr);         }
+                    inline size_t drain(T **items, size_t count)                    { return v.drain(reinterpret_cast<void **>(items), count); }
+                    inline void fill(T * const *items, size_t count)                { v.fill(reinterpret_cast<void * const *>(items), count);  }
+
+                public:
+                    // Allocation of constructed objects
+                    inline T *create()
+                    {
+                        void *ptr = v.alloc();
+                        return (ptr != NULL) ? new(ptr) T() : NULL;
+                    }
+
+                    inline T *create(const T *src)
+                    {
+                        void *ptr = v.alloc();
+                        return (ptr != NULL) ? new(ptr) T(src) : NULL;
+                    }
+
+                    inline void destroy(T *ptr)
+                    {
+                        if (ptr == NULL)
+                            return;
+                        ptr->~T();
+                        v.free(ptr);
+                    }
+            };
+
+        /**
+         * Allocator interface which allocates objects from the shared free-list of the type.
+         * To make collections (for example, pphash) clone keys of type K from the free-list,
+         * specialize allocator_spec<K> as derived from freelist_allocator<K>. When the
+         * free-list becomes empty, it is extended with the new chunk, so it should be
+         * prefilled with enough number of objects for real-time usage.
+         */
+        template <class T>
+            struct freelist_allocator: public allocator_iface
+            {
+                static inline freelist<T> *pool()
+                {
+                    static freelist<T> list;
+                    return &list;
+                }
+
+                static void *clone_func(const void *src, size_t size)
+                {
+                    freelist<T> *list   = pool();
+                    T *dst              = list->create(static_cast<const T *>(src));
+                    if ((dst == NULL) && (list->prefill(1)))
+                        dst                 = list->create(static_cast<const T *>(src));
+                    return dst;
+                }
+
+                static void free_func(void *ptr)
+                {
+                    pool()->destroy(static_cast<T *>(ptr));
+                }
+
+                inline freelist_allocator()
+                {
+                    clone       = clone_func;
+                    free        = free_func;
+                }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_FREELIST_H_ */
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_IHASH_H_
+#define LSP_PLUG_IN_LLTL_IHASH_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/iterator.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Hook of the intrusive hash which should be embedded into the object.
+         * The object may contain several hooks to be linked into several hashes
+         * at the same time.
+         */
+        struct ihook
+        {
+            ihook          *pNext;                                      // Next object in the bin
+            size_t          nHash;                                      // Hash value of the key
+        };
+
+        /**
+         * Raw intrusive hash map. The hash map allocates only the array of bins:
+         * objects are chained into bins by hooks embedded into them. The key is
+         * stored in the object too, either directly or by pointer.
+         */
+        struct raw_ihash
+        {
+            public:
+                enum constants_t
+                {
+                    MIN_BINS        = 32                                    // Minimum number of bins
+                };
+
+                enum put_mode_t
+                {
+                    PUT_ANY,                                                // Insert or replace object
+                    PUT_CREATE,                                             // Insert object only if key does not exist
+                };
+
+            public:
+                ihook         **vBins;                                      // Bins
+                size_t          nBins;                                      // Number of bins
+                size_t          nItems;                                     // Number of items
+                size_t          nChanges;                                   // Modification counter
+                size_t          nHookOff;                                   // Offset of the hook in the object
+                size_t          nKeyOff;                                    // Offset of the key in the object
+                size_t          nKeySize;                                   // Size of the key
+                bool            bIndirect;                                  // Object stores pointer to the key
+                hash_iface      hash;                                       // Hash interface
+                compare_iface   cmp;                                        // Compare interface
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
+
+            protected:
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+
+                inline uint8_t *object(ihook *h) const                      { return reinterpret_cast<uint8_t *>(h) - nHookOff;                         }
+                inline ihook   *hook(void *obj) const                       { return reinterpret_cast<ihook *>(static_cast<uint8_t *>(obj) + nHookOff); }
+                inline const void *key(void *obj) const
+                {
+                    uint8_t *k  = static_cast<uint8_t *>(obj) + nKeyOff;
+                    return (bIndirect) ? *reinterpret_cast<void **>(k) : k;
+                }
+
+                ihook         **find(const void *key, size_t h);
+                void            grow();
+
+            public:
+                void            init(size_t hoff, size_t koff, size_t ksize, bool indirect, const hash_iface &h, const compare_iface &c);
+                void            flush();
+                void            clear();
+                void            swap(raw_ihash *src);
+
+                uint8_t        *get(const void *key);
+                bool            put(void *obj, put_mode_t mode, void **ov);
+                bool            remove(void *obj);
+                uint8_t        *remove_key(const void *key);
+
+                raw_iterator    iter();
+        };
+
+        /**
+         * Intrusive hash map of objects. The hash map does not own objects: it chains
+         * the hook of type ihook embedded into the object, the key is a member of the
+         * object and should not be modified while the object is linked. Insertion of
+         * the object never allocates memory except of the growth of the bin array.
+         * Order of iteration is not defined.
+         */
+        template <class K, class T>
+            class ihash
+            {
+                private:
+                    ihash(const ihash<K, T> &src);                                  // Disable copying
+                    ihash<K, T> & operator = (const ihash<K, T> & src);             // Disable copying
+
+                private:
+                    mutable raw_ihash   v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+
+                public:
+                    /**
+                     * Create the hash map with key stored in the object
+                     * @param link pointer to the hook member of the object
+                     * @param key pointer to the key member of the object
+                     */
+                    explicit inline ihash(ihook T::*link, K T::*key)
+                    {
+                        hash_spec<K>        hash;
+                        compare_spec<K>     cmp;
+
+                        v.init(member_offset(link), member_offset(key), sizeof(K), false, hash, cmp);
+                    }
+
+                    /**
+                     * Create the hash map with pointer to the key stored in the object,
+                     * for example pointer to C string for K = char
+                     * @param link pointer to the hook member of the object
+                     * @param key pointer to the key pointer member of the object
+                     */
+                    explicit inline ihash(ihook T::*link, K *T::*key)
+                    {
+                        hash_spec<K>        hash;
+                        compare_spec<K>     cmp;
+
+                        v.init(member_offset(link), member_offset(key), sizeof(K), true, hash, cmp);
+                    }
+
+                    ~ihash()                                                        { v.flush();                            }
+
+                public:
+                    // Size
+                    inline size_t size() const                                      { return v.nItems;                      }
+                    inline size_t capacity() const                                  { return v.nBins;                       }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                 }
+
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+
+                    inline void swap(ihash<K, T> &src)                              { v.swap(&src.v);                       }
+                    inline void swap(ihash<K, T> *src)                              { v.swap(&src->v);                      }
+
+                public:
+                    // Lookup
+                    inline T *get(const K *key, T *dfl = NULL) const
+                    {
+                        T *res = cast(v.get(key));
+                        return (res != NULL) ? res : dfl;
+                    }
+                    inline bool contains(const K *key) const                        { return v.get(key) != NULL;            }
+
+                public:
+                    // Modification
+                    /**
+                     * Link the object only if there is no object with the same key
+                     * @param x object to link
+                     * @return true on success
+                     */
+                    inline bool create(T *x)                                        { return v.put(x, raw_ihash::PUT_CREATE, NULL); }
+
+                    /**
+                     * Link the object, the object with the same key is unlinked
+                     * @param x object to link
+                     * @param ov pointer to store the unlinked object, NULL if there was no object
+                     * @return true on success
+                     */
+                    inline bool put(T *x, T **ov = NULL)                            { return v.put(x, raw_ihash::PUT_ANY, reinterpret_cast<void **>(ov));  }
+
+                    /**
+                     * Unlink the object
+                     * @param x object linked into this hash map
+                     * @return true if object has been unlinked
+                     */
+                    inline bool remove(T *x)                                        { return v.remove(x);                   }
+
+                    /**
+                     * Unlink the object by the key
+                     * @param key key
+                     * @param ov pointer to store the unlinked object
+                     * @return true if object has been unlinked
+                     */
+                    inline bool remove(const K *key, T **ov = NULL)
+                    {
+                        T *res = cast(v.remove_key(key));
+                        if (ov != NULL)
+                            *ov     = res;
+                        return res != NULL;
+                    }
+
+                public:
+                    // Iterators
+                    inline iterator<T> values() const                               { return iterator<T>(v.iter());         }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_IHASH_H_ */
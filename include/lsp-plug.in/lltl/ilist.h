@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_ILIST_H_
+#define LSP_PLUG_IN_LLTL_ILIST_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/iterator.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Hook of the intrusive list which should be embedded into the object.
+         * The object may contain several hooks to be linked into several lists
+         * at the same time. Hooks of objects allocated with malloc() should be
+         * initialized by calling init().
+         */
+        struct ilink
+        {
+            ilink          *pNext;                                      // Next object in the list
+            ilink          *pPrev;                                      // Previous object in the list
+
+            inline ilink()                                              { init();                               }
+            inline void     init()                                      { pNext = NULL; pPrev = NULL;           }
+            inline bool     linked() const                              { return pNext != NULL;                 }
+        };
+
+        /**
+         * Raw intrusive doubly linked list. The list does not allocate memory:
+         * it links hooks embedded into objects at the specified offset. The list
+         * is circular with the sentinel hook stored in the list itself.
+         */
+        struct raw_ilist
+        {
+            public:
+                ilink           sHead;                                      // Sentinel
+                size_t          nItems;                                     // Number of items
+                size_t          nChanges;                                   // Modification counter
+                size_t          nOffset;                                    // Offset of the hook in the object
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
+
+            protected:
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+
+                inline uint8_t *object(ilink *l) const                      { return (l != &sHead) ? reinterpret_cast<uint8_t *>(l) - nOffset : NULL;   }
+                inline ilink   *hook(void *obj) const                       { return reinterpret_cast<ilink *>(static_cast<uint8_t *>(obj) + nOffset);  }
+
+                void            link(ilink *l, ilink *next);
+                void            unlink(ilink *l);
+
+            public:
+                void            init(size_t offset);
+                void            clear();
+                void            swap(raw_ilist *src);
+
+                inline uint8_t *first() const                               { return object(sHead.pNext);           }
+                inline uint8_t *last() const                                { return object(sHead.pPrev);           }
+                inline uint8_t *next(void *obj) const                       { return object(hook(obj)->pNext);      }
+                inline uint8_t *prev(void *obj) const                       { return object(hook(obj)->pPrev);      }
+                inline bool     linked(const void *obj) const               { return hook(const_cast<void *>(obj))->linked();   }
+
+                bool            insert_before(void *pos, void *obj);
+                bool            insert_after(void *pos, void *obj);
+                bool            remove(void *obj);
+                bool            move_before(void *pos, void *obj);
+                uint8_t        *pop();
+                uint8_t        *shift();
+
+                raw_iterator    iter();
+        };
+
+        /**
+         * Intrusive doubly linked list of objects. The list does not own objects
+         * and never allocates memory, it links the hook of type ilink embedded into
+         * the object. Object should not be destroyed while it is linked into the list.
+         * All operations except clear() are O(1).
+         */
+        template <class T>
+            class ilist
+            {
+                private:
+                    ilist(const ilist<T> &src);                                     // Disable copying
+                    ilist<T> & operator = (const ilist<T> & src);                   // Disable copying
+
+                private:
+                    mutable raw_ilist   v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+
+                public:
+                    /**
+                     * Create the list
+                     * @param link pointer to the hook member of the object
+                     */
+                    explicit inline ilist(ilink T::*link)                           { v.init(member_offset(link));          }
+                    ~ilist()                                                        { v.clear();                            }
+
+                public:
+                    // Size
+                    inline size_t size() const                                      { return v.nItems;                      }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                 }
+
+                    /**
+                     * Unlink all objects from the list, O(n)
+                     */
+                    inline void clear()                                             { v.clear();                            }
+                    inline void flush()                                             { v.clear();                            }
+
+                    inline void swap(ilist<T> &src)                                 { v.swap(&src.v);                       }
+                    inline void swap(ilist<T> *src)                                 { v.swap(&src->v);                      }
+
+                public:
+                    // Navigation
+                    inline T *first() const                                         { return cast(v.first());               }
+                    inline T *last() const                                          { return cast(v.last());                }
+                    inline T *next(const T *x) const                                { return cast(v.next(const_cast<T *>(x)));  }
+                    inline T *prev(const T *x) const                                { return cast(v.prev(const_cast<T *>(x)));  }
+
+                    /**
+                     * Check that the hook of the object used by this list is linked into any list
+                     * @param x object
+                     * @return true if object is linked
+                     */
+                    inline bool linked(const T *x) const                            { return v.linked(x);                   }
+
+                public:
+                    // Insertion, fails if the object is already linked
+                    inline bool append(T *x)                                        { return v.insert_before(NULL, x);      }
+                    inline bool add(T *x)                                           { return v.insert_before(NULL, x);      }
+                    inline bool push(T *x)                                          { return v.insert_before(NULL, x);      }
+                    inline bool unshift(T *x)                                       { return v.insert_after(NULL, x);       }
+                    inline bool prepend(T *x)                                       { return v.insert_after(NULL, x);       }
+
+                    inline bool insert_before(T *pos, T *x)                         { return v.insert_before(pos, x);       }
+                    inline bool insert_after(T *pos, T *x)                          { return v.insert_after(pos, x);        }
+
+                public:
+                    // Removal, the object should be linked into this list
+                    inline bool remove(T *x)                                        { return v.remove(x);                   }
+                    inline T *pop()                                                 { return cast(v.pop());                 }
+                    inline T *shift()                                               { return cast(v.shift());               }
+
+                public:
+                    // Reordering, the object should be linked into this list
+                    inline bool move_first(T *x)                                    { return v.move_before(v.first(), x);   }
+                    inline bool move_last(T *x)                                     { return v.move_before(NULL, x);        }
+                    inline bool move_before(T *pos, T *x)                           { return v.move_before(pos, x);         }
+
+                public:
+                    // Iterators
+                    inline iterator<T> values() const                               { return iterator<T>(v.iter());         }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_ILIST_H_ */
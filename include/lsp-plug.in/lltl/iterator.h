@@ -32,101 +32,109 @@ namespace lsp
         struct raw_iterator;
 
         /**
-         * Function to check validity of the raw iterator
-         * @param i iterator to check validity
-         * @return true if iterator is valid
-         */
-        typedef bool (*iter_check_t)(raw_iterator *i);
-
-        /**
-         * Advance to next record in post-increment/pre-increment mode.
-         * Post-increment mode should malloc() and return copy of iterator advanced to n steps.
+         * Advance the iterator for the specified number of steps.
+         * The iterator is guaranteed to be valid and to point to existing item.
          *
          * @param i pointer to the iterator
          * @param n nummber of steps to advance
-         * @return pointer to modified raw iterator
          */
-        typedef raw_iterator *(*iter_move_t)(raw_iterator *i, size_t n);
+        typedef void (*iter_move_t)(raw_iterator *i, size_t n);
 
         /**
-         * Obtain current value the iterator points to
+         * Obtain current value the iterator points to.
+         * The iterator is guaranteed to be valid and to point to existing item.
+         *
          * @param i pointer to iterator
+         * @return pointer to the current value
          */
-        typedef void *(*iter_get_t)(raw_iterator *i);
+        typedef void *(*iter_get_t)(const raw_iterator *i);
 
         /**
-         * Remove current value the iterator points to and advance to the next value
+         * Remove current value the iterator points to and advance to the next value.
+         * The iterator is guaranteed to be valid and to point to existing item.
+         * The implementation should update the change counter of iterator to keep it valid.
+         *
          * @param i pointer to iterator
-         * @return pointer to the item that has been removed
          */
-        typedef void *(*iter_remove_t)(raw_iterator *i);
+        typedef void (*iter_remove_t)(raw_iterator *i);
 
         /**
-         * Raw iterator interface with set of required functions
+         * Set of container-specific iterator functions
          */
-        struct raw_iterator
+        struct iter_vtbl_t
         {
-            public:
-                size_t              refs;       // Number of references
-                size_t              change;     // Counter of changes for validity check
-                iter_check_t        valid;      // Validity check
-                iter_check_t        has_more;   // Check that there are still items to advance
-                iter_move_t         bnext;      // Advance to next record (pre-increment)
-                iter_move_t         anext;      // Advance to next record (post-increment)
-                iter_get_t          get;        // Get current record
-                iter_remove_t       remove;     // Current item removal
+            iter_move_t         advance;    // Advance to next record
+            iter_get_t          get;        // Get current record
+            iter_remove_t       remove;     // Current item removal
+        };
 
+        /**
+         * Raw iterator state. The state is stored in place and can be freely copied,
+         * so no dynamic memory allocation is required for iteration.
+         */
+        struct raw_iterator
+        {
             public:
-                explicit raw_iterator();
+                const iter_vtbl_t  *vtable;     // Container-specific functions
+                void               *container;  // Pointer to the raw container
+                const size_t       *changes;    // Pointer to the modification counter of the container
+                size_t              change;     // Value of modification counter the iterator is valid for
+                size_t              index;      // Index of the current item or bin
+                size_t              limit;      // Container-specific upper bound of the traversal
+                void               *item;       // Current item or tuple, NULL if end of collection reached
 
             public:
-                static raw_iterator    *reference(raw_iterator *src);
-                static raw_iterator    *dereference(raw_iterator *src);
-                static raw_iterator    *replace(raw_iterator *it, raw_iterator *rep);
+                /**
+                 * Check that the collection has not been modified since the iterator was created
+                 * @return true if iterator is valid
+                 */
+                inline bool     valid() const       { return (changes != NULL) && (*changes == change); }
+
+                /**
+                 * Check that the iterator is valid and points to existing item
+                 * @return true if iterator points to existing item
+                 */
+                inline bool     has_more() const    { return (item != NULL) && (valid());               }
+
+                /**
+                 * Initialize iterator to the invalid state
+                 */
+                void            init();
         };
 
         template <class T>
             class iterator
             {
                 protected:
-                    mutable raw_iterator    *it;    // Iterator reference
+                    raw_iterator        it;     // Iterator state
 
                 protected:
                     inline static T *cast(void *ptr)                    { return static_cast<T *>(ptr);                     }
 
-                protected:
-                    template <class X>
-                        friend iterator<X>  make_iterator(raw_iterator *it);
-
-                    explicit inline iterator(raw_iterator *src)         { it = raw_iterator::reference(src);                }
-
                 public:
-                    explicit inline iterator(iterator<T> *src)          { it = raw_iterator::reference(src->it);            }
-                    explicit inline iterator(iterator<T> &src)          { it = raw_iterator::reference(src.it);             }
-                    inline ~iterator()                                  { it = raw_iterator::dereference(it); it = NULL;    }
-
-                    inline iterator<T> &operator = (iterator<T> &src)   { it = raw_iterator::replace(it, src.it); return *this;  }
-                    inline iterator<T> &operator = (iterator<T> *src)   { it = raw_iterator::replace(it, src->it); return *this; }
+                    explicit inline iterator()                          { it.init();                                        }
+                    explicit inline iterator(const raw_iterator &src)   { it = src;                                         }
 
                 public:
                     /**
-                     * Check iterator for validity
+                     * Check iterator for validity: the collection should not be modified
+                     * since the iterator has been created
                      * @return true if iterator is valid
                      */
-                    inline bool         valid() const       { return (it != NULL) && (it->valid(it));               }
+                    inline bool         valid() const       { return it.valid();                                    }
 
                     /**
                      * Check that iterator is valid and can advance
                      * @return true if iterator can advance
                      */
-                    inline bool         contains() const    { return (it != NULL) && (it->has_more(it));            }
+                    inline bool         contains() const    { return it.has_more();                                 }
                     inline operator     bool() const        { return contains();                                    }
 
                     /**
-                     * Check that iterator is valid and is pointing at the end of the collection
-                     * @return true if iterator is valid and is pointing at the end of the collection
+                     * Check that iterator is invalid or is pointing at the end of the collection
+                     * @return true if iterator is invalid or is pointing at the end of the collection
                      */
-                    inline bool         end() const         { return (it == NULL) || (!it->has_more(it));           }
+                    inline bool         end() const         { return !it.has_more();                                }
                     inline bool operator !() const          { return end();                                         }
 
                     /** Advance iterator (pre-increment)
@@ -135,32 +143,33 @@ namespace lsp
                      */
                     inline iterator<T> &bnext()
                     {
-                        if (it != NULL) it = it->bnext(it, 1);
+                        if (it.has_more())
+                            it.vtable->advance(&it, 1);
                         return *this;
                     }
                     inline iterator<T> &operator ++()       { return bnext();                                       }
 
                     /** Advance iterator for the specified number of elements
                      *
-                     * @return
+                     * @return advanced iterator
                      */
                     inline iterator<T> &advance(size_t n)
                     {
-                        if (it != NULL) it = it->bnext(it, n);
+                        if ((n > 0) && (it.has_more()))
+                            it.vtable->advance(&it, n);
                         return *this;
                     }
-                    inline iterator<T> &operator +=(ssize_t n)  { return advance(n);                                }
+                    inline iterator<T> &operator +=(size_t n)   { return advance(n);                                }
 
                     /** Advance iterator (post-increment)
                      *
-                     * @return advanced iterator
+                     * @return copy of iterator before advance
                      */
                     inline iterator<T>  anext()
                     {
-                        raw_iterator *prev = it;
-                        raw_iterator *xit  = (it != NULL) ? it->anext(it, 1) : NULL;
-                        it = raw_iterator::replace(it, xit);
-                        return iterator<T>(prev);
+                        iterator<T> prev(*this);
+                        bnext();
+                        return prev;
                     }
                     inline iterator<T>  operator ++(int)    { return anext();                                       }
 
@@ -168,38 +177,36 @@ namespace lsp
                      *
                      * @return current item
                      */
-                    inline T           *get()               { return (it != NULL) ? cast(it->get(it)) : NULL;       }
+                    inline T           *get()               { return (it.has_more()) ? cast(it.vtable->get(&it)) : NULL;  }
                     inline T *operator *()                  { return get();                                         }
                     inline T *operator ->()                 { return get();                                         }
 
                     /**
-                     * Remove current item and advance to the next one (if it is present)
+                     * Remove current item and advance to the next one (if it is present).
+                     * Other iterators of the same collection become invalid.
                      * @return true on success
                      */
-                    inline T           *remove()            { return (it != NULL) ? cast(it->remove(it)) : NULL;    }
+                    inline bool         remove()
+                    {
+                        if ((!it.has_more()) || (it.vtable->remove == NULL))
+                            return false;
+                        it.vtable->remove(&it);
+                        return true;
+                    }
 
                     /**
                      * Swap data between two iterators
                      * @param src source iterator
                      */
-                    inline void         swap(iterator<T> *src)  { T *tmp = it; it = src->it; src->it = tmp;         }
-                    inline void         swap(iterator<T> &src)  { T *tmp = it; it = src.it; src.it = tmp;           }
+                    inline void         swap(iterator<T> *src)  { raw_iterator tmp = it; it = src->it; src->it = tmp;  }
+                    inline void         swap(iterator<T> &src)  { raw_iterator tmp = it; it = src.it; src.it = tmp;    }
 
                     /**
                      * Get number of change for collection
                      * @return number of change for collection
                      */
-                    inline size_t       change() const      { return (it != NULL) ? it->change : 0;                 }
-
-                    /**
-                     * Get number of references
-                     * @return number of references
-                     */
-                    inline size_t       refs() const      { return (it != NULL) ? it->refs : 0;                     }
+                    inline size_t       change() const      { return it.change;                                     }
             };
-
-        template <class T>
-            inline iterator<T>  make_iterator(raw_iterator *it)     { return iterator<T>(it);                       }
     }
 }
 
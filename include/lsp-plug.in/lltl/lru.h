@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_LRU_H_
+#define LSP_PLUG_IN_LLTL_LRU_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/freelist.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Eviction policy of the cache
+         */
+        enum cache_policy_t
+        {
+            CACHE_LRU,              // Evict the least recently used entry
+            CACHE_CLOCK,            // Evict the oldest entry which has not been accessed since the last pass
+            CACHE_S3FIFO,           // Small and main FIFO queues with ghost queue of evicted keys, resistant to scans
+        };
+
+        /**
+         * Raw cache of pointers with limited overall cost of entries.
+         *
+         * Each entry is linked into the hash chain and into one of doubly linked
+         * queues, the head of the queue is the candidate for eviction. Entries are
+         * allocated from the free-list, keys are copied by the allocator interface.
+         *
+         * CACHE_LRU moves accessed entry to the tail of the main queue. CACHE_CLOCK
+         * only marks accessed entry and gives it the second chance when it reaches
+         * the head. CACHE_S3FIFO puts new entries into the small queue which takes
+         * about 10% of the budget, entries accessed while being in the small queue
+         * are promoted to the main queue and others are evicted to the ghost queue
+         * which keeps only hashes of keys. Entries re-inserted while being in the
+         * ghost queue are put directly to the main queue.
+         */
+        struct raw_lru
+        {
+            public:
+                enum queue_id_t
+                {
+                    Q_MAIN,                                                 // Main queue
+                    Q_SMALL,                                                // Small queue
+                    Q_GHOST,                                                // Ghost queue
+                    Q_TOTAL
+                };
+
+                enum constants_t
+                {
+                    MIN_BINS        = 32,                                   // Minimum number of hash bins
+                    MAX_FREQ        = 3,                                    // Maximum access frequency for S3-FIFO
+                    SMALL_RATIO     = 10,                                   // Part of the budget for small queue, in percents
+                };
+
+                /**
+                 * Eviction function
+                 * @param key key of the entry, is destroyed after the call
+                 * @param value value of the entry
+                 * @param cost cost of the entry
+                 * @param arg user-defined argument
+                 */
+                typedef void (* evict_func_t)(void *key, void *value, size_t cost, void *arg);
+
+                typedef struct entry_t
+                {
+                    entry_t    *pHNext;                                     // Next entry in the hash chain
+                    entry_t    *pPrev;                                      // Previous entry in the queue
+                    entry_t    *pNext;                                      // Next entry in the queue
+                    size_t      nHash;                                      // Hash code of the key
+                    void       *pKey;                                       // Key, NULL for ghost entries
+                    void       *pValue;                                     // Value
+                    size_t      nCost;                                      // Cost
+                    uint8_t     nQueue;                                     // Queue identifier
+                    uint8_t     nFreq;                                      // Access frequency or reference flag
+                } entry_t;
+
+                typedef struct queue_t
+                {
+                    entry_t    *pHead;                                      // The oldest entry
+                    entry_t    *pTail;                                      // The newest entry
+                    size_t      nCount;                                     // Number of entries
+                    size_t      nCost;                                      // Overall cost of entries
+                } queue_t;
+
+            public:
+                entry_t       **vBins;                                      // Hash bins
+                size_t          nBins;                                      // Number of bins, power of two
+                size_t          nEntries;                                   // Number of entries including ghosts
+                size_t          nItems;                                     // Number of entries with values
+                size_t          nCost;                                      // Overall cost of entries
+                size_t          nBudget;                                    // Maximum overall cost
+                size_t          nKeySize;                                   // Size of key
+                hash_iface      hash;                                       // Hash interface
+                compare_iface   cmp;                                        // Compare interface
+                allocator_iface alloc;                                      // Allocator interface
+                cache_policy_t  enPolicy;                                   // Eviction policy
+                queue_t         vQueues[Q_TOTAL];                           // Queues
+                evict_func_t    pEvict;                                     // Eviction function
+                void           *pEvictArg;                                  // Argument of eviction function
+                size_t          nHits;                                      // Number of hits
+                size_t          nMisses;                                    // Number of misses
+                size_t          nEvictions;                                 // Number of evictions
+                raw_freelist    vPool;                                      // Pool of entries
+
+            protected:
+                void            push(entry_t *e, size_t queue);
+                void            unlink(entry_t *e);
+                entry_t        *find(const void *key, size_t hash, bool ghost);
+                void            remove_entry(entry_t *e);
+                bool            grow();
+                void            touch(entry_t *e);
+                void            evict_entry(entry_t *e, bool ghost);
+                bool            evict_main();
+                bool            evict_small();
+                bool            evict();
+                void            make_room(size_t cost);
+
+            public:
+                void            init(size_t ksize, const hash_iface &h, const compare_iface &c, const allocator_iface &a, cache_policy_t policy);
+                void            flush();
+                void            clear();
+                void            set_budget(size_t budget);
+
+                void           *get(const void *key, void *dfl, bool update);
+                bool            put(const void *key, void *value, size_t cost, void **ov);
+                bool            remove(const void *key, void **ov);
+        };
+
+        /**
+         * Cache of pointers to values with O(1) lookup, insertion and eviction.
+         * Keys are automatically managed by the hash and allocator interfaces,
+         * values are managed by caller. Each entry has the cost (for example, the
+         * size of the buffer in bytes), the overall cost of entries does not exceed
+         * the budget. Evicted values are passed to the eviction function which
+         * should release them, values removed explicitly or replaced are returned
+         * to the caller. clear() and flush() do not call the eviction function,
+         * set_budget(0) should be used to evict all entries.
+         */
+        template <class K, class V>
+            class lru
+            {
+                private:
+                    lru(const lru<K, V> &src);                                      // Disable copying
+                    lru<K, V> & operator = (const lru<K, V> & src);                 // Disable copying
+
+                private:
+                    typedef struct evictor_t
+                    {
+                        raw_lru::evict_func_t   func;                               // User function, stored with erased type
+                        void                   *arg;                                // User argument
+                    } evictor_t;
+
+                    template <class A>
+                        struct evictor
+                        {
+                            typedef void (* func_t)(K *key, V *value, size_t cost, A *arg);
+
+                            static void call(void *key, void *value, size_t cost, void *arg)
+                            {
+                                evictor_t *self = static_cast<evictor_t *>(arg);
+                                func_t func     = reinterpret_cast<func_t>(self->func);
+                                func(static_cast<K *>(key), static_cast<V *>(value), cost, static_cast<A *>(self->arg));
+                            }
+                        };
+
+                private:
+                    mutable raw_lru     v;
+                    evictor_t           sEvict;
+
+                    inline static V *vcast(void *ptr)                               { return static_cast<V *>(ptr);             }
+
+                public:
+                    explicit inline lru(cache_policy_t policy = CACHE_LRU)
+                    {
+                        hash_spec<K>        hash;
+                        compare_spec<K>     cmp;
+                        allocator_spec<K>   alloc;
+
+                        v.init(sizeof(K), hash, cmp, alloc, policy);
+                        sEvict.func         = NULL;
+                        sEvict.arg          = NULL;
+                    }
+
+                    ~lru()                                                          { v.flush();                                }
+
+                public:
+                    // Size, cost and statistics
+                    inline size_t size() const                                      { return v.nItems;                          }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                     }
+                    inline size_t cost() const                                      { return v.nCost;                           }
+                    inline size_t budget() const                                    { return v.nBudget;                         }
+                    inline cache_policy_t policy() const                            { return v.enPolicy;                        }
+                    inline size_t hits() const                                      { return v.nHits;                           }
+                    inline size_t misses() const                                    { return v.nMisses;                         }
+                    inline size_t evictions() const                                 { return v.nEvictions;                      }
+                    inline void reset_stats()                                       { v.nHits = 0; v.nMisses = 0; v.nEvictions = 0; }
+
+                    inline void flush()                                             { v.flush();                                }
+                    inline void clear()                                             { v.clear();                                }
+
+                    /**
+                     * Set maximum overall cost of entries, excess entries are evicted
+                     * @param budget maximum overall cost
+                     */
+                    inline void set_budget(size_t budget)                           { v.set_budget(budget);                     }
+
+                    /**
+                     * Set eviction function, the function should not modify the cache
+                     * @param func eviction function, may be NULL
+                     * @param arg argument to pass to the eviction function
+                     */
+                    template <class A>
+                        inline void on_evict(void (* func)(K *key, V *value, size_t cost, A *arg), A *arg)
+                        {
+                            // The function is called only after casting back to its own type
+                            sEvict.func     = reinterpret_cast<raw_lru::evict_func_t>(func);
+                            sEvict.arg      = arg;
+                            v.pEvict        = (func != NULL) ? evictor<A>::call : NULL;
+                            v.pEvictArg     = &sEvict;
+                        }
+
+                public:
+                    /**
+                     * Get value and mark the entry as recently used, updates hit and miss counters
+                     * @param key key
+                     * @param dfl default value to return if there is no entry
+                     * @return value or default value
+                     */
+                    inline V *get(const K *key, V *dfl = NULL)                      { return vcast(v.get(key, dfl, true));      }
+
+                    /**
+                     * Get value without affecting the recency and statistics
+                     * @param key key
+                     * @param dfl default value to return if there is no entry
+                     * @return value or default value
+                     */
+                    inline V *peek(const K *key, V *dfl = NULL) const               { return vcast(v.get(key, dfl, false));     }
+                    inline bool contains(const K *key) const                        { return v.get(key, NULL, false) != NULL;   }
+
+                    /**
+                     * Put the value to the cache, entries are evicted to fit the budget
+                     * @param key key
+                     * @param value value, should not be NULL
+                     * @param cost cost of the entry
+                     * @param ov pointer to store the replaced value, NULL is stored if there was no entry
+                     * @return true on success, false if cost exceeds the budget or on allocation error
+                     */
+                    inline bool put(const K *key, V *value, size_t cost, V **ov = NULL)
+                    {
+                        return v.put(key, value, cost, reinterpret_cast<void **>(ov));
+                    }
+
+                    /**
+                     * Remove the entry without calling the eviction function
+                     * @param key key
+                     * @param ov pointer to store the removed value
+                     * @return true if entry has been removed
+                     */
+                    inline bool remove(const K *key, V **ov = NULL)                 { return v.remove(key, reinterpret_cast<void **>(ov));  }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_LRU_H_ */
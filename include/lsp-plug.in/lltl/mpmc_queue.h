@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_MPMC_QUEUE_H_
+#define LSP_PLUG_IN_LLTL_MPMC_QUEUE_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw bounded lock-free multi-producer multi-consumer queue.
+         * Each slot contains the sequence number followed by the payload. The sequence
+         * number tells whether the slot is ready for writing or for reading at the
+         * current position of the queue, so producers and consumers synchronize only
+         * on the slot they own and on the position counters.
+         */
+        struct raw_mpmc_queue
+        {
+            public:
+                raw_darray  vData;                                          // Storage of slots
+                size_t      nMask;                                          // Capacity - 1
+                size_t      nSizeOf;                                        // Size of payload
+                uint8_t     vPad0[CACHE_LINE_SIZE];
+
+                size_t      nHead;                                          // Enqueue position
+                uint8_t     vPad1[CACHE_LINE_SIZE - sizeof(size_t)];
+
+                size_t      nTail;                                          // Dequeue position
+                uint8_t     vPad2[CACHE_LINE_SIZE - sizeof(size_t)];
+
+            protected:
+                inline size_t  *slot(size_t pos)                            { return reinterpret_cast<size_t *>(&vData.vItems[(pos & nMask) * vData.nSizeOf]); }
+
+            public:
+                void        init(size_t n_sizeof);
+                bool        reserve(size_t capacity);
+                void        flush();
+                void        clear();
+
+                size_t      size() const;
+
+                bool        push(const void *item);
+                bool        pop(void *item);
+        };
+
+        /**
+         * Bounded lock-free multi-producer multi-consumer queue of plain data structures.
+         * The queue should be reserved before it is shared between threads.
+         */
+        template <class T>
+            class mpmc_queue
+            {
+                private:
+                    mpmc_queue(const mpmc_queue<T> &src);                           // Disable copying
+                    mpmc_queue<T> & operator = (const mpmc_queue<T> & src);         // Disable copying
+
+                private:
+                    mutable raw_mpmc_queue  v;
+
+                public:
+                    explicit inline mpmc_queue()                                    { v.init(sizeof(T));                    }
+                    ~mpmc_queue()                                                   { v.flush();                            }
+
+                public:
+                    // Size and capacity, not thread-safe
+                    inline bool reserve(size_t capacity)                            { return v.reserve(capacity);           }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+                    inline size_t capacity() const                                  { return (v.vData.vItems != NULL) ? v.nMask + 1 : 0; }
+
+                public:
+                    // Estimated number of items
+                    inline size_t size() const                                      { return v.size();                      }
+                    inline bool is_empty() const                                    { return v.size() <= 0;                 }
+
+                public:
+                    // Queue operations
+                    inline bool push(const T *item)                                 { return v.push(item);                  }
+                    inline bool push(const T &item)                                 { return v.push(&item);                 }
+                    inline bool pop(T *item)                                        { return v.pop(item);                   }
+                    inline bool pop(T &item)                                        { return v.pop(&item);                  }
+            };
+
+        /**
+         * Bounded lock-free multi-producer multi-consumer queue of pointers.
+         * The queue should be reserved before it is shared between threads.
+         * NULL pointers can not be stored in the queue.
+         */
+        template <class T>
+            class pmpmc_queue
+            {
+                private:
+                    pmpmc_queue(const pmpmc_queue<T> &src);                         // Disable copying
+                    pmpmc_queue<T> & operator = (const pmpmc_queue<T> & src);       // Disable copying
+
+                private:
+                    mutable raw_mpmc_queue  v;
+
+                public:
+                    explicit inline pmpmc_queue()                                   { v.init(sizeof(T *));                  }
+                    ~pmpmc_queue()                                                  { v.flush();                            }
+
+                public:
+                    // Size and capacity, not thread-safe
+                    inline bool reserve(size_t capacity)                            { return v.reserve(capacity);           }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+                    inline size_t capacity() const                                  { return (v.vData.vItems != NULL) ? v.nMask + 1 : 0; }
+
+                public:
+                    // Estimated number of items
+                    inline size_t size() const                                      { return v.size();                      }
+                    inline bool is_empty() const                                    { return v.size() <= 0;                 }
+
+                public:
+                    // Queue operations
+                    inline bool push(T *item)                                       { return (item != NULL) ? v.push(&item) : false;    }
+                    inline T *pop()
+                    {
+                        T *item;
+                        return (v.pop(&item)) ? item : NULL;
+                    }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_MPMC_QUEUE_H_ */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_PARALLEL_H_
+#define LSP_PLUG_IN_LLTL_PARALLEL_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Range processing function
+         *
+         * @param thread index of the chunk in range [0, number of chunks)
+         * @param first index of the first element of the chunk
+         * @param last index of the element after the last element of the chunk
+         * @param arg user-defined argument
+         */
+        typedef     void (* parallel_func_t)(size_t thread, size_t first, size_t last, void *arg);
+
+        /**
+         * Split the range [0, count) into the specified number of nearly equal chunks
+         * and process each chunk in a separate thread. The first chunk is processed by
+         * the calling thread. If some thread can not be launched, the chunk is processed
+         * by the calling thread, too. The function returns when all chunks are processed.
+         *
+         * @param count number of elements in the range
+         * @param threads maximum number of threads to use
+         * @param func function to call for each chunk
+         * @param arg argument to pass to the function
+         * @return number of chunks the range has been split to
+         */
+        size_t      parallel_for(size_t count, size_t threads, parallel_func_t func, void *arg);
+
+        /**
+         * Comparison function for sorting, same as for qsort_r
+         *
+         * @param a pointer to element a
+         * @param b pointer to element b
+         * @param arg user-defined argument
+         * @return negative value if a less than b, positive if a is greater than b, 0 otherwise
+         */
+        typedef     int (* parallel_cmp_t)(const void *a, const void *b, void *arg);
+
+        /**
+         * Default number of elements below which the array is sorted by single thread
+         */
+        static const size_t PARALLEL_SORT_CUTOFF    = 0x4000;
+
+        /**
+         * Sort the array using multiple threads. The array is split into chunks which are
+         * sorted by different threads with qsort_r, then sorted chunks are merged by pairs.
+         * Each merge pass is split between threads by output ranges, so all threads stay
+         * busy even when the last two chunks are merged. If the array is too small or the
+         * scratch buffer can not be allocated, the array is sorted by the calling thread.
+         * The sort is not stable.
+         *
+         * @param base pointer to the first element of the array
+         * @param count number of elements in the array
+         * @param size size of each element
+         * @param cmp comparison function
+         * @param arg argument to pass to the comparison function
+         * @param threads maximum number of threads to use
+         * @param cutoff minimum number of elements per thread
+         */
+        void        parallel_sort(void *base, size_t count, size_t size, parallel_cmp_t cmp, void *arg, size_t threads, size_t cutoff);
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_PARALLEL_H_ */
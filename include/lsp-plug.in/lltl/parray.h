@@ -29,6 +29,8 @@
 
 #include <lsp-plug.in/lltl/version.h>
 #include <lsp-plug.in/lltl/spec.h>
+#include <lsp-plug.in/lltl/iterator.h>
+#include <lsp-plug.in/lltl/parallel.h>
 
 namespace lsp
 {
@@ -41,16 +43,25 @@ namespace lsp
         {
             public:
                 typedef     ssize_t (* cmp_func_t)(const void *a, const void *b);
+                typedef     bool (* pred_func_t)(const void *item, void *arg);
 
             public:
                 size_t      nItems;
                 void      **vItems;
                 size_t      nCapacity;
+                size_t      nChanges;
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
 
             protected:
                 static int  closure_cmp(const void *a, const void *b, void *c);
                 static int  raw_cmp(const void *a, const void *b, void *c);
 
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+
             public:
                 void        init();
                 bool        grow(size_t capacity);
@@ -90,8 +101,16 @@ namespace lsp
                 void      **iremove(size_t idx, size_t n, raw_parray *cs);
 
                 void       *qremove(size_t idx);
+                size_t      count(const void *ptr);
+                ssize_t     find(const void *value, size_t first, sort_closure_t *c);
+                ssize_t     find_if(pred_func_t f, void *arg, size_t first);
+
                 void        qsort(cmp_func_t f);
                 void        qsort(sort_closure_t *c);
+                void        psort(cmp_func_t f, size_t threads, size_t cutoff);
+                void        psort(sort_closure_t *c, size_t threads, size_t cutoff);
+
+                raw_iterator    iter();
         };
 
 
@@ -123,6 +142,7 @@ namespace lsp
                         v.nItems      = 0;
                         v.vItems      = NULL;
                         v.nCapacity   = 0;
+                        v.nChanges    = 0;
                     }
 
                     ~parray() { v.flush(); };
@@ -136,7 +156,7 @@ namespace lsp
 
                 public:
                     // Whole collection manipulations
-                    inline void clear()                                             { v.nItems  = 0;                        }
+                    inline void clear()                                             { v.nItems  = 0; ++v.nChanges;          }
                     inline void flush()                                             { v.flush();                            }
                     inline void truncate()                                          { v.flush();                            }
                     inline void truncate(size_t size)                               { v.truncate(size);                     }
@@ -149,6 +169,7 @@ namespace lsp
                         v.nItems        = 0;
                         v.vItems        = NULL;
                         v.nCapacity     = 0;
+                        ++v.nChanges;
                         return ptr;
                     }
 
@@ -177,6 +198,17 @@ namespace lsp
                     inline const T *array() const                                   { return ccast(v.vItems); }
                     inline const T **slice(size_t idx, size_t size) const           { return pcast(v.slice(idx, size)); }
 
+                public:
+                    // Contiguous range access, [begin(), end()) is a plain pointer range
+                    inline T **begin()                                              { return pcast(v.vItems);               }
+                    inline T **end()                                                { return pcast(&v.vItems[v.nItems]);    }
+                    inline T * const *begin() const                                 { return pcast(v.vItems);               }
+                    inline T * const *end() const                                   { return pcast(&v.vItems[v.nItems]);    }
+
+                public:
+                    // Iterators
+                    inline iterator<T> values()                                     { return iterator<T>(v.iter());         }
+
                 public:
                     // Single modifications
                     inline T **append()                                             { return pcast(v.append(1));            }
@@ -285,6 +317,29 @@ namespace lsp
                     inline T **remove_n(size_t idx, size_t n, parray<T> &x)         { return remove_n(idx, n, &x);                              }
                     inline T **premove_n(const T *ptr, size_t n, parray<T> &x)      { return premove_n(ptr, n, &x);                             }
 
+                public:
+                    // Searching, index_of(), contains() and count() compare pointers with SIMD
+                    inline size_t count(const T *p) const                           { return v.count(p);                    }
+                    inline ssize_t find(const T *value, size_t first = 0) const
+                    {
+                        compare_spec<T> spec;
+                        return find(value, spec, first);
+                    }
+
+                    inline ssize_t find(const T *value, const compare_iface &cmp, size_t first = 0) const
+                    {
+                        sort_closure_t c;
+                        c.compare       = cmp.compare;
+                        c.size          = sizeof(T);
+                        return v.find(value, first, &c);
+                    }
+
+                    template <class A>
+                    inline ssize_t find_if(bool (* pred)(const T *item, A *arg), A *arg, size_t first = 0) const
+                    {
+                        return v.find_if(reinterpret_cast<raw_parray::pred_func_t>(pred), arg, first);
+                    }
+
                 public:
                     // Sorts
                     inline void qsort(cmp_func_t cmp)                               { v.qsort(reinterpret_cast<raw_parray::cmp_func_t>(cmp));   }
@@ -313,6 +368,38 @@ namespace lsp
                         v.qsort(&c);
                     }
 
+                public:
+                    // Parallel sorts
+                    inline void psort(cmp_func_t cmp, size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        v.psort(reinterpret_cast<raw_parray::cmp_func_t>(cmp), threads, cutoff);
+                    }
+
+                    inline void psort(compare_func_t cmp, size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        sort_closure_t c;
+                        c.compare       = cmp;
+                        c.size          = sizeof(T);
+                        v.psort(&c, threads, cutoff);
+                    }
+
+                    inline void psort(const compare_iface &cmp, size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        sort_closure_t c;
+                        c.compare       = cmp.compare;
+                        c.size          = sizeof(T);
+                        v.psort(&c, threads, cutoff);
+                    }
+
+                    inline void psort(size_t threads, size_t cutoff = PARALLEL_SORT_CUTOFF)
+                    {
+                        compare_spec<T> spec;
+                        sort_closure_t c;
+                        c.compare       = spec.compare;
+                        c.size          = sizeof(T);
+                        v.psort(&c, threads, cutoff);
+                    }
+
                 public:
                     // Operators
                     inline T *operator[](size_t idx)                                { return get(idx);                      }
@@ -25,6 +25,7 @@
 #include <lsp-plug.in/lltl/version.h>
 #include <lsp-plug.in/lltl/types.h>
 #include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/lltl/iterator.h>
 
 namespace lsp
 {
@@ -46,6 +47,14 @@ namespace lsp
                     tuple_t    *data;       // Tuples
                 } bin_t;
 
+                /**
+                 * Visitor function
+                 * @param value the item
+                 * @param arg user-defined argument
+                 * @return true to continue visiting, false to stop
+                 */
+                typedef bool (* visitor_t)(void *value, void *arg);
+
             public:
                 size_t          size;       // Overall size of the hash
                 size_t          cap;        // Capacity in bins
@@ -53,6 +62,16 @@ namespace lsp
                 size_t          vsize;      // Size of value object
                 hash_iface      hash;       // Hash interface
                 compare_iface   cmp;        // Copy interface
+                size_t          changes;    // Modification counter
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
+
+            protected:
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+                static int      value_cmp(const void *a, const void *b, void *c);
 
             protected:
                 void            destroy_bin(bin_t *bin);
@@ -71,8 +90,13 @@ namespace lsp
                 void          **create(void *value);
                 bool            toggle(void *value);
                 bool            remove(const void *value, void **ret);
-                bool            values(raw_parray *v);
+                size_t          dump(void **v, size_t count, bool sort);
+                bool            values(raw_parray *v, bool sort);
+                size_t          visit(visitor_t func, void *arg);
+                size_t          visit(size_t first, size_t last, visitor_t func, void *arg);
                 void           *any();
+                raw_iterator    iter();
+                raw_iterator    iter(size_t first, size_t last);
         };
 
         /**
@@ -94,6 +118,19 @@ namespace lsp
                     inline static V **pvcast(void *ptr)     { return reinterpret_cast<V **>(ptr);       }
                     inline static void **pvcast(V **ptr)    { return reinterpret_cast<void **>(ptr);    }
 
+                    template <class A>
+                        struct visitor
+                        {
+                            bool      (* func)(V *value, A *arg);
+                            A          *arg;
+
+                            static bool call(void *value, void *arg)
+                            {
+                                visitor<A> *self = static_cast<visitor<A> *>(arg);
+                                return self->func(static_cast<V *>(value), self->arg);
+                            }
+                        };
+
                 public:
                     explicit inline phashset()
                     {
@@ -106,6 +143,7 @@ namespace lsp
                         v.vsize         = sizeof(V);
                         v.hash          = hash;
                         v.cmp           = cmp;
+                        v.changes       = 0;
                     }
 
                     ~phashset()                                             { v.flush();                                                    }
@@ -230,7 +268,79 @@ namespace lsp
                      * @param vv array to store values
                      * @return true if all keys have been successfully stored
                      */
-                    inline bool values(parray<V> *vv)                        { return v.values(vv->raw());                      }
+                    inline bool values(parray<V> *vv)                        { return v.values(vv->raw(), false);               }
+
+                    /**
+                     * Store all values to the destination array sorted in ascending order
+                     * @param vv array to store values
+                     * @return true if all keys have been successfully stored
+                     */
+                    inline bool sorted_values(parray<V> *vv)                 { return v.values(vv->raw(), true);                }
+
+                    /**
+                     * Store values to the caller-provided buffer
+                     * @param vv buffer to store values
+                     * @param count maximum number of values to store
+                     * @param sort sort stored values in ascending order
+                     * @return number of stored values
+                     */
+                    inline size_t copy_values(V **vv, size_t count, bool sort = false)
+                    {
+                        return v.dump(pvcast(vv), count, sort);
+                    }
+
+                    /**
+                     * Call the visitor function for each value without making a snapshot,
+                     * the visitor should not modify the set
+                     * @param func visitor function, should return false to stop
+                     * @param arg argument to pass to the visitor
+                     * @return number of visited values
+                     */
+                    template <class A>
+                        inline size_t visit(bool (* func)(V *value, A *arg), A *arg)
+                        {
+                            visitor<A> c;
+                            c.func          = func;
+                            c.arg           = arg;
+                            return v.visit(visitor<A>::call, &c);
+                        }
+
+                    /**
+                     * Call the visitor function for each value stored in the range of bins
+                     * [first, last) without making a snapshot, the visitor should not modify the set
+                     * @param first index of the first bin
+                     * @param last index of the bin after the last one
+                     * @param func visitor function, should return false to stop
+                     * @param arg argument to pass to the visitor
+                     * @return number of visited values
+                     */
+                    template <class A>
+                        inline size_t visit(size_t first, size_t last, bool (* func)(V *value, A *arg), A *arg)
+                        {
+                            visitor<A> c;
+                            c.func          = func;
+                            c.arg           = arg;
+                            return v.visit(first, last, visitor<A>::call, &c);
+                        }
+
+                    /**
+                     * Get iterator over values stored in the set
+                     * @return iterator over values
+                     */
+                    inline iterator<V> values()                              { return iterator<V>(v.iter());                    }
+
+                    /**
+                     * Get iterator over values stored in the specified range of bins.
+                     * The range [first, last) should be within [0, capacity()), disjoint ranges
+                     * can be traversed by different threads in parallel if there are no concurrent
+                     * modifications of the set. Iterator should not be used for removal of items
+                     * in this case.
+                     *
+                     * @param first index of the first bin
+                     * @param last index of the bin after the last one
+                     * @return iterator over values
+                     */
+                    inline iterator<V> values(size_t first, size_t last)     { return iterator<V>(v.iter(first, last));         }
             };
     }
 }
@@ -24,15 +24,42 @@
 
 #include <lsp-plug.in/lltl/version.h>
 #include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/darray.h>
 #include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/lltl/iterator.h>
 
 namespace lsp
 {
     namespace lltl
     {
+        /**
+         * Key-value pair of pointers used for exporting hash contents
+         */
+        template <class K, class V>
+            struct pair
+            {
+                K          *key;
+                V          *value;
+            };
+
         struct raw_pphash
         {
             public:
+                typedef struct pair_t
+                {
+                    void       *key;        // Key
+                    void       *value;      // Value
+                } pair_t;
+
+                /**
+                 * Visitor function
+                 * @param key key of the item
+                 * @param value value of the item
+                 * @param arg user-defined argument
+                 * @return true to continue visiting, false to stop
+                 */
+                typedef bool (* visitor_t)(void *key, void *value, void *arg);
+
                 typedef struct tuple_t
                 {
                     size_t      hash;       // Hash code
@@ -55,6 +82,18 @@ namespace lsp
                 hash_iface      hash;       // Hash interface
                 compare_iface   cmp;        // Copy interface
                 allocator_iface alloc;      // Allocator interface
+                size_t          changes;    // Modification counter
+
+            protected:
+                static const iter_vtbl_t    key_iterator_vtbl;
+                static const iter_vtbl_t    value_iterator_vtbl;
+
+            protected:
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get_key(const raw_iterator *i);
+                static void    *iter_get_value(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+                static int      key_cmp(const void *a, const void *b, void *c);
 
             protected:
                 void            destroy_bin(bin_t *bin);
@@ -62,6 +101,7 @@ namespace lsp
                 tuple_t        *find_tuple(const void *key, size_t hash);
                 tuple_t        *remove_tuple(const void *key, size_t hash);
                 tuple_t        *create_tuple(const void *key, size_t hash);
+                raw_iterator    iter(const iter_vtbl_t *vtbl, size_t first, size_t last);
 
             public:
                 void            flush();
@@ -73,9 +113,18 @@ namespace lsp
                 void          **replace(const void *key, void *value, void **ov);
                 void          **create(const void *key, void *value);
                 bool            remove(const void *key, void **ov);
-                bool            keys(raw_parray *k);
+                size_t          dump(void **k, void **v, size_t count);
+                size_t          dump(pair_t *p, size_t count, bool sort);
+                bool            keys(raw_parray *k, bool sort);
                 bool            values(raw_parray *v);
-                bool            items(raw_parray *k, raw_parray *v);
+                bool            items(raw_parray *k, raw_parray *v, bool sort);
+                bool            items(raw_darray *p, bool sort);
+                size_t          visit(visitor_t func, void *arg);
+                size_t          visit(size_t first, size_t last, visitor_t func, void *arg);
+                raw_iterator    kiter();
+                raw_iterator    kiter(size_t first, size_t last);
+                raw_iterator    viter();
+                raw_iterator    viter(size_t first, size_t last);
         };
 
 
@@ -99,6 +148,19 @@ namespace lsp
                     inline static void **pvcast(V **ptr)    { return reinterpret_cast<void **>(ptr);    }
                     inline static void **pkcast(K **ptr)    { return reinterpret_cast<void **>(ptr);    }
 
+                    template <class A>
+                        struct visitor
+                        {
+                            bool      (* func)(K *key, V *value, A *arg);
+                            A          *arg;
+
+                            static bool call(void *key, void *value, void *arg)
+                            {
+                                visitor<A> *self = static_cast<visitor<A> *>(arg);
+                                return self->func(static_cast<K *>(key), static_cast<V *>(value), self->arg);
+                            }
+                        };
+
                 public:
                     explicit inline pphash()
                     {
@@ -113,6 +175,7 @@ namespace lsp
                         v.hash          = hash;
                         v.cmp           = cmp;
                         v.alloc         = alloc;
+                        v.changes       = 0;
                     }
 
                     ~pphash()                                               { v.flush();                                                    }
@@ -267,7 +330,7 @@ namespace lsp
                      * @param vk array to store keys
                      * @return true if all keys have been successfully stored
                      */
-                    inline bool keys(parray<K> *vk)                          { return v.keys(vk->raw());                        }
+                    inline bool keys(parray<K> *vk)                          { return v.keys(vk->raw(), false);                 }
 
                     /**
                      * Store all values to destination array
@@ -282,7 +345,141 @@ namespace lsp
                      * @param vv array to store values
                      * @return true if all keys have been successfully stored
                      */
-                    inline bool items(parray<K> *vk, parray<V> *vv)          { return v.items(vk->raw(), vv->raw());            }
+                    inline bool items(parray<K> *vk, parray<V> *vv)          { return v.items(vk->raw(), vv->raw(), false);     }
+
+                    /**
+                     * Store all items as key-value pairs to destination array
+                     * @param vp array to store pairs
+                     * @return true if all items have been successfully stored
+                     */
+                    inline bool items(darray< pair<K, V> > *vp)              { return v.items(vp->raw(), false);                }
+
+                    /**
+                     * Store all keys to destination array sorted in ascending order
+                     * @param vk array to store keys
+                     * @return true if all keys have been successfully stored
+                     */
+                    inline bool sorted_keys(parray<K> *vk)                   { return v.keys(vk->raw(), true);                  }
+
+                    /**
+                     * Store all items to destination array sorted by key in ascending order
+                     * @param vk array to store keys
+                     * @param vv array to store values
+                     * @return true if all keys have been successfully stored
+                     */
+                    inline bool sorted_items(parray<K> *vk, parray<V> *vv)   { return v.items(vk->raw(), vv->raw(), true);      }
+
+                    /**
+                     * Store all items as key-value pairs to destination array sorted by key
+                     * in ascending order
+                     * @param vp array to store pairs
+                     * @return true if all items have been successfully stored
+                     */
+                    inline bool sorted_items(darray< pair<K, V> > *vp)       { return v.items(vp->raw(), true);                 }
+
+                public:
+                    /**
+                     * Store keys to the caller-provided buffer
+                     * @param vk buffer to store keys
+                     * @param count maximum number of keys to store
+                     * @return number of stored keys
+                     */
+                    inline size_t copy_keys(K **vk, size_t count)            { return v.dump(pkcast(vk), NULL, count);          }
+
+                    /**
+                     * Store values to the caller-provided buffer
+                     * @param vv buffer to store values
+                     * @param count maximum number of values to store
+                     * @return number of stored values
+                     */
+                    inline size_t copy_values(V **vv, size_t count)          { return v.dump(NULL, pvcast(vv), count);          }
+
+                    /**
+                     * Store items to the caller-provided buffers
+                     * @param vk buffer to store keys
+                     * @param vv buffer to store values
+                     * @param count maximum number of items to store
+                     * @return number of stored items
+                     */
+                    inline size_t copy_items(K **vk, V **vv, size_t count)   { return v.dump(pkcast(vk), pvcast(vv), count);    }
+
+                    /**
+                     * Store items as key-value pairs to the caller-provided buffer
+                     * @param vp buffer to store pairs
+                     * @param count maximum number of items to store
+                     * @param sort sort stored items by key in ascending order
+                     * @return number of stored items
+                     */
+                    inline size_t copy_items(pair<K, V> *vp, size_t count, bool sort = false)
+                    {
+                        return v.dump(reinterpret_cast<raw_pphash::pair_t *>(vp), count, sort);
+                    }
+
+                public:
+                    /**
+                     * Call the visitor function for each item without making a snapshot,
+                     * the visitor should not modify the hash
+                     * @param func visitor function, should return false to stop
+                     * @param arg argument to pass to the visitor
+                     * @return number of visited items
+                     */
+                    template <class A>
+                        inline size_t visit(bool (* func)(K *key, V *value, A *arg), A *arg)
+                        {
+                            visitor<A> c;
+                            c.func          = func;
+                            c.arg           = arg;
+                            return v.visit(visitor<A>::call, &c);
+                        }
+
+                    /**
+                     * Call the visitor function for each item stored in the range of bins
+                     * [first, last) without making a snapshot, the visitor should not modify the hash
+                     * @param first index of the first bin
+                     * @param last index of the bin after the last one
+                     * @param func visitor function, should return false to stop
+                     * @param arg argument to pass to the visitor
+                     * @return number of visited items
+                     */
+                    template <class A>
+                        inline size_t visit(size_t first, size_t last, bool (* func)(K *key, V *value, A *arg), A *arg)
+                        {
+                            visitor<A> c;
+                            c.func          = func;
+                            c.arg           = arg;
+                            return v.visit(first, last, visitor<A>::call, &c);
+                        }
+
+                public:
+                    /**
+                     * Get iterator over keys stored in the hash. Removal of the item
+                     * with the iterator destroys the key, the caller is responsible
+                     * for destroying the associated value.
+                     * @return iterator over keys
+                     */
+                    inline iterator<K> keys()                                { return iterator<K>(v.kiter());                   }
+
+                    /**
+                     * Get iterator over values stored in the hash. Removal of the item
+                     * with the iterator destroys the key, the caller is responsible
+                     * for destroying the value.
+                     * @return iterator over values
+                     */
+                    inline iterator<V> values()                              { return iterator<V>(v.viter());                   }
+
+                    /**
+                     * Get iterators over keys and values stored in the specified range of bins.
+                     * The range [first, last) should be within [0, capacity()), disjoint ranges
+                     * can be traversed by different threads in parallel if there are no concurrent
+                     * modifications of the hash. Iterators should not be used for removal of items
+                     * in this case.
+                     *
+                     * @param first index of the first bin
+                     * @param last index of the bin after the last one
+                     * @return iterator over keys or values
+                     */
+                    inline iterator<K> keys(size_t first, size_t last)       { return iterator<K>(v.kiter(first, last));        }
+                    inline iterator<V> values(size_t first, size_t last)     { return iterator<V>(v.viter(first, last));        }
             };
     }
 }
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_RCU_H_
+#define LSP_PLUG_IN_LLTL_RCU_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/pphash.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw read-copy-update publisher of immutable objects with epoch-based reclamation.
+         * Each reader owns a slot where it announces the epoch it has entered the read-side
+         * critical section at. Replaced objects are retired with the epoch of replacement
+         * and destroyed when there are no readers which could still observe them.
+         * Only one writer is allowed at a time, readers are wait-free.
+         */
+        struct raw_rcu
+        {
+            public:
+                typedef struct retired_t
+                {
+                    void       *ptr;        // Retired object
+                    size_t      epoch;      // Epoch of retirement
+                } retired_t;
+
+            public:
+                void           *pCurrent;                               // Currently published object
+                uint8_t         vPad0[CACHE_LINE_SIZE - sizeof(void *)];
+                size_t          nEpoch;                                 // Global epoch counter
+                uint8_t         vPad1[CACHE_LINE_SIZE - sizeof(size_t)];
+                uint8_t        *vReaders;                               // Reader slots, one cache line each
+                uint8_t        *pReaders;                               // Allocated memory for reader slots
+                size_t          nReaders;                               // Number of reader slots
+                raw_darray      vRetired;                               // List of retired objects
+                free_func_t     pFree;                                  // Object destruction function
+
+            protected:
+                inline size_t  *slot(size_t reader)                     { return reinterpret_cast<size_t *>(&vReaders[reader * CACHE_LINE_SIZE]); }
+
+            public:
+                void            init(free_func_t free);
+                bool            reserve(size_t readers);
+                void            flush();
+
+                void           *lock(size_t reader);
+                void            unlock(size_t reader);
+
+                bool            publish(void *ptr);
+                size_t          reclaim();
+        };
+
+        /**
+         * Read-copy-update wrapper over pointer-to-pointer hash map.
+         * Readers obtain immutable snapshot of the hash without any locks, the writer
+         * builds a new version of the hash and publishes it. Keys of replaced versions
+         * are destroyed when all readers leave the snapshot, values are always managed
+         * by the caller.
+         */
+        template <class K, class V>
+            class rcu_pphash
+            {
+                private:
+                    rcu_pphash(const rcu_pphash<K, V> &src);                        // Disable copying
+                    rcu_pphash<K, V> & operator = (const rcu_pphash<K, V> & src);   // Disable copying
+
+                private:
+                    mutable raw_rcu     v;
+
+                    inline static void destroy(void *ptr)                           { delete static_cast<pphash<K, V> *>(ptr); }
+                    inline static pphash<K, V> *cast(void *ptr)                     { return static_cast<pphash<K, V> *>(ptr); }
+
+                public:
+                    explicit inline rcu_pphash()                                    { v.init(destroy);                      }
+                    ~rcu_pphash()                                                   { v.flush();                            }
+
+                public:
+                    /**
+                     * Allocate reader slots, should be called before readers start
+                     * @param readers number of reader slots
+                     * @return true on success
+                     */
+                    inline bool reserve(size_t readers)                             { return v.reserve(readers);            }
+
+                    /**
+                     * Destroy all published and retired versions, there should be no active readers
+                     */
+                    inline void flush()                                             { v.flush();                            }
+
+                    /**
+                     * Get number of reader slots
+                     * @return number of reader slots
+                     */
+                    inline size_t readers() const                                   { return v.nReaders;                    }
+
+                public:
+                    /**
+                     * Enter the read-side critical section and obtain the current snapshot.
+                     * The snapshot remains valid until unlock() is called for the same reader slot.
+                     * @param reader index of the reader slot
+                     * @return current snapshot, NULL if nothing has been published yet
+                     */
+                    inline const pphash<K, V> *lock(size_t reader)                  { return cast(v.lock(reader));          }
+
+                    /**
+                     * Leave the read-side critical section
+                     * @param reader index of the reader slot
+                     */
+                    inline void unlock(size_t reader)                               { v.unlock(reader);                     }
+
+                public:
+                    /**
+                     * Publish new version of the hash. The contents of the passed hash is moved
+                     * into the new version, so the passed hash becomes empty. The previous version
+                     * is retired and destroyed when no readers use it.
+                     * @param src the hash to publish
+                     * @return true on success
+                     */
+                    inline bool publish(pphash<K, V> *src)
+                    {
+                        pphash<K, V> *h = new pphash<K, V>();
+                        if (h == NULL)
+                            return false;
+                        h->swap(src);
+                        if (v.publish(h))
+                            return true;
+                        h->swap(src);
+                        delete h;
+                        return false;
+                    }
+                    inline bool publish(pphash<K, V> &src)                          { return publish(&src);                 }
+
+                    /**
+                     * Get the current version from the writer thread
+                     * @return current version or NULL
+                     */
+                    inline const pphash<K, V> *current() const                      { return cast(v.pCurrent);              }
+
+                    /**
+                     * Destroy retired versions that are not used by readers anymore
+                     * @return number of versions still waiting for reclamation
+                     */
+                    inline size_t reclaim()                                         { return v.reclaim();                   }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_RCU_H_ */
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_SARRAY_H_
+#define LSP_PLUG_IN_LLTL_SARRAY_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/iterator.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw segmented array. Items are stored in chunks of about CHUNK_SIZE bytes
+         * which are never reallocated, so addresses of items remain stable. Each
+         * chunk holds the power of two number of items followed by the bitmap of
+         * occupied slots. Removed slots are linked into the free list and reused
+         * by subsequent insertions, so indices of items also remain stable.
+         */
+        struct raw_sarray
+        {
+            public:
+                enum constants_t
+                {
+                    CHUNK_SIZE      = 4096,                                 // Desired size of the chunk
+                    MIN_ITEMS       = 16,                                   // Minimum number of items per chunk
+                    MIN_CHUNKS      = 16                                    // Initial capacity of the chunk index
+                };
+
+                static const uint32_t   NONE        = uint32_t(-1);         // No free slot
+
+            public:
+                uint8_t       **vChunks;                                    // Chunk index
+                uint32_t       *vOrder;                                     // Chunk numbers sorted by address
+                size_t          nChunks;                                    // Number of chunks
+                size_t          nChunkCap;                                  // Capacity of the chunk index
+                size_t          nItems;                                     // Number of items
+                size_t          nTail;                                      // Number of slots ever used
+                uint32_t        nFree;                                      // First free slot
+                size_t          nSizeOf;                                    // Size of item
+                size_t          nStride;                                    // Size of slot
+                size_t          nShift;                                     // Log2 of number of items per chunk
+                size_t          nMaskOff;                                   // Offset of the bitmap in chunk
+                size_t          nChanges;                                   // Modification counter
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
+
+            protected:
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+
+                inline uint8_t *slot(size_t idx) const                      { return &vChunks[idx >> nShift][(idx & ((size_t(1) << nShift) - 1)) * nStride];  }
+                inline uint64_t *mask(size_t idx) const                     { return reinterpret_cast<uint64_t *>(&vChunks[idx >> nShift][nMaskOff]) + ((idx & ((size_t(1) << nShift) - 1)) >> 6);   }
+                inline bool     used(size_t idx) const                      { return (*mask(idx) >> (idx & 0x3f)) & 1;    }
+
+                bool            add_chunk();
+                ssize_t         next(size_t idx) const;
+
+            public:
+                void            init(size_t n_sizeof);
+                bool            grow(size_t capacity);
+                void            flush();
+                void            clear();
+                void            swap(raw_sarray *src);
+
+                inline size_t   capacity() const                            { return nChunks << nShift;     }
+                inline uint8_t *get(size_t idx) const                       { return ((idx < nTail) && (used(idx))) ? slot(idx) : NULL; }
+                ssize_t         index_of(const void *ptr) const;
+
+                uint8_t        *append(const void *src, size_t *idx);
+                uint8_t        *iremove(size_t idx, void *dst);
+                uint8_t        *premove(const void *ptr, void *dst);
+
+                raw_iterator    iter();
+        };
+
+        /**
+         * Segmented array of plain data structures with stable addresses and indices
+         * of items. Insertion never moves existing items, removal leaves a hole which
+         * is reused by subsequent insertions. Order of items is the order of indices.
+         */
+        template <class T>
+            class sarray
+            {
+                private:
+                    sarray(const sarray<T> &src);                                   // Disable copying
+                    sarray<T> & operator = (const sarray<T> & src);                 // Disable copying
+
+                private:
+                    mutable raw_sarray  v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+
+                public:
+                    explicit inline sarray()                                        { v.init(sizeof(T));                    }
+                    ~sarray()                                                       { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.nItems;                      }
+                    inline size_t capacity() const                                  { return v.capacity();                  }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                 }
+
+                    /**
+                     * Get the upper bound of indices of items
+                     * @return upper bound of indices
+                     */
+                    inline size_t limit() const                                     { return v.nTail;                       }
+
+                public:
+                    // Whole collection manipulations
+                    inline void clear()                                             { v.clear();                            }
+                    inline void flush()                                             { v.flush();                            }
+                    inline bool reserve(size_t capacity)                            { return v.grow(capacity);              }
+                    inline void swap(sarray<T> &src)                                { v.swap(&src.v);                       }
+                    inline void swap(sarray<T> *src)                                { v.swap(&src->v);                      }
+
+                public:
+                    // Accessing elements
+                    inline T *get(size_t idx) const                                 { return cast(v.get(idx));              }
+                    inline T *operator[](size_t idx) const                          { return get(idx);                      }
+                    inline ssize_t index_of(const T *p) const                       { return v.index_of(p);                 }
+                    inline bool contains(const T *p) const                          { return v.index_of(p) >= 0;            }
+
+                public:
+                    // Adding elements, the address of the element never changes
+                    inline T *append()                                              { return cast(v.append(NULL, NULL));    }
+                    inline T *add()                                                 { return cast(v.append(NULL, NULL));    }
+                    inline T *push()                                                { return cast(v.append(NULL, NULL));    }
+                    inline T *append(size_t *idx)                                   { return cast(v.append(NULL, idx));     }
+
+                    inline T *append(const T *x)                                    { return cast(v.append(x, NULL));       }
+                    inline T *add(const T *x)                                       { return cast(v.append(x, NULL));       }
+                    inline T *push(const T *x)                                      { return cast(v.append(x, NULL));       }
+                    inline T *append(const T *x, size_t *idx)                       { return cast(v.append(x, idx));        }
+
+                    inline T *append(const T &x)                                    { return cast(v.append(&x, NULL));      }
+                    inline T *add(const T &x)                                       { return cast(v.append(&x, NULL));      }
+                    inline T *push(const T &x)                                      { return cast(v.append(&x, NULL));      }
+
+                public:
+                    // Removing elements, the slot is reused by subsequent insertions
+                    inline bool remove(size_t idx)                                  { return v.iremove(idx, NULL) != NULL;  }
+                    inline bool premove(const T *ptr)                               { return v.premove(ptr, NULL) != NULL;  }
+                    inline T *remove(size_t idx, T *x)                              { return cast(v.iremove(idx, x));       }
+                    inline T *premove(const T *ptr, T *x)                           { return cast(v.premove(ptr, x));       }
+                    inline T *remove(size_t idx, T &x)                              { return cast(v.iremove(idx, &x));      }
+                    inline T *premove(const T *ptr, T &x)                           { return cast(v.premove(ptr, &x));      }
+
+                public:
+                    // Iterators
+                    inline iterator<T> values() const                               { return iterator<T>(v.iter());         }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_SARRAY_H_ */
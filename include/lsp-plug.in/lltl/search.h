@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_SEARCH_H_
+#define LSP_PLUG_IN_LLTL_SEARCH_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Find the first occurrence of the 32-bit value in the array
+         *
+         * @param v pointer to the array
+         * @param n number of elements in the array
+         * @param value value to search
+         * @return index of the first element equal to the value or negative value if not found
+         */
+        ssize_t     find_u32(const uint32_t *v, size_t n, uint32_t value);
+
+        /**
+         * Find the first occurrence of the 64-bit value in the array
+         *
+         * @param v pointer to the array
+         * @param n number of elements in the array
+         * @param value value to search
+         * @return index of the first element equal to the value or negative value if not found
+         */
+        ssize_t     find_u64(const uint64_t *v, size_t n, uint64_t value);
+
+        /**
+         * Count number of occurrences of the 32-bit value in the array
+         *
+         * @param v pointer to the array
+         * @param n number of elements in the array
+         * @param value value to count
+         * @return number of elements equal to the value
+         */
+        size_t      count_u32(const uint32_t *v, size_t n, uint32_t value);
+
+        /**
+         * Count number of occurrences of the 64-bit value in the array
+         *
+         * @param v pointer to the array
+         * @param n number of elements in the array
+         * @param value value to count
+         * @return number of elements equal to the value
+         */
+        size_t      count_u64(const uint64_t *v, size_t n, uint64_t value);
+
+        /**
+         * Find the first occurrence of the pointer in the array of pointers
+         *
+         * @param v pointer to the array
+         * @param n number of elements in the array
+         * @param ptr pointer to search
+         * @return index of the first element equal to the pointer or negative value if not found
+         */
+        inline ssize_t find_ptr(void * const *v, size_t n, const void *ptr)
+        {
+            return (sizeof(void *) == sizeof(uint64_t)) ?
+                find_u64(reinterpret_cast<const uint64_t *>(v), n, uint64_t(uintptr_t(ptr))) :
+                find_u32(reinterpret_cast<const uint32_t *>(v), n, uint32_t(uintptr_t(ptr)));
+        }
+
+        /**
+         * Count number of occurrences of the pointer in the array of pointers
+         *
+         * @param v pointer to the array
+         * @param n number of elements in the array
+         * @param ptr pointer to count
+         * @return number of elements equal to the pointer
+         */
+        inline size_t count_ptr(void * const *v, size_t n, const void *ptr)
+        {
+            return (sizeof(void *) == sizeof(uint64_t)) ?
+                count_u64(reinterpret_cast<const uint64_t *>(v), n, uint64_t(uintptr_t(ptr))) :
+                count_u32(reinterpret_cast<const uint32_t *>(v), n, uint32_t(uintptr_t(ptr)));
+        }
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_SEARCH_H_ */
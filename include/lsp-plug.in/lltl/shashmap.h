@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_SHASHMAP_H_
+#define LSP_PLUG_IN_LLTL_SHASHMAP_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/pphash.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw concurrent pointer-to-pointer hash map. The map is split into the power of two
+         * number of shards, each shard is a raw_pphash protected by its own read-write lock.
+         * The shard is selected by the high bits of the mixed hash value while bins of the
+         * shard are selected by the low bits, so both distributions remain independent.
+         */
+        struct raw_shashmap
+        {
+            public:
+                uint8_t        *vShards;    // Aligned array of shards
+                uint8_t        *pData;      // Allocated memory for shards
+                size_t          nShards;    // Number of shards
+                size_t          nShift;     // Shift of the mixed hash to obtain shard index
+                size_t          ksize;      // Size of key object
+                hash_iface      hash;       // Hash interface
+                compare_iface   cmp;        // Compare interface
+                allocator_iface alloc;      // Allocator interface
+
+            protected:
+                void           *shard(size_t hash);
+
+            public:
+                bool            init(size_t shards);
+                void            flush();
+                void            clear();
+                size_t          size();
+
+                void           *get(const void *key, void *dfl);
+                bool            exists(const void *key);
+                bool            put(const void *key, void *value, void **ov);
+                bool            create(const void *key, void *value);
+                bool            replace(const void *key, void *value, void **ov);
+                bool            remove(const void *key, void **ov);
+
+                bool            values(raw_parray *v);
+                size_t          visit(raw_pphash::visitor_t func, void *arg);
+        };
+
+        /**
+         * Concurrent pointer-to-pointer hash map, keys are managed automatically and values
+         * are managed by the caller. All methods are thread-safe except init() and flush(),
+         * which should be called when the map is not shared between threads.
+         */
+        template <class K, class V>
+            class shashmap
+            {
+                private:
+                    shashmap(const shashmap<K, V> &src);                            // Disable copying
+                    shashmap<K, V> & operator = (const shashmap<K, V> & src);       // Disable copying
+
+                private:
+                    mutable raw_shashmap    v;
+
+                    inline static V *vcast(void *ptr)       { return static_cast<V *>(ptr);             }
+                    inline static void **pvcast(V **ptr)    { return reinterpret_cast<void **>(ptr);    }
+
+                    template <class A>
+                        struct visitor
+                        {
+                            bool      (* func)(const K *key, V *value, A *arg);
+                            A          *arg;
+
+                            static bool call(void *key, void *value, void *arg)
+                            {
+                                visitor<A> *self = static_cast<visitor<A> *>(arg);
+                                return self->func(static_cast<const K *>(key), static_cast<V *>(value), self->arg);
+                            }
+                        };
+
+                public:
+                    explicit inline shashmap()
+                    {
+                        hash_spec<K>        hash;
+                        compare_spec<K>     cmp;
+                        allocator_spec<K>   alloc;
+
+                        v.vShards       = NULL;
+                        v.pData         = NULL;
+                        v.nShards       = 0;
+                        v.nShift        = 0;
+                        v.ksize         = sizeof(K);
+                        v.hash          = hash;
+                        v.cmp           = cmp;
+                        v.alloc         = alloc;
+                    }
+
+                    ~shashmap()                                             { v.flush();                                    }
+
+                public:
+                    /**
+                     * Allocate shards, should be called before the map is shared between threads
+                     * @param shards number of shards, rounded up to the power of two
+                     * @return true on success
+                     */
+                    inline bool init(size_t shards = 16)                    { return v.init(shards);                        }
+
+                    /**
+                     * Drop all data and shards
+                     */
+                    inline void flush()                                     { v.flush();                                    }
+
+                    /**
+                     * Remove all items, caller is responsible for destroying values
+                     */
+                    inline void clear()                                     { v.clear();                                    }
+
+                    /**
+                     * Get number of shards
+                     * @return number of shards
+                     */
+                    inline size_t shards() const                            { return v.nShards;                             }
+
+                    /**
+                     * Get number of stored items, the value may be outdated
+                     * when the map is concurrently modified
+                     * @return number of stored items
+                     */
+                    inline size_t size() const                              { return v.size();                              }
+                    inline bool is_empty() const                            { return v.size() <= 0;                         }
+
+                public:
+                    /**
+                     * Get value associated with the key
+                     * @param key the key
+                     * @param dfl default value to return if there is no value
+                     * @return associated value or default value
+                     */
+                    inline V *get(const K *key, V *dfl = NULL) const        { return vcast(v.get(key, dfl));                }
+
+                    /**
+                     * Check that the key exists
+                     * @param key the key
+                     * @return true if the key exists
+                     */
+                    inline bool exists(const K *key) const                  { return v.exists(key);                         }
+                    inline bool contains(const K *key) const                { return v.exists(key);                         }
+
+                    /**
+                     * Put the value, replace existing one
+                     * @param key the key
+                     * @param value the value
+                     * @param ov pointer to store the previous value or NULL
+                     * @return true on success
+                     */
+                    inline bool put(const K *key, V *value, V **ov = NULL)  { return v.put(key, value, pvcast(ov));         }
+
+                    /**
+                     * Create the value, fail if the key already exists
+                     * @param key the key
+                     * @param value the value
+                     * @return true if the value has been created
+                     */
+                    inline bool create(const K *key, V *value)              { return v.create(key, value);                  }
+
+                    /**
+                     * Replace the value of existing key
+                     * @param key the key
+                     * @param value the value
+                     * @param ov pointer to store the previous value or NULL
+                     * @return true if the value has been replaced
+                     */
+                    inline bool replace(const K *key, V *value, V **ov = NULL)  { return v.replace(key, value, pvcast(ov));  }
+
+                    /**
+                     * Remove the key
+                     * @param key the key
+                     * @param ov pointer to store the removed value or NULL
+                     * @return true if the key has been removed
+                     */
+                    inline bool remove(const K *key, V **ov = NULL)         { return v.remove(key, pvcast(ov));             }
+
+                public:
+                    /**
+                     * Store all values to destination array, shards are processed one by one
+                     * so the result is not an atomic snapshot of the whole map
+                     * @param vv array to store values
+                     * @return true on success
+                     */
+                    inline bool values(parray<V> *vv)                       { return v.values(vv->raw());                   }
+
+                    /**
+                     * Call the visitor function for each item, the visitor is called while
+                     * the shard is locked for reading and should not modify the map
+                     * @param func visitor function, should return false to stop
+                     * @param arg argument to pass to the visitor
+                     * @return number of visited items
+                     */
+                    template <class A>
+                        inline size_t visit(bool (* func)(const K *key, V *value, A *arg), A *arg)
+                        {
+                            visitor<A> c;
+                            c.func          = func;
+                            c.arg           = arg;
+                            return v.visit(visitor<A>::call, &c);
+                        }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_SHASHMAP_H_ */
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_SLOTMAP_H_
+#define LSP_PLUG_IN_LLTL_SLOTMAP_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/iterator.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Handle of the item stored in the slot map: the lower 32 bits contain index
+         * of the slot, the upper 32 bits contain generation of the slot. Zero handle
+         * is never valid.
+         */
+        typedef uint64_t    slot_handle_t;
+
+        /**
+         * Raw slot map. Items are stored densely in the array, the sparse array of
+         * slots maps handles to positions of items. Each slot has the generation
+         * counter which is incremented on removal, so stale handles are detected.
+         * Removal moves the last item to the place of the removed one.
+         */
+        struct raw_slotmap
+        {
+            public:
+                static const uint32_t   NONE        = uint32_t(-1);         // No free slot
+
+                typedef struct slot_t
+                {
+                    uint32_t        nIndex;                                 // Position of the item or next free slot
+                    uint32_t        nGen;                                   // Generation of the slot
+                } slot_t;
+
+            public:
+                raw_darray      vItems;                                     // Dense array of items
+                raw_darray      vBack;                                      // Slot index of each item
+                raw_darray      vSlots;                                     // Sparse array of slots
+                uint32_t        nFree;                                      // First free slot
+                size_t          nChanges;                                   // Modification counter
+
+            protected:
+                static const iter_vtbl_t    iterator_vtbl;
+
+            protected:
+                static void     iter_advance(raw_iterator *i, size_t n);
+                static void    *iter_get(const raw_iterator *i);
+                static void     iter_remove(raw_iterator *i);
+
+                inline slot_t  *slots() const                               { return reinterpret_cast<slot_t *>(vSlots.vItems);     }
+                inline uint32_t *back() const                               { return reinterpret_cast<uint32_t *>(vBack.vItems);    }
+
+                static inline slot_handle_t make_handle(uint32_t slot, uint32_t gen)
+                {
+                    return (slot_handle_t(gen) << 32) | slot;
+                }
+
+            public:
+                void            init(size_t n_sizeof);
+                bool            grow(size_t capacity);
+                void            flush();
+                void            clear();
+                void            swap(raw_slotmap *src);
+
+                ssize_t         index_of(slot_handle_t h) const;
+                slot_handle_t   handle_of(size_t idx) const;
+                inline uint8_t *get(slot_handle_t h) const
+                {
+                    ssize_t idx = index_of(h);
+                    return (idx >= 0) ? &vItems.vItems[idx * vItems.nSizeOf] : NULL;
+                }
+
+                uint8_t        *append(const void *src, slot_handle_t *h);
+                uint8_t        *remove(slot_handle_t h, void *dst);
+                uint8_t        *iremove(size_t idx, void *dst);
+
+                raw_iterator    iter();
+        };
+
+        /**
+         * Slot map of plain data structures: the dense array of items accessed by
+         * generational handles. Handles remain valid until the item is removed,
+         * access with the stale handle returns NULL. Insertion, removal and lookup
+         * are O(1), items are always stored contiguously but their order and
+         * addresses change on removal.
+         */
+        template <class T>
+            class slotmap
+            {
+                private:
+                    slotmap(const slotmap<T> &src);                                 // Disable copying
+                    slotmap<T> & operator = (const slotmap<T> & src);               // Disable copying
+
+                private:
+                    mutable raw_slotmap v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+
+                public:
+                    explicit inline slotmap()                                       { v.init(sizeof(T));                    }
+                    ~slotmap()                                                      { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.vItems.nItems;               }
+                    inline size_t capacity() const                                  { return v.vItems.nCapacity;            }
+                    inline bool is_empty() const                                    { return v.vItems.nItems <= 0;          }
+
+                public:
+                    // Whole collection manipulations
+                    /**
+                     * Remove all items, all issued handles become stale
+                     */
+                    inline void clear()                                             { v.clear();                            }
+
+                    /**
+                     * Remove all items and free memory, handles issued before
+                     * the call should not be used anymore
+                     */
+                    inline void flush()                                             { v.flush();                            }
+                    inline bool reserve(size_t capacity)                            { return v.grow(capacity);              }
+                    inline void swap(slotmap<T> &src)                               { v.swap(&src.v);                       }
+                    inline void swap(slotmap<T> *src)                               { v.swap(&src->v);                      }
+
+                public:
+                    // Access by handle
+                    inline T *get(slot_handle_t h) const                            { return cast(v.get(h));                }
+                    inline T *operator[](slot_handle_t h) const                     { return cast(v.get(h));                }
+                    inline bool contains(slot_handle_t h) const                     { return v.index_of(h) >= 0;            }
+
+                    /**
+                     * Get position of the item in the dense array
+                     * @param h handle of the item
+                     * @return position or negative value for stale handle
+                     */
+                    inline ssize_t index_of(slot_handle_t h) const                  { return v.index_of(h);                 }
+
+                    /**
+                     * Get handle of the item at the specified position of the dense array
+                     * @param idx position of the item
+                     * @return handle or zero if position is out of range
+                     */
+                    inline slot_handle_t handle_of(size_t idx) const                { return v.handle_of(idx);              }
+
+                public:
+                    // Access to the dense array, valid until the next modification
+                    inline T *array() const                                         { return cast(v.vItems.vItems);         }
+                    inline T *uget(size_t idx) const                                { return cast(&v.vItems.vItems[idx * sizeof(T)]);   }
+
+                public:
+                    // Adding elements
+                    inline T *append(slot_handle_t *h)                              { return cast(v.append(NULL, h));       }
+                    inline T *add(slot_handle_t *h)                                 { return cast(v.append(NULL, h));       }
+                    inline T *append(const T *x, slot_handle_t *h = NULL)           { return cast(v.append(x, h));          }
+                    inline T *add(const T *x, slot_handle_t *h = NULL)              { return cast(v.append(x, h));          }
+                    inline T *append(const T &x, slot_handle_t *h = NULL)           { return cast(v.append(&x, h));         }
+                    inline T *add(const T &x, slot_handle_t *h = NULL)              { return cast(v.append(&x, h));         }
+
+                public:
+                    // Removing elements, the last item takes place of the removed one
+                    inline bool remove(slot_handle_t h)                             { return v.remove(h, NULL) != NULL;     }
+                    inline T *remove(slot_handle_t h, T *x)                         { return cast(v.remove(h, x));          }
+                    inline T *remove(slot_handle_t h, T &x)                         { return cast(v.remove(h, &x));         }
+                    inline bool iremove(size_t idx)                                 { return v.iremove(idx, NULL) != NULL;  }
+                    inline T *iremove(size_t idx, T *x)                             { return cast(v.iremove(idx, x));       }
+
+                public:
+                    // Iterators over the dense array
+                    inline iterator<T> values() const                               { return iterator<T>(v.iter());         }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_SLOTMAP_H_ */
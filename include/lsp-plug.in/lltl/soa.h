@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_SOA_H_
+#define LSP_PLUG_IN_LLTL_SOA_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw structure of arrays: each field of items is stored in the separate
+         * contiguous array aligned to the specified boundary, all arrays share
+         * the same number of items and capacity. All arrays are allocated as the
+         * single memory block, growth follows the same rules as raw_darray.
+         */
+        struct raw_soa
+        {
+            public:
+                enum constants_t
+                {
+                    MAX_FIELDS      = 8,                                    // Maximum number of fields
+                    MIN_FIELD_ALIGN = 16,                                   // Minimum alignment of fields
+                    FIELD_ALIGN     = CACHE_LINE_SIZE                       // Default alignment of fields
+                };
+
+                typedef     ssize_t (* cmp_func_t)(const void *a, const void *b, void *arg);
+
+            public:
+                size_t          nItems;                                     // Number of items
+                size_t          nCapacity;                                  // Capacity
+                size_t          nFields;                                    // Number of fields
+                size_t          nAlign;                                     // Alignment of fields
+                size_t          nChanges;                                   // Modification counter
+                uint8_t        *pData;                                      // Allocated memory block
+                size_t          vSizes[MAX_FIELDS];                         // Size of each field
+                uint8_t        *vFields[MAX_FIELDS];                        // Aligned array of each field
+
+            protected:
+                inline size_t   align(size_t size) const                    { return (size + nAlign - 1) & (~(nAlign - 1)); }
+
+            public:
+                void            init(size_t fields, const size_t *sizes, size_t align);
+                bool            grow(size_t capacity);
+                bool            truncate(size_t capacity);
+                void            flush();
+                void            swap(raw_soa *src);
+
+                inline uint8_t *field(size_t f) const                       { return vFields[f];            }
+                inline uint8_t *item(size_t f, size_t idx) const            { return &vFields[f][idx * vSizes[f]];  }
+
+                ssize_t         append(size_t n);
+                bool            iremove(size_t idx, size_t n);
+                bool            qremove(size_t idx);
+                bool            xswap(size_t i1, size_t i2);
+                bool            sort(size_t f, cmp_func_t cmp, void *arg);
+        };
+
+        /**
+         * Common part of structure of arrays templates
+         */
+        class soa_base
+        {
+            private:
+                soa_base(const soa_base &src);                                      // Disable copying
+                soa_base & operator = (const soa_base & src);                       // Disable copying
+
+            protected:
+                mutable raw_soa     v;
+
+            protected:
+                template <class T>
+                    struct comparator
+                    {
+                        ssize_t   (* func)(const T *a, const T *b);
+
+                        static ssize_t call(const void *a, const void *b, void *arg)
+                        {
+                            const comparator<T> *self = static_cast<const comparator<T> *>(arg);
+                            return self->func(static_cast<const T *>(a), static_cast<const T *>(b));
+                        }
+                    };
+
+                template <class T>
+                    inline bool sort_by(size_t f, ssize_t (* cmp)(const T *a, const T *b))
+                    {
+                        comparator<T> c;
+                        c.func      = cmp;
+                        return v.sort(f, comparator<T>::call, &c);
+                    }
+
+            protected:
+                explicit inline soa_base()                                          {                                       }
+                ~soa_base()                                                         { v.flush();                            }
+
+            public:
+                // Size and capacity
+                inline raw_soa *raw()                                               { return &v;                            }
+                inline size_t size() const                                          { return v.nItems;                      }
+                inline size_t capacity() const                                      { return v.nCapacity;                   }
+                inline bool is_empty() const                                        { return v.nItems <= 0;                 }
+
+                /**
+                 * Get alignment of arrays of fields in bytes
+                 * @return alignment of arrays
+                 */
+                inline size_t alignment() const                                     { return v.nAlign;                      }
+
+            public:
+                // Whole collection manipulations
+                inline void clear()                                                 { v.nItems = 0; ++v.nChanges;           }
+                inline void flush()                                                 { v.flush();                            }
+                inline bool reserve(size_t capacity)                                { return v.grow(capacity);              }
+                inline bool truncate(size_t capacity)                               { return v.truncate(capacity);          }
+
+            public:
+                // Synchronized modification of all fields
+                /**
+                 * Append uninitialized items
+                 * @param n number of items
+                 * @return index of the first item or negative value on error
+                 */
+                inline ssize_t append_n(size_t n)                                   { return v.append(n);                   }
+                inline ssize_t add_n(size_t n)                                      { return v.append(n);                   }
+
+                inline bool remove(size_t idx)                                      { return v.iremove(idx, 1);             }
+                inline bool remove_n(size_t idx, size_t n)                          { return v.iremove(idx, n);             }
+                inline bool pop()                                                   { return (v.nItems > 0) ? v.iremove(v.nItems - 1, 1) : false;  }
+
+                /**
+                 * Remove item by moving the last item to its place
+                 * @param idx index of item
+                 * @return true on success
+                 */
+                inline bool qremove(size_t idx)                                     { return v.qremove(idx);                }
+                inline bool xswap(size_t i1, size_t i2)                             { return v.xswap(i1, i2);               }
+        };
+
+        /**
+         * Structure of arrays with two fields
+         */
+        template <class A, class B>
+            class soa2: public soa_base
+            {
+                public:
+                    explicit inline soa2(size_t align = raw_soa::FIELD_ALIGN)
+                    {
+                        const size_t sizes[] = { sizeof(A), sizeof(B) };
+                        v.init(2, sizes, align);
+                    }
+
+                public:
+                    // Arrays of fields, valid until the next reallocation
+                    inline A *f0() const                                            { return reinterpret_cast<A *>(v.field(0)); }
+                    inline B *f1() const                                            { return reinterpret_cast<B *>(v.field(1)); }
+
+                    inline ssize_t append(const A &a, const B &b)
+                    {
+                        ssize_t idx = v.append(1);
+                        if (idx >= 0)
+                        {
+                            f0()[idx]   = a;
+                            f1()[idx]   = b;
+                        }
+                        return idx;
+                    }
+                    inline ssize_t add(const A &a, const B &b)                      { return append(a, b);                  }
+
+                    inline void swap(soa2<A, B> &src)                               { v.swap(&src.v);                       }
+                    inline void swap(soa2<A, B> *src)                               { v.swap(&src->v);                      }
+
+                    // Sort all fields by the value of one field
+                    inline bool sort0(ssize_t (* cmp)(const A *a, const A *b))      { return sort_by(0, cmp);               }
+                    inline bool sort1(ssize_t (* cmp)(const B *a, const B *b))      { return sort_by(1, cmp);               }
+            };
+
+        /**
+         * Structure of arrays with three fields
+         */
+        template <class A, class B, class C>
+            class soa3: public soa_base
+            {
+                public:
+                    explicit inline soa3(size_t align = raw_soa::FIELD_ALIGN)
+                    {
+                        const size_t sizes[] = { sizeof(A), sizeof(B), sizeof(C) };
+                        v.init(3, sizes, align);
+                    }
+
+                public:
+                    // Arrays of fields, valid until the next reallocation
+                    inline A *f0() const                                            { return reinterpret_cast<A *>(v.field(0)); }
+                    inline B *f1() const                                            { return reinterpret_cast<B *>(v.field(1)); }
+                    inline C *f2() const                                            { return reinterpret_cast<C *>(v.field(2)); }
+
+                    inline ssize_t append(const A &a, const B &b, const C &c)
+                    {
+                        ssize_t idx = v.append(1);
+                        if (idx >= 0)
+                        {
+                            f0()[idx]   = a;
+                            f1()[idx]   = b;
+                            f2()[idx]   = c;
+                        }
+                        return idx;
+                    }
+                    inline ssize_t add(const A &a, const B &b, const C &c)          { return append(a, b, c);               }
+
+                    inline void swap(soa3<A, B, C> &src)                            { v.swap(&src.v);                       }
+                    inline void swap(soa3<A, B, C> *src)                            { v.swap(&src->v);                      }
+
+                    // Sort all fields by the value of one field
+                    inline bool sort0(ssize_t (* cmp)(const A *a, const A *b))      { return sort_by(0, cmp);               }
+                    inline bool sort1(ssize_t (* cmp)(const B *a, const B *b))      { return sort_by(1, cmp);               }
+                    inline bool sort2(ssize_t (* cmp)(const C *a, const C *b))      { return sort_by(2, cmp);               }
+            };
+
+        /**
+         * Structure of arrays with four fields
+         */
+        template <class A, class B, class C, class D>
+            class soa4: public soa_base
+            {
+                public:
+                    explicit inline soa4(size_t align = raw_soa::FIELD_ALIGN)
+                    {
+                        const size_t sizes[] = { sizeof(A), sizeof(B), sizeof(C), sizeof(D) };
+                        v.init(4, sizes, align);
+                    }
+
+                public:
+                    // Arrays of fields, valid until the next reallocation
+                    inline A *f0() const                                            { return reinterpret_cast<A *>(v.field(0)); }
+                    inline B *f1() const                                            { return reinterpret_cast<B *>(v.field(1)); }
+                    inline C *f2() const                                            { return reinterpret_cast<C *>(v.field(2)); }
+                    inline D *f3() const                                            { return reinterpret_cast<D *>(v.field(3)); }
+
+                    inline ssize_t append(const A &a, const B &b, const C &c, const D &d)
+                    {
+                        ssize_t idx = v.append(1);
+                        if (idx >= 0)
+                        {
+                            f0()[idx]   = a;
+                            f1()[idx]   = b;
+                            f2()[idx]   = c;
+                            f3()[idx]   = d;
+                        }
+                        return idx;
+                    }
+                    inline ssize_t add(const A &a, const B &b, const C &c, const D &d)  { return append(a, b, c, d);        }
+
+                    inline void swap(soa4<A, B, C, D> &src)                         { v.swap(&src.v);                       }
+                    inline void swap(soa4<A, B, C, D> *src)                         { v.swap(&src->v);                      }
+
+                    // Sort all fields by the value of one field
+                    inline bool sort0(ssize_t (* cmp)(const A *a, const A *b))      { return sort_by(0, cmp);               }
+                    inline bool sort1(ssize_t (* cmp)(const B *a, const B *b))      { return sort_by(1, cmp);               }
+                    inline bool sort2(ssize_t (* cmp)(const C *a, const C *b))      { return sort_by(2, cmp);               }
+                    inline bool sort3(ssize_t (* cmp)(const D *a, const D *b))      { return sort_by(3, cmp);               }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_SOA_H_ */
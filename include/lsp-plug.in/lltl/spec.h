@@ -47,6 +47,32 @@ namespace lsp
             }
         };
 
+        //---------------------------------------------------------------------
+        // Interfaces for arithmetic types
+        struct signed_compare_iface: public compare_iface
+        {
+            inline signed_compare_iface()
+            {
+                compare     = signed_cmp_func;
+            }
+        };
+
+        struct unsigned_compare_iface: public compare_iface
+        {
+            inline unsigned_compare_iface()
+            {
+                compare     = unsigned_cmp_func;
+            }
+        };
+
+        struct float_compare_iface: public compare_iface
+        {
+            inline float_compare_iface()
+            {
+                compare     = float_cmp_func;
+            }
+        };
+
         //---------------------------------------------------------------------
         // Default specializations
 
@@ -70,7 +96,7 @@ namespace lsp
             {
                 inline compare_spec()
                 {
-                    compare     = ::memcmp;
+                    compare     = default_cmp_func;
                 }
             };
 
@@ -101,6 +127,43 @@ namespace lsp
                 }
             };
 
+        /**
+         * Specialization of radix sort key type, defined only for arithmetic types
+         */
+        template <class T>
+            struct radix_spec;
+
+        template <> struct radix_spec<char>            { static const radix_key_t key = (char(-1) < 0) ? RADIX_SIGNED : RADIX_UNSIGNED; };
+        template <> struct radix_spec<signed char>     { static const radix_key_t key = RADIX_SIGNED;    };
+        template <> struct radix_spec<unsigned char>   { static const radix_key_t key = RADIX_UNSIGNED;  };
+        template <> struct radix_spec<short>           { static const radix_key_t key = RADIX_SIGNED;    };
+        template <> struct radix_spec<unsigned short>  { static const radix_key_t key = RADIX_UNSIGNED;  };
+        template <> struct radix_spec<int>             { static const radix_key_t key = RADIX_SIGNED;    };
+        template <> struct radix_spec<unsigned int>    { static const radix_key_t key = RADIX_UNSIGNED;  };
+        template <> struct radix_spec<long>            { static const radix_key_t key = RADIX_SIGNED;    };
+        template <> struct radix_spec<unsigned long>   { static const radix_key_t key = RADIX_UNSIGNED;  };
+        template <> struct radix_spec<long long>       { static const radix_key_t key = RADIX_SIGNED;    };
+        template <> struct radix_spec<unsigned long long> { static const radix_key_t key = RADIX_UNSIGNED; };
+        template <> struct radix_spec<float>           { static const radix_key_t key = RADIX_FLOAT;     };
+        template <> struct radix_spec<double>          { static const radix_key_t key = RADIX_FLOAT;     };
+
+        /**
+         * Specializations of compare interface for arithmetic types, values are
+         * ordered numerically. The char type is reserved for C strings
+         */
+        template <> struct compare_spec<signed char>: public signed_compare_iface         {};
+        template <> struct compare_spec<unsigned char>: public unsigned_compare_iface     {};
+        template <> struct compare_spec<short>: public signed_compare_iface               {};
+        template <> struct compare_spec<unsigned short>: public unsigned_compare_iface    {};
+        template <> struct compare_spec<int>: public signed_compare_iface                 {};
+        template <> struct compare_spec<unsigned int>: public unsigned_compare_iface      {};
+        template <> struct compare_spec<long>: public signed_compare_iface                {};
+        template <> struct compare_spec<unsigned long>: public unsigned_compare_iface     {};
+        template <> struct compare_spec<long long>: public signed_compare_iface           {};
+        template <> struct compare_spec<unsigned long long>: public unsigned_compare_iface {};
+        template <> struct compare_spec<float>: public float_compare_iface                {};
+        template <> struct compare_spec<double>: public float_compare_iface               {};
+
         //---------------------------------------------------------------------
         // Specialization for C-strings: char *
         template <>
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_SPSC_RING_H_
+#define LSP_PLUG_IN_LLTL_SPSC_RING_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw wait-free single-producer single-consumer ring buffer of plain data structures.
+         * Head and tail are free-running counters, the capacity is always a power of two.
+         * Head and tail are placed at different cache lines to avoid false sharing.
+         */
+        struct raw_spsc_ring
+        {
+            public:
+                raw_darray  vData;                                          // Storage
+                size_t      nMask;                                          // Capacity - 1
+                uint8_t     vPad0[CACHE_LINE_SIZE];
+
+                size_t      nHead;                                          // Write position, modified by producer
+                size_t      nTailCache;                                     // Last tail position seen by producer
+                uint8_t     vPad1[CACHE_LINE_SIZE - 2 * sizeof(size_t)];
+
+                size_t      nTail;                                          // Read position, modified by consumer
+                size_t      nHeadCache;                                     // Last head position seen by consumer
+                uint8_t     vPad2[CACHE_LINE_SIZE - 2 * sizeof(size_t)];
+
+            protected:
+                void        write(size_t head, const uint8_t *src, size_t n);
+                void        read(size_t tail, uint8_t *dst, size_t n);
+
+            public:
+                void        init(size_t n_sizeof);
+                bool        reserve(size_t capacity);
+                void        flush();
+                void        clear();
+
+                size_t      size() const;
+
+                bool        push(const void *item);
+                size_t      push_n(const void *items, size_t n);
+                bool        pop(void *item);
+                size_t      pop_n(void *items, size_t n);
+                void       *front();
+                bool        skip(size_t n);
+        };
+
+        /**
+         * Wait-free single-producer single-consumer ring buffer of plain data structures.
+         * The buffer should be reserved before it is shared between threads. Only one thread
+         * is allowed to push data and only one thread is allowed to pop data at the same time.
+         */
+        template <class T>
+            class spsc_ring
+            {
+                private:
+                    spsc_ring(const spsc_ring<T> &src);                             // Disable copying
+                    spsc_ring<T> & operator = (const spsc_ring<T> & src);           // Disable copying
+
+                private:
+                    mutable raw_spsc_ring   v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+
+                public:
+                    explicit inline spsc_ring()                                     { v.init(sizeof(T));                    }
+                    ~spsc_ring()                                                    { v.flush();                            }
+
+                public:
+                    // Size and capacity, not thread-safe
+                    inline bool reserve(size_t capacity)                            { return v.reserve(capacity);           }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+                    inline size_t capacity() const                                  { return (v.vData.vItems != NULL) ? v.nMask + 1 : 0; }
+
+                public:
+                    // Estimated number of items, exact when called from producer or consumer thread
+                    inline size_t size() const                                      { return v.size();                      }
+                    inline bool is_empty() const                                    { return v.size() <= 0;                 }
+                    inline bool is_full() const                                     { return v.size() >= capacity();        }
+
+                public:
+                    // Producer side
+                    inline bool push(const T *item)                                 { return v.push(item);                  }
+                    inline bool push(const T &item)                                 { return v.push(&item);                 }
+                    inline size_t push_n(const T *items, size_t n)                  { return v.push_n(items, n);            }
+
+                public:
+                    // Consumer side
+                    inline bool pop(T *item)                                        { return v.pop(item);                   }
+                    inline bool pop(T &item)                                        { return v.pop(&item);                  }
+                    inline size_t pop_n(T *items, size_t n)                         { return v.pop_n(items, n);             }
+                    inline T *front()                                               { return cast(v.front());               }
+                    inline bool skip(size_t n = 1)                                  { return v.skip(n);                     }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_SPSC_RING_H_ */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_TRIBUF_H_
+#define LSP_PLUG_IN_LLTL_TRIBUF_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw lock-free triple buffer state. Each of three buffers is owned either by the
+         * producer (back buffer), by the consumer (front buffer) or by nobody (middle buffer).
+         * The producer publishes the back buffer by exchanging it with the middle one, the
+         * consumer fetches the newest frame by exchanging the front buffer with the middle
+         * one. The middle index is marked with the FRESH flag when it contains a frame not
+         * yet seen by the consumer.
+         */
+        struct raw_tribuf
+        {
+            public:
+                enum flags_t
+                {
+                    INDEX_MASK      = 0x03,
+                    FRESH           = 0x04
+                };
+
+            public:
+                size_t      nBack;                                          // Back buffer, owned by producer
+                uint8_t     vPad0[CACHE_LINE_SIZE - sizeof(size_t)];
+
+                size_t      nMiddle;                                        // Middle buffer and FRESH flag
+                uint8_t     vPad1[CACHE_LINE_SIZE - sizeof(size_t)];
+
+                size_t      nFront;                                         // Front buffer, owned by consumer
+                uint8_t     vPad2[CACHE_LINE_SIZE - sizeof(size_t)];
+
+            public:
+                void        init();
+
+                void        publish();
+                bool        fetch();
+                bool        pending() const;
+        };
+
+        /**
+         * Lock-free triple buffer of data arrays. Allows one producer thread to publish
+         * the latest state and one consumer thread to read the newest complete state
+         * without blocking and tearing. Both sides access buffers directly without copying.
+         * Buffers should be reserved before sharing to avoid memory allocations.
+         */
+        template <class T>
+            class tribuf
+            {
+                private:
+                    tribuf(const tribuf<T> &src);                                   // Disable copying
+                    tribuf<T> & operator = (const tribuf<T> & src);                 // Disable copying
+
+                private:
+                    mutable raw_tribuf      v;
+                    darray<T>               vBuffers[3];
+
+                public:
+                    explicit inline tribuf()                                        { v.init();                             }
+
+                public:
+                    // Size and capacity, not thread-safe
+                    inline bool reserve(size_t capacity)
+                    {
+                        for (size_t i=0; i<3; ++i)
+                            if (!vBuffers[i].reserve(capacity))
+                                return false;
+                        return true;
+                    }
+
+                    inline void flush()
+                    {
+                        for (size_t i=0; i<3; ++i)
+                            vBuffers[i].flush();
+                        v.init();
+                    }
+
+                    inline void clear()
+                    {
+                        for (size_t i=0; i<3; ++i)
+                            vBuffers[i].clear();
+                        v.init();
+                    }
+
+                public:
+                    // Producer side
+                    inline darray<T> *back()                                        { return &vBuffers[v.nBack];            }
+                    inline void publish()                                           { v.publish();                          }
+
+                public:
+                    // Consumer side
+                    inline bool pending() const                                     { return v.pending();                   }
+                    inline bool fetch()                                             { return v.fetch();                     }
+                    inline darray<T> *front()                                       { return &vBuffers[v.nFront];           }
+                    inline darray<T> *read()                                        { v.fetch(); return &vBuffers[v.nFront];}
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_TRIBUF_H_ */
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_TWHEEL_H_
+#define LSP_PLUG_IN_LLTL_TWHEEL_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/types.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw hierarchical timing wheel of events keyed by 64-bit integer time.
+         *
+         * Each of LEVELS levels has SLOTS buckets, the bucket of level L covers
+         * SLOTS^L time units. The event is stored at the lowest level which
+         * has the same upper bits of the time as the current time of the wheel,
+         * events beyond the top level are kept in the overflow bucket. Each level
+         * has a bit mask of non-empty buckets, so searching for the next event
+         * is done by the bit scan. When the current time reaches the bucket of
+         * the upper level, events of this bucket are redistributed to the lower
+         * levels.
+         *
+         * Nodes are allocated from the pool stored in the data array and linked
+         * into buckets by indices, removed nodes are reused.
+         */
+        struct raw_twheel
+        {
+            public:
+                static const size_t     BITS        = 6;                    // Number of bits of time per level
+                static const size_t     SLOTS       = 1 << BITS;            // Number of buckets per level
+                static const size_t     LEVELS      = 6;                    // Number of levels
+                static const uint32_t   OVERFLOW    = SLOTS * LEVELS;       // Overflow bucket
+                static const uint32_t   BUCKETS     = OVERFLOW + 1;         // Overall number of buckets
+                static const uint32_t   DETACHED    = BUCKETS;              // Node is not linked to any bucket
+                static const uint32_t   FREE        = BUCKETS + 1;          // Node is in the pool of free nodes
+                static const uint32_t   NONE        = uint32_t(-1);         // No node
+
+                typedef struct node_t
+                {
+                    uint64_t    nTime;                                      // Time of the event
+                    uint32_t    nNext;                                      // Next node in the bucket or in the pool
+                    uint32_t    nPrev;                                      // Previous node in the bucket
+                    uint32_t    nBucket;                                    // Bucket the node is linked to
+                    uint32_t    nReserved;                                  // Reserved for alignment
+                } node_t;
+
+                typedef bool (* visitor_t)(uint64_t time, void *item, void *arg);
+
+            public:
+                raw_darray      vNodes;                                     // Pool of nodes
+                size_t          nItems;                                     // Number of pending events
+                size_t          nSizeOf;                                    // Size of event data
+                uint64_t        nTime;                                      // Current time
+                uint32_t        nFree;                                      // First free node
+                uint64_t        vMask[LEVELS];                              // Masks of non-empty buckets
+                uint32_t        vHead[BUCKETS];                             // First node of each bucket
+                uint32_t        vTail[BUCKETS];                             // Last node of each bucket
+
+            protected:
+                inline node_t  *node(size_t idx)                            { return reinterpret_cast<node_t *>(&vNodes.vItems[idx * vNodes.nSizeOf]);  }
+                static inline uint8_t *data(node_t *n)                      { return reinterpret_cast<uint8_t *>(n) + sizeof(node_t);                   }
+
+                uint32_t        bucket_of(uint64_t time) const;
+                void            link(uint32_t idx, uint32_t bucket);
+                void            unlink(uint32_t idx);
+                void            cascade(uint32_t bucket);
+                uint64_t        min_time(uint32_t bucket);
+                void            free_node(uint32_t idx);
+                uint32_t        pop_node(uint64_t limit);
+                void            seek(uint64_t time);
+
+            public:
+                void            init(size_t n_sizeof);
+                bool            grow(size_t capacity);
+                void            flush();
+                void            clear();
+                void            reset(uint64_t time);
+
+                uint8_t        *get(size_t h);
+                ssize_t         insert(uint64_t time, const void *src);
+                bool            cancel(size_t h, void *dst);
+                bool            pop(uint64_t limit, uint64_t *time, void *dst);
+                size_t          advance(uint64_t delta, visitor_t func, void *arg);
+        };
+
+        /**
+         * Hierarchical timing wheel of plain data structures keyed by integer time,
+         * for example, by the sample position. Insertion and removal are O(1),
+         * advancing the time skips empty buckets by bit scan. Events with the
+         * same time are fetched in the order of insertion, events scheduled
+         * earlier than the current time are fetched immediately.
+         *
+         * Each inserted event gets the handle which remains valid until the
+         * event is fetched or cancelled. Handles of fetched events are reused.
+         */
+        template <class T>
+            class twheel
+            {
+                private:
+                    twheel(const twheel<T> &src);                                   // Disable copying
+                    twheel<T> & operator = (const twheel<T> & src);                 // Disable copying
+
+                private:
+                    mutable raw_twheel      v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+                    inline static const T *ccast(const void *ptr)                   { return static_cast<const T *>(ptr);   }
+
+                    template <class A>
+                        struct visitor
+                        {
+                            bool      (* func)(uint64_t time, T *item, A *arg);
+                            A          *arg;
+
+                            static bool call(uint64_t time, void *item, void *arg)
+                            {
+                                visitor<A> *self = static_cast<visitor<A> *>(arg);
+                                return self->func(time, static_cast<T *>(item), self->arg);
+                            }
+                        };
+
+                public:
+                    explicit inline twheel()                                        { v.init(sizeof(T));                    }
+                    ~twheel()                                                       { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline size_t size() const                                      { return v.nItems;                      }
+                    inline size_t capacity() const                                  { return v.vNodes.nCapacity;            }
+                    inline bool is_empty() const                                    { return v.nItems <= 0;                 }
+                    inline bool reserve(size_t capacity)                            { return v.grow(capacity);              }
+                    inline void flush()                                             { v.flush();                            }
+                    inline void clear()                                             { v.clear();                            }
+
+                    /**
+                     * Get current time of the wheel
+                     * @return current time of the wheel
+                     */
+                    inline uint64_t time() const                                    { return v.nTime;                       }
+
+                    /**
+                     * Remove all events and set current time of the wheel
+                     * @param time new current time
+                     */
+                    inline void reset(uint64_t time)                                { v.reset(time);                        }
+
+                public:
+                    /**
+                     * Schedule the event
+                     * @param time time of the event
+                     * @param x event data
+                     * @return handle of the event or negative value on error
+                     */
+                    inline ssize_t insert(uint64_t time, const T *x)                { return v.insert(time, x);             }
+                    inline ssize_t insert(uint64_t time, const T &x)                { return v.insert(time, &x);            }
+
+                    inline T *get(size_t h)                                         { return cast(v.get(h));                }
+                    inline const T *get(size_t h) const                             { return ccast(v.get(h));               }
+
+                    inline bool cancel(size_t h)                                    { return v.cancel(h, NULL);             }
+                    inline T *cancel(size_t h, T *x)                                { return (v.cancel(h, x)) ? x : NULL;   }
+
+                public:
+                    /**
+                     * Fetch the earliest event which time is less than limit and move
+                     * the current time to the time of the event. The current time is
+                     * not changed if there is no event to fetch
+                     * @param limit time limit
+                     * @param time pointer to store time of the event, may be NULL
+                     * @param x pointer to store the event data, may be NULL
+                     * @return true if event has been fetched
+                     */
+                    inline bool pop(uint64_t limit, uint64_t *time, T *x)           { return v.pop(limit, time, x);         }
+
+                    /**
+                     * Fetch all events which time is less than the current time plus delta
+                     * in the order of time and move the current time forward by delta.
+                     * The visitor may schedule new events, the pointer to the item passed
+                     * to the visitor becomes invalid after that unless the capacity has
+                     * been reserved.
+                     *
+                     * @param delta time delta
+                     * @param func visitor function called for each event, should return false to stop,
+                     *   in this case the current time remains equal to the time of the last fetched event
+                     * @param arg argument to pass to the visitor
+                     * @return number of fetched events
+                     */
+                    template <class A>
+                        inline size_t advance(uint64_t delta, bool (* func)(uint64_t time, T *item, A *arg), A *arg)
+                        {
+                            visitor<A> c;
+                            c.func          = func;
+                            c.arg           = arg;
+                            return v.advance(delta, visitor<A>::call, &c);
+                        }
+
+                    /**
+                     * Move the current time forward by delta, events which time is less
+                     * than the new current time are dropped
+                     * @param delta time delta
+                     * @return number of dropped events
+                     */
+                    inline size_t advance(uint64_t delta)                           { return v.advance(delta, NULL, NULL);  }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_TWHEEL_H_ */
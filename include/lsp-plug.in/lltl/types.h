@@ -34,6 +34,11 @@ namespace lsp
 {
     namespace lltl
     {
+        /**
+         * Size of CPU cache line, used for separating data modified by different threads
+         */
+        static const size_t CACHE_LINE_SIZE     = 64;
+
         /**
          * Hashing function
          *
@@ -98,6 +103,49 @@ namespace lsp
          */
         size_t      default_hash_func(const void *ptr, size_t size);
 
+        /**
+         * Default comparison function, performs bytewise comparison of objects
+         *
+         * @param a pointer to object a
+         * @param b pointer to object b
+         * @param size size of objects in bytes
+         * @return comparison result
+         */
+        ssize_t     default_cmp_func(const void *a, const void *b, size_t size);
+
+        /**
+         * Comparison function for signed integers of 1, 2, 4 or 8 bytes
+         *
+         * @param a pointer to integer a
+         * @param b pointer to integer b
+         * @param size size of integer in bytes
+         * @return comparison result
+         */
+        ssize_t     signed_cmp_func(const void *a, const void *b, size_t size);
+
+        /**
+         * Comparison function for unsigned integers of 1, 2, 4 or 8 bytes
+         *
+         * @param a pointer to integer a
+         * @param b pointer to integer b
+         * @param size size of integer in bytes
+         * @return comparison result
+         */
+        ssize_t     unsigned_cmp_func(const void *a, const void *b, size_t size);
+
+        /**
+         * Comparison function for floating-point numbers of 4 or 8 bytes. Numbers
+         * are ordered by value, besides -0.0 is less than +0.0 and NaNs are
+         * ordered by the binary representation beyond the infinities, so the
+         * result is consistent with the bytewise equality of values
+         *
+         * @param a pointer to number a
+         * @param b pointer to number b
+         * @param size size of number in bytes
+         * @return comparison result
+         */
+        ssize_t     float_cmp_func(const void *a, const void *b, size_t size);
+
         /**
          * Default hashing function for raw pointers (considering pointer
          * being uniquely identifying object)
@@ -178,6 +226,16 @@ namespace lsp
             copy_func_t         copy;       // Copy function
         };
 
+        /**
+         * Type of the key for radix sort
+         */
+        enum radix_key_t
+        {
+            RADIX_UNSIGNED,     // Unsigned integer
+            RADIX_SIGNED,       // Signed integer in two's complement code
+            RADIX_FLOAT         // IEEE 754 floating-point number
+        };
+
         /**
          * Interface for sorting
          */
@@ -186,6 +244,20 @@ namespace lsp
             size_t          size;
             compare_func_t  compare;
         };
+
+        /**
+         * Compute offset of the member within the structure, used by intrusive
+         * containers to locate the hook embedded into the object
+         *
+         * @param member pointer to the member
+         * @return offset of the member in bytes
+         */
+        template <class T, class M>
+            inline size_t member_offset(M T::*member)
+            {
+                const T *base   = reinterpret_cast<const T *>(CACHE_LINE_SIZE);
+                return reinterpret_cast<const uint8_t *>(&(base->*member)) - reinterpret_cast<const uint8_t *>(base);
+            }
     }
 }
 
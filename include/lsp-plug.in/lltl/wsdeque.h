@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_LLTL_WSDEQUE_H_
+#define LSP_PLUG_IN_LLTL_WSDEQUE_H_
+
+#include <lsp-plug.in/lltl/version.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Raw Chase-Lev work-stealing deque of pointers over growable circular array.
+         * The owner thread pushes and pops pointers at the bottom, other threads steal
+         * pointers from the top. When the array becomes full, the owner replaces it with
+         * the twice larger copy. Replaced arrays may still be read by thieves, so they
+         * are retired and released only by flush().
+         */
+        struct raw_wsdeque
+        {
+            public:
+                typedef struct array_t
+                {
+                    size_t      nMask;                                      // Capacity - 1
+                    void      **vItems;                                     // Circular array of pointers
+                } array_t;
+
+            public:
+                ssize_t     nTop;                                           // Steal position
+                uint8_t     vPad0[CACHE_LINE_SIZE - sizeof(ssize_t)];
+
+                ssize_t     nBottom;                                        // Push/pop position, modified by owner
+                array_t    *pArray;                                         // Current array
+                uint8_t     vPad1[CACHE_LINE_SIZE - sizeof(ssize_t) - sizeof(array_t *)];
+
+                raw_parray  vRetired;                                       // Replaced arrays
+
+            protected:
+                array_t    *grow(array_t *a, ssize_t top, ssize_t bottom, size_t capacity);
+
+            public:
+                void        init();
+                bool        reserve(size_t capacity);
+                void        flush();
+
+                size_t      size() const;
+                size_t      capacity() const;
+
+                bool        push(void *item);
+                void       *pop();
+                void       *steal();
+        };
+
+        /**
+         * Chase-Lev work-stealing deque of pointers. Only the owner thread is allowed
+         * to call push() and pop(), any thread is allowed to call steal(). NULL pointers
+         * can not be stored in the deque.
+         */
+        template <class T>
+            class wsdeque
+            {
+                private:
+                    wsdeque(const wsdeque<T> &src);                                 // Disable copying
+                    wsdeque<T> & operator = (const wsdeque<T> & src);               // Disable copying
+
+                private:
+                    mutable raw_wsdeque     v;
+
+                    inline static T *cast(void *ptr)                                { return static_cast<T *>(ptr);         }
+
+                public:
+                    explicit inline wsdeque()                                       { v.init();                             }
+                    ~wsdeque()                                                      { v.flush();                            }
+
+                public:
+                    // Size and capacity
+                    inline bool reserve(size_t capacity)                            { return v.reserve(capacity);           }
+                    inline void flush()                                             { v.flush();                            }
+                    inline size_t capacity() const                                  { return v.capacity();                  }
+                    inline size_t size() const                                      { return v.size();                      }
+                    inline bool is_empty() const                                    { return v.size() <= 0;                 }
+
+                public:
+                    // Owner side
+                    inline bool push(T *item)                                       { return (item != NULL) ? v.push(item) : false; }
+                    inline T *pop()                                                 { return cast(v.pop());                 }
+
+                public:
+                    // Thief side
+                    inline T *steal()                                               { return cast(v.steal());               }
+            };
+    }
+}
+
+#endif /* LSP_PLUG_IN_LLTL_WSDEQUE_H_ */
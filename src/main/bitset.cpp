@@ -24,10 +24,147 @@
 #include <lsp-plug.in/stdlib/string.h>
 #include <stdlib.h>
 
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
 namespace lsp
 {
     namespace lltl
     {
+        /**
+         * Pack up to UMWORD_BITS byte flags into the machine word, any non-zero byte
+         * is treated as a set bit
+         *
+         * @param src source flags
+         * @param n number of flags, should be in range of [1, UMWORD_BITS]
+         * @return packed word
+         */
+        static umword_t pack_flags(const uint8_t *src, size_t n)
+        {
+            umword_t v      = 0;
+            size_t i        = 0;
+
+        #ifdef __SSE2__
+            const __m128i zero  = _mm_setzero_si128();
+            for ( ; (i + 16) <= n; i += 16)
+            {
+                __m128i x       = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[i])), zero);
+                umword_t m      = (~_mm_movemask_epi8(x)) & 0xffff;
+                v              |= m << i;
+            }
+        #endif /* __SSE2__ */
+
+        #ifdef ARCH_LE
+            for ( ; (i + 8) <= n; i += 8)
+            {
+                uint64_t x;
+                ::memcpy(&x, &src[i], sizeof(x));
+                x              |= x >> 4;
+                x              |= x >> 2;
+                x              |= x >> 1;
+                x              &= 0x0101010101010101ULL;
+                v              |= umword_t((x * 0x0102040810204080ULL) >> 56) << i;
+            }
+        #endif /* ARCH_LE */
+
+            for ( ; i < n; ++i)
+            {
+                if (src[i])
+                    v              |= umword_t(1) << i;
+            }
+
+            return v;
+        }
+
+        /**
+         * Unpack up to UMWORD_BITS bits of the machine word into byte flags
+         * containing 0 or 1 values
+         *
+         * @param dst destination flags
+         * @param v word to unpack
+         * @param n number of flags, should be in range of [1, UMWORD_BITS]
+         */
+        static void unpack_flags(uint8_t *dst, umword_t v, size_t n)
+        {
+            size_t i        = 0;
+
+        #ifdef ARCH_LE
+            for ( ; (i + 8) <= n; i += 8, v >>= 8)
+            {
+                uint64_t x      = (uint64_t(v & 0xff) * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+                x               = ((x + 0x7f7f7f7f7f7f7f7fULL) >> 7) & 0x0101010101010101ULL;
+                ::memcpy(&dst[i], &x, sizeof(x));
+            }
+        #endif /* ARCH_LE */
+
+            for ( ; i < n; ++i, v >>= 1)
+                dst[i]          = v & 1;
+        }
+
+        /**
+         * Load up to UMWORD_BITS bits from the packed byte buffer (LSB first)
+         *
+         * @param src source buffer
+         * @param n number of bits, should be in range of [1, UMWORD_BITS]
+         * @return loaded word with unused bits cleared
+         */
+        static umword_t load_packed(const uint8_t *src, size_t n)
+        {
+            umword_t v      = 0;
+            for (size_t i=0, bytes=(n + 7) >> 3; i<bytes; ++i)
+                v              |= umword_t(src[i]) << (i << 3);
+            return v & (UMWORD_MAX >> (UMWORD_BITS - n));
+        }
+
+        /**
+         * Store up to UMWORD_BITS bits to the packed byte buffer (LSB first)
+         *
+         * @param dst destination buffer
+         * @param v the word to store, unused bits should be cleared
+         * @param n number of bits, should be in range of [1, UMWORD_BITS]
+         */
+        static void store_packed(uint8_t *dst, umword_t v, size_t n)
+        {
+            for (size_t i=0, bytes=(n + 7) >> 3; i<bytes; ++i, v >>= 8)
+                dst[i]          = uint8_t(v);
+        }
+
+        /**
+         * Write n bits to the bit storage at the specified bit offset
+         *
+         * @param w pointer to the first word to modify
+         * @param off bit offset in the first word
+         * @param v bits to write, unused bits should be cleared
+         * @param n number of bits, should be in range of [1, UMWORD_BITS]
+         */
+        static inline void put_bits(umword_t *w, size_t off, umword_t v, size_t n)
+        {
+            umword_t mask   = UMWORD_MAX >> (UMWORD_BITS - n);
+            w[0]            = (w[0] & (~(mask << off))) | (v << off);
+            if ((off + n) > UMWORD_BITS)
+            {
+                size_t sh       = UMWORD_BITS - off;
+                w[1]            = (w[1] & (~(mask >> sh))) | (v >> sh);
+            }
+        }
+
+        /**
+         * Read n bits from the bit storage at the specified bit offset
+         *
+         * @param w pointer to the first word to read
+         * @param off bit offset in the first word
+         * @param n number of bits, should be in range of [1, UMWORD_BITS]
+         * @return read bits, unused bits are cleared
+         */
+        static inline umword_t fetch_bits(const umword_t *w, size_t off, size_t n)
+        {
+            umword_t v      = w[0] >> off;
+            if ((off + n) > UMWORD_BITS)
+                v              |= w[1] << (UMWORD_BITS - off);
+            return v & (UMWORD_MAX >> (UMWORD_BITS - n));
+        }
+
         bitset::bitset()
         {
             nSize       = 0;
@@ -98,6 +235,53 @@ namespace lsp
             return vData[cap] & mask;
         }
 
+        size_t bitset::get(size_t index, size_t count, bool *values) const
+        {
+            return get(index, count, reinterpret_cast<uint8_t *>(values));
+        }
+
+        size_t bitset::get(size_t index, size_t count, uint8_t *values) const
+        {
+            if (index >= nSize)
+                return 0;
+            if ((index + count) > nSize)
+                count           = nSize - index;
+
+            const umword_t *w   = &vData[index / UMWORD_BITS];
+            size_t off          = index % UMWORD_BITS;
+
+            for (size_t n = count; n > 0; ++w)
+            {
+                size_t k        = (n > UMWORD_BITS) ? UMWORD_BITS : n;
+                unpack_flags(values, fetch_bits(w, off, k), k);
+                values         += k;
+                n              -= k;
+            }
+
+            return count;
+        }
+
+        size_t bitset::get_packed(size_t index, size_t count, uint8_t *bits) const
+        {
+            if (index >= nSize)
+                return 0;
+            if ((index + count) > nSize)
+                count           = nSize - index;
+
+            const umword_t *w   = &vData[index / UMWORD_BITS];
+            size_t off          = index % UMWORD_BITS;
+
+            for (size_t n = count; n > 0; ++w)
+            {
+                size_t k        = (n > UMWORD_BITS) ? UMWORD_BITS : n;
+                store_packed(bits, fetch_bits(w, off, k), k);
+                bits           += sizeof(umword_t);
+                n              -= k;
+            }
+
+            return count;
+        }
+
         void bitset::set_all()
         {
             if (vData == NULL)
@@ -184,6 +368,11 @@ namespace lsp
         }
 
         size_t bitset::set(size_t index, size_t count, const bool *values)
+        {
+            return set(index, count, reinterpret_cast<const uint8_t *>(values));
+        }
+
+        size_t bitset::set(size_t index, size_t count, const uint8_t *values)
         {
             if (index >= nSize)
                 return 0;
@@ -191,16 +380,35 @@ namespace lsp
                 count           = nSize - index;
 
             umword_t *w     = &vData[index / UMWORD_BITS];
-            umword_t mask   = umword_t(1) << (index % UMWORD_BITS);
+            size_t off      = index % UMWORD_BITS;
 
-            for (size_t i=0; i<count; ++values, ++i)
+            for (size_t n = count; n > 0; ++w)
             {
-                *w              = (*values) ? *w | mask : *w & (~mask);
-                if (!(mask <<= 1))
-                {
-                    ++w;
-                    mask            = 1;
-                }
+                size_t k        = (n > UMWORD_BITS) ? UMWORD_BITS : n;
+                put_bits(w, off, pack_flags(values, k), k);
+                values         += k;
+                n              -= k;
+            }
+
+            return count;
+        }
+
+        size_t bitset::set_packed(size_t index, size_t count, const uint8_t *bits)
+        {
+            if (index >= nSize)
+                return 0;
+            if ((index + count) > nSize)
+                count           = nSize - index;
+
+            umword_t *w     = &vData[index / UMWORD_BITS];
+            size_t off      = index % UMWORD_BITS;
+
+            for (size_t n = count; n > 0; ++w)
+            {
+                size_t k        = (n > UMWORD_BITS) ? UMWORD_BITS : n;
+                put_bits(w, off, load_packed(bits, k), k);
+                bits           += sizeof(umword_t);
+                n              -= k;
             }
 
             return count;
@@ -352,6 +560,48 @@ namespace lsp
             return total;
         }
 
+        ssize_t bitset::next_set(size_t index) const
+        {
+            if (index >= nSize)
+                return -1;
+
+            size_t off      = index / UMWORD_BITS;
+            size_t last     = (nSize + UMWORD_BITS - 1) / UMWORD_BITS;
+            umword_t w      = vData[off] & (UMWORD_MAX << (index % UMWORD_BITS));
+
+            // Skip empty words
+            while (w == 0)
+            {
+                if ((++off) >= last)
+                    return -1;
+                w               = vData[off];
+            }
+
+            index           = off * UMWORD_BITS + __builtin_ctzll((unsigned long long)(w));
+            return (index < nSize) ? index : -1;
+        }
+
+        ssize_t bitset::next_unset(size_t index) const
+        {
+            if (index >= nSize)
+                return -1;
+
+            size_t off      = index / UMWORD_BITS;
+            size_t last     = (nSize + UMWORD_BITS - 1) / UMWORD_BITS;
+            umword_t w      = ~vData[off] & (UMWORD_MAX << (index % UMWORD_BITS));
+
+            // Skip full words
+            while (w == 0)
+            {
+                if ((++off) >= last)
+                    return -1;
+                w               = ~vData[off];
+            }
+
+            index           = off * UMWORD_BITS + __builtin_ctzll((unsigned long long)(w));
+            return (index < nSize) ? index : -1;
+        }
+
         void bitset::swap(bitset *dst)
         {
             lsp::swap(nSize, dst->nSize);
@@ -0,0 +1,717 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/btree.h>
+#include <lsp-plug.in/common/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        const iter_vtbl_t raw_btree::iterator_vtbl =
+        {
+            raw_btree::iter_advance,
+            raw_btree::iter_get,
+            NULL
+        };
+
+        static inline size_t align_node(size_t size)
+        {
+            return (size + raw_btree::NODE_ALIGN - 1) & ~size_t(raw_btree::NODE_ALIGN - 1);
+        }
+
+        void raw_btree::init(size_t ksize, size_t vsize, compare_func_t func)
+        {
+            pRoot       = NULL;
+            pFirst      = NULL;
+            pLast       = NULL;
+            nItems      = 0;
+            nChanges    = 0;
+            nKeySize    = ksize;
+            nValueSize  = vsize;
+            cmp.compare = func;
+
+            // Compute the layout of leaves: header, keys, values
+            size_t space    = NODE_SIZE - NODE_ALIGN - align_node(sizeof(node_t));
+            nLeafCap        = space / (ksize + vsize);
+            if (nLeafCap < MIN_KEYS)
+                nLeafCap        = MIN_KEYS;
+            nKeyOff         = align_node(sizeof(node_t));
+            nValueOff       = align_node(nKeyOff + nLeafCap * ksize);
+            size_t lsize    = nValueOff + nLeafCap * vsize;
+
+            // Compute the layout of inner nodes: header, keys, children
+            nInnerCap       = (space - sizeof(node_t *)) / (ksize + sizeof(node_t *));
+            if (nInnerCap < MIN_KEYS)
+                nInnerCap       = MIN_KEYS;
+            nChildOff       = align_node(nKeyOff + nInnerCap * ksize);
+            size_t isize    = nChildOff + (nInnerCap + 1) * sizeof(node_t *);
+
+            vPool.init((lsize > isize) ? lsize : isize);
+        }
+
+        void raw_btree::flush()
+        {
+            pRoot       = NULL;
+            pFirst      = NULL;
+            pLast       = NULL;
+            nItems      = 0;
+            ++nChanges;
+            vPool.flush();
+        }
+
+        void raw_btree::clear()
+        {
+            free_tree(pRoot);
+            pRoot       = NULL;
+            pFirst      = NULL;
+            pLast       = NULL;
+            nItems      = 0;
+            ++nChanges;
+        }
+
+        void raw_btree::swap(raw_btree *src)
+        {
+            raw_btree tmp   = *this;
+            *this           = *src;
+            *src            = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->nChanges   = nChanges + 1;
+            nChanges        = tmp.nChanges + 1;
+        }
+
+        raw_btree::node_t *raw_btree::alloc_node(bool leaf)
+        {
+            node_t *n       = static_cast<node_t *>(vPool.alloc());
+            if (n == NULL)
+            {
+                // Pool is exhausted, allocate the next chunk
+                if (!vPool.prefill(1))
+                    return NULL;
+                if ((n = static_cast<node_t *>(vPool.alloc())) == NULL)
+                    return NULL;
+            }
+
+            n->pNext        = NULL;
+            n->pPrev        = NULL;
+            n->nCount       = 0;
+            n->bLeaf        = leaf;
+
+            return n;
+        }
+
+        void raw_btree::free_node(node_t *n)
+        {
+            vPool.free(n);
+        }
+
+        void raw_btree::free_tree(node_t *n)
+        {
+            if (n == NULL)
+                return;
+            if (!n->bLeaf)
+            {
+                node_t **c      = children(n);
+                for (size_t i=0; i<=n->nCount; ++i)
+                    free_tree(c[i]);
+            }
+            free_node(n);
+        }
+
+        size_t raw_btree::lower_bound(node_t *n, const void *k)
+        {
+            // Find the first key which is not less than k
+            ssize_t first = 0, last = n->nCount;
+            while (first < last)
+            {
+                ssize_t mid     = (first + last) >> 1;
+                if (cmp.compare(key(n, mid), k, nKeySize) < 0)
+                    first           = mid + 1;
+                else
+                    last            = mid;
+            }
+            return first;
+        }
+
+        size_t raw_btree::upper_bound(node_t *n, const void *k)
+        {
+            // Find the first key which is greater than k
+            ssize_t first = 0, last = n->nCount;
+            while (first < last)
+            {
+                ssize_t mid     = (first + last) >> 1;
+                if (cmp.compare(k, key(n, mid), nKeySize) >= 0)
+                    first           = mid + 1;
+                else
+                    last            = mid;
+            }
+            return first;
+        }
+
+        raw_btree::node_t *raw_btree::find_leaf(const void *k)
+        {
+            node_t *n       = pRoot;
+            if (n == NULL)
+                return NULL;
+
+            while (!n->bLeaf)
+                n               = children(n)[upper_bound(n, k)];
+            return n;
+        }
+
+        bool raw_btree::split_child(node_t *p, size_t idx)
+        {
+            node_t **pc     = children(p);
+            node_t *c       = pc[idx];
+            node_t *r       = alloc_node(c->bLeaf);
+            if (r == NULL)
+                return false;
+
+            size_t count    = c->nCount;
+            size_t mid      = count >> 1;
+            const uint8_t *sep;
+
+            if (c->bLeaf)
+            {
+                // Move upper half of items to the new leaf, the separator is the first key of it
+                r->nCount       = count - mid;
+                ::memcpy(key(r, 0), key(c, mid), r->nCount * nKeySize);
+                ::memcpy(value(r, 0), value(c, mid), r->nCount * nValueSize);
+                sep             = key(r, 0);
+
+                r->pNext        = c->pNext;
+                r->pPrev        = c;
+                if (c->pNext != NULL)
+                    c->pNext->pPrev = r;
+                else
+                    pLast           = r;
+                c->pNext        = r;
+            }
+            else
+            {
+                // Move upper half of keys and children to the new node, the middle key goes up
+                r->nCount       = count - mid - 1;
+                ::memcpy(key(r, 0), key(c, mid + 1), r->nCount * nKeySize);
+                ::memcpy(children(r), &children(c)[mid + 1], (r->nCount + 1) * sizeof(node_t *));
+                sep             = key(c, mid);
+            }
+            c->nCount       = mid;
+
+            // Insert separator and the new node to the parent
+            size_t pcount   = p->nCount;
+            ::memmove(key(p, idx + 1), key(p, idx), (pcount - idx) * nKeySize);
+            ::memmove(&pc[idx + 2], &pc[idx + 1], (pcount - idx) * sizeof(node_t *));
+            ::memcpy(key(p, idx), sep, nKeySize);
+            pc[idx + 1]     = r;
+            ++p->nCount;
+
+            return true;
+        }
+
+        void raw_btree::borrow_left(node_t *p, size_t idx)
+        {
+            node_t **pc     = children(p);
+            node_t *l       = pc[idx - 1];
+            node_t *c       = pc[idx];
+
+            if (c->bLeaf)
+            {
+                ::memmove(key(c, 1), key(c, 0), c->nCount * nKeySize);
+                ::memmove(value(c, 1), value(c, 0), c->nCount * nValueSize);
+                ::memcpy(key(c, 0), key(l, l->nCount - 1), nKeySize);
+                ::memcpy(value(c, 0), value(l, l->nCount - 1), nValueSize);
+                ::memcpy(key(p, idx - 1), key(c, 0), nKeySize);
+            }
+            else
+            {
+                node_t **cc     = children(c);
+                ::memmove(key(c, 1), key(c, 0), c->nCount * nKeySize);
+                ::memmove(&cc[1], &cc[0], (c->nCount + 1) * sizeof(node_t *));
+                ::memcpy(key(c, 0), key(p, idx - 1), nKeySize);
+                cc[0]           = children(l)[l->nCount];
+                ::memcpy(key(p, idx - 1), key(l, l->nCount - 1), nKeySize);
+            }
+
+            --l->nCount;
+            ++c->nCount;
+        }
+
+        void raw_btree::borrow_right(node_t *p, size_t idx)
+        {
+            node_t **pc     = children(p);
+            node_t *c       = pc[idx];
+            node_t *r       = pc[idx + 1];
+
+            if (c->bLeaf)
+            {
+                ::memcpy(key(c, c->nCount), key(r, 0), nKeySize);
+                ::memcpy(value(c, c->nCount), value(r, 0), nValueSize);
+                ::memmove(key(r, 0), key(r, 1), (r->nCount - 1) * nKeySize);
+                ::memmove(value(r, 0), value(r, 1), (r->nCount - 1) * nValueSize);
+                ::memcpy(key(p, idx), key(r, 0), nKeySize);
+            }
+            else
+            {
+                node_t **rc     = children(r);
+                ::memcpy(key(c, c->nCount), key(p, idx), nKeySize);
+                children(c)[c->nCount + 1]  = rc[0];
+                ::memcpy(key(p, idx), key(r, 0), nKeySize);
+                ::memmove(key(r, 0), key(r, 1), (r->nCount - 1) * nKeySize);
+                ::memmove(&rc[0], &rc[1], r->nCount * sizeof(node_t *));
+            }
+
+            ++c->nCount;
+            --r->nCount;
+        }
+
+        void raw_btree::merge_children(node_t *p, size_t idx)
+        {
+            node_t **pc     = children(p);
+            node_t *l       = pc[idx];
+            node_t *r       = pc[idx + 1];
+
+            if (l->bLeaf)
+            {
+                ::memcpy(key(l, l->nCount), key(r, 0), r->nCount * nKeySize);
+                ::memcpy(value(l, l->nCount), value(r, 0), r->nCount * nValueSize);
+                l->nCount      += r->nCount;
+
+                l->pNext        = r->pNext;
+                if (r->pNext != NULL)
+                    r->pNext->pPrev = l;
+                else
+                    pLast           = l;
+            }
+            else
+            {
+                // The separator goes down between keys of merged nodes
+                ::memcpy(key(l, l->nCount), key(p, idx), nKeySize);
+                ::memcpy(key(l, l->nCount + 1), key(r, 0), r->nCount * nKeySize);
+                ::memcpy(&children(l)[l->nCount + 1], children(r), (r->nCount + 1) * sizeof(node_t *));
+                l->nCount      += r->nCount + 1;
+            }
+
+            // Remove the separator and the right node from the parent
+            size_t pcount   = p->nCount;
+            ::memmove(key(p, idx), key(p, idx + 1), (pcount - idx - 1) * nKeySize);
+            ::memmove(&pc[idx + 1], &pc[idx + 2], (pcount - idx - 1) * sizeof(node_t *));
+            --p->nCount;
+
+            free_node(r);
+        }
+
+        size_t raw_btree::fix_child(node_t *p, size_t idx)
+        {
+            node_t **pc     = children(p);
+            ++nChanges;
+
+            if ((idx > 0) && (pc[idx - 1]->nCount > min_count(pc[idx - 1])))
+            {
+                borrow_left(p, idx);
+                return idx;
+            }
+            if ((idx < p->nCount) && (pc[idx + 1]->nCount > min_count(pc[idx + 1])))
+            {
+                borrow_right(p, idx);
+                return idx;
+            }
+            if (idx > 0)
+            {
+                merge_children(p, idx - 1);
+                return idx - 1;
+            }
+
+            merge_children(p, idx);
+            return idx;
+        }
+
+        uint8_t *raw_btree::get(const void *k)
+        {
+            node_t *n       = find_leaf(k);
+            if (n == NULL)
+                return NULL;
+
+            size_t idx      = lower_bound(n, k);
+            if ((idx >= n->nCount) || (cmp.compare(key(n, idx), k, nKeySize) != 0))
+                return NULL;
+            return value(n, idx);
+        }
+
+        uint8_t *raw_btree::put(const void *k, const void *v, put_mode_t mode)
+        {
+            // Create root or grow the tree if the root is full
+            if (pRoot == NULL)
+            {
+                if ((pRoot = alloc_node(true)) == NULL)
+                    return NULL;
+                pFirst          = pRoot;
+                pLast           = pRoot;
+            }
+            else if (pRoot->nCount >= max_count(pRoot))
+            {
+                node_t *root    = alloc_node(false);
+                if (root == NULL)
+                    return NULL;
+                children(root)[0]   = pRoot;
+                if (!split_child(root, 0))
+                {
+                    free_node(root);
+                    return NULL;
+                }
+                pRoot           = root;
+                ++nChanges;
+            }
+
+            // Go down and split full children, so the parent always has space for the separator
+            node_t *n       = pRoot;
+            while (!n->bLeaf)
+            {
+                size_t idx      = upper_bound(n, k);
+                node_t *c       = children(n)[idx];
+                if (c->nCount >= max_count(c))
+                {
+                    if (!split_child(n, idx))
+                        return NULL;
+                    ++nChanges;
+                    if (cmp.compare(k, key(n, idx), nKeySize) >= 0)
+                        ++idx;
+                }
+                n               = children(n)[idx];
+            }
+
+            // Insert or replace item in the leaf
+            size_t idx      = lower_bound(n, k);
+            uint8_t *dst    = value(n, idx);
+            if ((idx < n->nCount) && (cmp.compare(key(n, idx), k, nKeySize) == 0))
+            {
+                if (mode == PUT_CREATE)
+                    return NULL;
+            }
+            else
+            {
+                ::memmove(key(n, idx + 1), key(n, idx), (n->nCount - idx) * nKeySize);
+                ::memmove(value(n, idx + 1), dst, (n->nCount - idx) * nValueSize);
+                ::memcpy(key(n, idx), k, nKeySize);
+                ++n->nCount;
+                ++nItems;
+                ++nChanges;
+            }
+
+            if (v != NULL)
+                ::memcpy(dst, v, nValueSize);
+            return dst;
+        }
+
+        uint8_t *raw_btree::replace(const void *k, const void *v)
+        {
+            uint8_t *dst    = get(k);
+            if ((dst != NULL) && (v != NULL))
+                ::memcpy(dst, v, nValueSize);
+            return dst;
+        }
+
+        bool raw_btree::remove(const void *k, void *v)
+        {
+            node_t *n       = pRoot;
+            if (n == NULL)
+                return false;
+
+            // Go down and refill children with minimum number of keys,
+            // so removal from the leaf does not break the tree
+            while (!n->bLeaf)
+            {
+                size_t idx      = upper_bound(n, k);
+                if (children(n)[idx]->nCount <= min_count(children(n)[idx]))
+                {
+                    idx             = fix_child(n, idx);
+
+                    // The root has lost the last key after merge, the tree becomes lower
+                    if (n->nCount <= 0)
+                    {
+                        pRoot           = children(n)[0];
+                        free_node(n);
+                        n               = pRoot;
+                        continue;
+                    }
+                }
+                n               = children(n)[idx];
+            }
+
+            size_t idx      = lower_bound(n, k);
+            if ((idx >= n->nCount) || (cmp.compare(key(n, idx), k, nKeySize) != 0))
+                return false;
+
+            // Remove item from the leaf
+            if (v != NULL)
+                ::memcpy(v, value(n, idx), nValueSize);
+            ::memmove(key(n, idx), key(n, idx + 1), (n->nCount - idx - 1) * nKeySize);
+            ::memmove(value(n, idx), value(n, idx + 1), (n->nCount - idx - 1) * nValueSize);
+            --n->nCount;
+            --nItems;
+            ++nChanges;
+
+            if (nItems <= 0)
+            {
+                free_node(pRoot);
+                pRoot           = NULL;
+                pFirst          = NULL;
+                pLast           = NULL;
+            }
+
+            return true;
+        }
+
+        bool raw_btree::load(size_t n, const void *k, const void *v)
+        {
+            const uint8_t *keys     = static_cast<const uint8_t *>(k);
+            const uint8_t *values   = static_cast<const uint8_t *>(v);
+
+            // Validate the order of keys
+            for (size_t i=1; i<n; ++i)
+                if (cmp.compare(&keys[(i-1) * nKeySize], &keys[i * nKeySize], nKeySize) >= 0)
+                    return false;
+
+            clear();
+            if (n <= 0)
+                return true;
+
+            // Temporary arrays of nodes and their minimum keys for the current level
+            size_t count    = (n + nLeafCap - 1) / nLeafCap;
+            uint8_t *buf    = static_cast<uint8_t *>(::malloc(count * (sizeof(node_t *) + sizeof(uint8_t *))));
+            if (buf == NULL)
+                return false;
+            node_t **nodes          = reinterpret_cast<node_t **>(buf);
+            const uint8_t **mins    = reinterpret_cast<const uint8_t **>(&buf[count * sizeof(node_t *)]);
+
+            // Build leaves, items are distributed evenly
+            node_t *prev    = NULL;
+            for (size_t i=0, off=0; i<count; ++i)
+            {
+                node_t *leaf    = alloc_node(true);
+                if (leaf == NULL)
+                {
+                    for (size_t j=0; j<i; ++j)
+                        free_node(nodes[j]);
+                    pFirst          = NULL;
+                    ::free(buf);
+                    return false;
+                }
+
+                size_t items    = (n - off) / (count - i);
+                ::memcpy(key(leaf, 0), &keys[off * nKeySize], items * nKeySize);
+                if (values != NULL)
+                    ::memcpy(value(leaf, 0), &values[off * nValueSize], items * nValueSize);
+                leaf->nCount    = items;
+                leaf->pPrev     = prev;
+                if (prev != NULL)
+                    prev->pNext     = leaf;
+                else
+                    pFirst          = leaf;
+
+                nodes[i]        = leaf;
+                mins[i]         = key(leaf, 0);
+                prev            = leaf;
+                off            += items;
+            }
+            pLast           = prev;
+            nItems          = n;
+
+            // Build upper levels in place, each node takes the group of children
+            while (count > 1)
+            {
+                size_t groups   = (count + nInnerCap) / (nInnerCap + 1);
+                for (size_t i=0, off=0; i<groups; ++i)
+                {
+                    node_t *node    = alloc_node(false);
+                    if (node == NULL)
+                    {
+                        // Drop new nodes with their subtrees and nodes which are not attached yet
+                        for (size_t j=0; j<i; ++j)
+                            free_tree(nodes[j]);
+                        for (size_t j=off; j<count; ++j)
+                            free_tree(nodes[j]);
+                        pRoot           = NULL;
+                        pFirst          = NULL;
+                        pLast           = NULL;
+                        nItems          = 0;
+                        ::free(buf);
+                        return false;
+                    }
+
+                    size_t items    = (count - off) / (groups - i);
+                    node_t **c      = children(node);
+                    for (size_t j=0; j<items; ++j)
+                    {
+                        c[j]            = nodes[off + j];
+                        if (j > 0)
+                            ::memcpy(key(node, j - 1), mins[off + j], nKeySize);
+                    }
+                    node->nCount    = items - 1;
+
+                    nodes[i]        = node;
+                    mins[i]         = mins[off];
+                    off            += items;
+                }
+                count           = groups;
+            }
+
+            pRoot           = nodes[0];
+            ::free(buf);
+            ++nChanges;
+
+            return true;
+        }
+
+        raw_iterator raw_btree::make_iter(node_t *n, size_t idx, node_t *end, size_t end_idx)
+        {
+            // Normalize positions to point at existing items
+            if ((n != NULL) && (idx >= n->nCount))
+            {
+                n               = n->pNext;
+                idx             = 0;
+            }
+            if ((end != NULL) && (end_idx >= end->nCount))
+            {
+                end             = end->pNext;
+                end_idx         = 0;
+            }
+
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &nChanges;
+            it.change       = nChanges;
+            it.index        = idx;
+            it.limit        = (end != NULL) ? reinterpret_cast<uintptr_t>(key(end, end_idx)) : 0;
+            it.item         = ((n != NULL) && ((end != n) || (end_idx != idx))) ? n : NULL;
+            return it;
+        }
+
+        void raw_btree::iter_advance(raw_iterator *i, size_t n)
+        {
+            raw_btree *self     = static_cast<raw_btree *>(i->container);
+            node_t *node        = static_cast<node_t *>(i->item);
+            size_t from         = i->index + 1;
+            size_t target       = i->index + n;
+
+            // Fast path: step to the next item within the same leaf
+            if ((n == 1) && (target < node->nCount) && (i->limit != reinterpret_cast<uintptr_t>(self->key(node, target))))
+            {
+                i->index            = target;
+                return;
+            }
+
+            while (true)
+            {
+                // Check that the end of range is reached within the current leaf
+                if (i->limit != 0)
+                {
+                    uintptr_t first     = reinterpret_cast<uintptr_t>(self->key(node, 0));
+                    if ((i->limit >= first) && (i->limit < first + node->nCount * self->nKeySize))
+                    {
+                        size_t end          = (i->limit - first) / self->nKeySize;
+                        if ((end >= from) && (end <= target))
+                        {
+                            i->item             = NULL;
+                            return;
+                        }
+                    }
+                }
+
+                if (target < node->nCount)
+                    break;
+
+                // Move to the next leaf
+                target             -= node->nCount;
+                from                = 0;
+                node                = node->pNext;
+                if (node == NULL)
+                {
+                    i->item             = NULL;
+                    return;
+                }
+            }
+
+            i->item             = node;
+            i->index            = target;
+        }
+
+        void *raw_btree::iter_get(const raw_iterator *i)
+        {
+            const raw_btree *self   = static_cast<const raw_btree *>(i->container);
+            return self->value(static_cast<node_t *>(i->item), i->index);
+        }
+
+        uint8_t *raw_btree::iter_key(const raw_iterator *i)
+        {
+            const raw_btree *self   = static_cast<const raw_btree *>(i->container);
+            return self->key(static_cast<node_t *>(i->item), i->index);
+        }
+
+        raw_iterator raw_btree::iter()
+        {
+            return make_iter(pFirst, 0, NULL, 0);
+        }
+
+        raw_iterator raw_btree::lower_bound(const void *k)
+        {
+            node_t *n       = find_leaf(k);
+            return make_iter(n, (n != NULL) ? lower_bound(n, k) : 0, NULL, 0);
+        }
+
+        raw_iterator raw_btree::upper_bound(const void *k)
+        {
+            node_t *n       = find_leaf(k);
+            return make_iter(n, (n != NULL) ? upper_bound(n, k) : 0, NULL, 0);
+        }
+
+        raw_iterator raw_btree::floor(const void *k)
+        {
+            node_t *n       = find_leaf(k);
+            size_t idx      = 0;
+
+            // Step back from the first key greater than k
+            if (n != NULL)
+            {
+                idx             = upper_bound(n, k);
+                if (idx > 0)
+                    --idx;
+                else if ((n = n->pPrev) != NULL)
+                    idx             = n->nCount - 1;
+            }
+
+            return make_iter(n, idx, NULL, 0);
+        }
+
+        raw_iterator raw_btree::range(const void *first, const void *last)
+        {
+            node_t *n       = find_leaf(first);
+            if ((n == NULL) || (cmp.compare(first, last, nKeySize) >= 0))
+                return make_iter(NULL, 0, NULL, 0);
+
+            node_t *end     = find_leaf(last);
+            return make_iter(n, lower_bound(n, first), end, lower_bound(end, last));
+        }
+    }
+}
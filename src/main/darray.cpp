@@ -20,7 +20,9 @@
  */
 
 #include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/search.h>
 #include <lsp-plug.in/stdlib/stdlib.h>
+#include <lsp-plug.in/common/types.h>
 
 namespace lsp
 {
@@ -28,12 +30,76 @@ namespace lsp
     {
         inline size_t nonzero(size_t count, size_t n) { return ((count + n) > 0) ? n : 1; }
 
+        const iter_vtbl_t raw_darray::iterator_vtbl =
+        {
+            raw_darray::iter_advance,
+            raw_darray::iter_get,
+            raw_darray::iter_remove
+        };
+
         void raw_darray::init(size_t n_sizeof)
         {
             nItems      = 0;
             vItems      = NULL;
             nCapacity   = 0;
             nSizeOf     = n_sizeof;
+            nChanges    = 0;
+            nAlign      = 0;
+        }
+
+        void raw_darray::init(size_t n_sizeof, size_t align)
+        {
+            init(n_sizeof);
+            set_alignment(align);
+        }
+
+        uint8_t *raw_darray::alloc_data(size_t capacity) const
+        {
+            if (nAlign <= 0)
+                return static_cast<uint8_t *>(::malloc(nSizeOf * capacity));
+
+            // Over-allocate and keep pointer to the allocated block just before the aligned data
+            uint8_t *ptr    = static_cast<uint8_t *>(::malloc(nSizeOf * capacity + nAlign));
+            if (ptr == NULL)
+                return NULL;
+            uint8_t *data   = reinterpret_cast<uint8_t *>((reinterpret_cast<uintptr_t>(ptr) + nAlign) & (~uintptr_t(nAlign - 1)));
+            reinterpret_cast<uint8_t **>(data)[-1]  = ptr;
+
+            return data;
+        }
+
+        void raw_darray::free_data(uint8_t *ptr) const
+        {
+            if (ptr == NULL)
+                return;
+            ::free((nAlign > 0) ? reinterpret_cast<uint8_t **>(ptr)[-1] : ptr);
+        }
+
+        bool raw_darray::reallocate(size_t capacity)
+        {
+            uint8_t *ptr;
+            if (nAlign <= 0)
+            {
+                ptr             = reinterpret_cast<uint8_t *>(::realloc(vItems, nSizeOf * capacity));
+                if (ptr == NULL)
+                    return false;
+            }
+            else
+            {
+                // Aligned storage can not be reallocated in place, copy only existing items
+                ptr             = alloc_data(capacity);
+                if (ptr == NULL)
+                    return false;
+                if (vItems != NULL)
+                {
+                    ::memcpy(ptr, vItems, nSizeOf * ((nItems < capacity) ? nItems : capacity));
+                    free_data(vItems);
+                }
+            }
+
+            vItems          = ptr;
+            nCapacity       = capacity;
+            return true;
         }
 
         bool raw_darray::grow(size_t capacity)
@@ -42,13 +108,10 @@ namespace lsp
                 capacity        = 32;
 
             // Do aligned (re)allocation
-            uint8_t *ptr    = reinterpret_cast<uint8_t *>(::realloc(vItems, nSizeOf * capacity));
-            if (ptr == NULL)
+            if (!reallocate(capacity))
                 return false;
 
-            // Update pointer and capacity
-            vItems          = ptr;
-            nCapacity       = capacity;
+            ++nChanges;
             return true;
         }
 
@@ -67,15 +130,13 @@ namespace lsp
                 return true;
 
             // Do aligned (re)allocation
-            uint8_t *ptr    = reinterpret_cast<uint8_t *>(::realloc(vItems, nSizeOf * capacity));
-            if (ptr == NULL)
+            if (!reallocate(capacity))
                 return false;
 
-            // Update pointer, capacity and size
-            vItems          = ptr;
-            nCapacity       = capacity;
+            // Update size
             if (nItems > capacity)
                 nItems          = capacity;
+            ++nChanges;
             return true;
         }
 
@@ -148,6 +209,7 @@ namespace lsp
 
             uint8_t *ptr    = &vItems[nItems * nSizeOf];
             nItems         += n;
+            ++nChanges;
             return ptr;
         }
 
@@ -165,6 +227,7 @@ namespace lsp
             uint8_t *ptr    = &vItems[nItems * nSizeOf];
             ::memcpy(ptr, src, n * nSizeOf);
             nItems         += n;
+            ++nChanges;
             return ptr;
         }
 
@@ -184,6 +247,7 @@ namespace lsp
 
             ::memcpy(vItems, src, n * nSizeOf);
             nItems          = n;
+            ++nChanges;
             return vItems;
         }
 
@@ -214,6 +278,7 @@ namespace lsp
             if (index < nItems)
                 ::memmove(&res[n*nSizeOf], res, (nItems - index) * nSizeOf);
             nItems         += n;
+            ++nChanges;
             return res;
         }
 
@@ -236,6 +301,7 @@ namespace lsp
             ::memcpy(res, src, n * nSizeOf);
 
             nItems         += n;
+            ++nChanges;
             return res;
         }
 
@@ -245,17 +311,69 @@ namespace lsp
             tmp     = *this;
             *this   = *src;
             *src    = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->nChanges   = nChanges + 1;
+            nChanges        = tmp.nChanges + 1;
         }
 
         void raw_darray::flush()
         {
             if (vItems != NULL)
             {
-                ::free(vItems);
+                free_data(vItems);
                 vItems      = NULL;
             }
             nCapacity   = 0;
             nItems      = 0;
+            ++nChanges;
+        }
+
+        uint8_t *raw_darray::release()
+        {
+            uint8_t *ptr    = vItems;
+
+            // Aligned storage can not be passed to free(), move data to the beginning of the block
+            if ((nAlign > 0) && (ptr != NULL))
+            {
+                ptr             = reinterpret_cast<uint8_t **>(vItems)[-1];
+                ::memmove(ptr, vItems, nItems * nSizeOf);
+            }
+
+            nItems          = 0;
+            vItems          = NULL;
+            nCapacity       = 0;
+            ++nChanges;
+            return ptr;
+        }
+
+        bool raw_darray::set_alignment(size_t align)
+        {
+            // Round alignment up to the power of two
+            size_t a        = 0;
+            if (align > MALLOC_ALIGN)
+            {
+                a               = MALLOC_ALIGN;
+                while (a < align)
+                    a             <<= 1;
+            }
+            if (a == nAlign)
+                return true;
+
+            // Move data to the storage with new alignment
+            raw_darray tmp  = *this;
+            tmp.vItems      = NULL;
+            tmp.nAlign      = a;
+            if ((vItems != NULL) && (!tmp.reallocate(nCapacity)))
+                return false;
+            if (vItems != NULL)
+                ::memcpy(tmp.vItems, vItems, nItems * nSizeOf);
+
+            free_data(vItems);
+            vItems          = tmp.vItems;
+            nAlign          = a;
+            ++nChanges;
+            return true;
         }
 
         ssize_t raw_darray::index_of(const void *ptr)
@@ -289,6 +407,7 @@ namespace lsp
             if (last < nItems)
                 ::memmove(src, &vItems[last * nSizeOf], (nItems - last) * nSizeOf);
             nItems     -= n;
+            ++nChanges;
             return true;
         }
 
@@ -311,6 +430,7 @@ namespace lsp
             if (last < cap)
                 ::memmove(src, &vItems[last], cap - last);
             nItems     -= n;
+            ++nChanges;
             return static_cast<uint8_t *>(dst);
         }
 
@@ -333,6 +453,7 @@ namespace lsp
                 if (last < nItems)
                     ::memmove(src, &vItems[last * nSizeOf], (nItems - last) * nSizeOf);
                 nItems     -= n;
+                ++nChanges;
             }
             return res;
         }
@@ -345,6 +466,7 @@ namespace lsp
             if (last < nItems)
                 ::memmove(&vItems[idx * nSizeOf], &vItems[last * nSizeOf], (nItems - last) * nSizeOf);
             nItems     -= n;
+            ++nChanges;
             return true;
         }
 
@@ -359,6 +481,7 @@ namespace lsp
             if (last < nItems)
                 ::memmove(src, &vItems[last * nSizeOf], (nItems - last) * nSizeOf);
             nItems     -= n;
+            ++nChanges;
             return static_cast<uint8_t *>(dst);
         }
 
@@ -375,6 +498,7 @@ namespace lsp
                 if (last < nItems)
                     ::memmove(src, &vItems[last * nSizeOf], (nItems - last) * nSizeOf);
                 nItems     -= n;
+                ++nChanges;
             }
             return res;
         }
@@ -385,6 +509,7 @@ namespace lsp
                 return NULL;
 
             nItems -= n;
+            ++nChanges;
             return &vItems[nItems * nSizeOf];
         }
 
@@ -394,6 +519,7 @@ namespace lsp
                 return NULL;
 
             nItems         -= n;
+            ++nChanges;
             size_t size     = nItems * nSizeOf;
             uint8_t *src    = &vItems[size];
             ::memcpy(dst, src, n * nSizeOf);
@@ -409,11 +535,98 @@ namespace lsp
             size_t size     = nItems - n;
             uint8_t *res    = cs->append(n, &vItems[size * nSizeOf]);
             if (res)
+            {
                 nItems          = size;
+                ++nChanges;
+            }
 
             return res;
         }
 
+        ssize_t raw_darray::find(const void *value, size_t first)
+        {
+            if (first >= nItems)
+                return -1;
+
+            ssize_t idx;
+            switch (nSizeOf)
+            {
+                case sizeof(uint32_t):
+                {
+                    uint32_t x;
+                    ::memcpy(&x, value, sizeof(x));
+                    idx = find_u32(&reinterpret_cast<const uint32_t *>(vItems)[first], nItems - first, x);
+                    break;
+                }
+                case sizeof(uint64_t):
+                {
+                    uint64_t x;
+                    ::memcpy(&x, value, sizeof(x));
+                    idx = find_u64(&reinterpret_cast<const uint64_t *>(vItems)[first], nItems - first, x);
+                    break;
+                }
+                default:
+                    for (size_t i=first; i<nItems; ++i)
+                        if (!::memcmp(&vItems[i * nSizeOf], value, nSizeOf))
+                            return i;
+                    return -1;
+            }
+
+            return (idx >= 0) ? idx + first : -1;
+        }
+
+        ssize_t raw_darray::find(const void *value, size_t first, sort_closure_t *c)
+        {
+            for (size_t i=first; i<nItems; ++i)
+                if (c->compare(&vItems[i * nSizeOf], value, c->size) == 0)
+                    return i;
+            return -1;
+        }
+
+        ssize_t raw_darray::find_if(pred_func_t f, void *arg, size_t first)
+        {
+            for (size_t i=first; i<nItems; ++i)
+                if (f(&vItems[i * nSizeOf], arg))
+                    return i;
+            return -1;
+        }
+
+        size_t raw_darray::count(const void *value)
+        {
+            switch (nSizeOf)
+            {
+                case sizeof(uint32_t):
+                {
+                    uint32_t x;
+                    ::memcpy(&x, value, sizeof(x));
+                    return count_u32(reinterpret_cast<const uint32_t *>(vItems), nItems, x);
+                }
+                case sizeof(uint64_t):
+                {
+                    uint64_t x;
+                    ::memcpy(&x, value, sizeof(x));
+                    return count_u64(reinterpret_cast<const uint64_t *>(vItems), nItems, x);
+                }
+                default:
+                    break;
+            }
+
+            size_t n = 0;
+            for (size_t i=0; i<nItems; ++i)
+                if (!::memcmp(&vItems[i * nSizeOf], value, nSizeOf))
+                    ++n;
+            return n;
+        }
+
+        size_t raw_darray::count(const void *value, sort_closure_t *c)
+        {
+            size_t n = 0;
+            for (size_t i=0; i<nItems; ++i)
+                if (c->compare(&vItems[i * nSizeOf], value, c->size) == 0)
+                    ++n;
+            return n;
+        }
+
         int raw_darray::closure_cmp(const void *a, const void *b, void *c)
         {
             sort_closure_t *sc = static_cast<sort_closure_t *>(c);
@@ -431,6 +644,7 @@ namespace lsp
         void raw_darray::qsort(sort_closure_t *c)
         {
             lsp::qsort_r(vItems, nItems, nSizeOf, closure_cmp, c);
+            ++nChanges;
         }
 
         void raw_darray::qsort(cmp_func_t f)
@@ -442,6 +656,179 @@ namespace lsp
             } xf;
             xf.f = f;
             lsp::qsort_r(vItems, nItems, nSizeOf, raw_cmp, xf.p);
+            ++nChanges;
+        }
+
+        void raw_darray::psort(sort_closure_t *c, size_t threads, size_t cutoff)
+        {
+            parallel_sort(vItems, nItems, nSizeOf, closure_cmp, c, threads, cutoff);
+            ++nChanges;
+        }
+
+        void raw_darray::psort(cmp_func_t f, size_t threads, size_t cutoff)
+        {
+            union
+            {
+                cmp_func_t f;
+                void *p;
+            } xf;
+            xf.f = f;
+            parallel_sort(vItems, nItems, nSizeOf, raw_cmp, xf.p, threads, cutoff);
+            ++nChanges;
+        }
+
+        /**
+         * Get the digit of the key mapped to the unsigned order
+         * @param k pointer to the key
+         * @param d index of the digit, starting with the least significant one
+         * @param width width of the key in bytes
+         * @param key type of the key
+         * @return digit of the key
+         */
+        static inline size_t radix_digit(const uint8_t *k, size_t d, size_t width, radix_key_t key)
+        {
+        #ifdef ARCH_LE
+            size_t b        = k[d];
+            size_t msb      = k[width - 1];
+        #else
+            size_t b        = k[width - 1 - d];
+            size_t msb      = k[0];
+        #endif /* ARCH_LE */
+            size_t mask     = (d == width - 1) ? 0x80 : 0x00;
+
+            switch (key)
+            {
+                case RADIX_SIGNED:
+                    return b ^ mask;
+                case RADIX_FLOAT:
+                    // Negative numbers are inverted, positive numbers get the sign bit set
+                    return b ^ ((msb & 0x80) ? 0xff : mask);
+                default:
+                    break;
+            }
+
+            return b;
+        }
+
+        static inline void radix_copy(uint8_t *dst, const uint8_t *src, size_t size)
+        {
+            switch (size)
+            {
+                case sizeof(uint32_t): *reinterpret_cast<uint32_t *>(dst) = *reinterpret_cast<const uint32_t *>(src); break;
+                case sizeof(uint64_t): *reinterpret_cast<uint64_t *>(dst) = *reinterpret_cast<const uint64_t *>(src); break;
+                default: ::memcpy(dst, src, size); break;
+            }
+        }
+
+        bool raw_darray::radix_sort(size_t offset, size_t width, radix_key_t key)
+        {
+            // Validate key
+            if ((width != 1) && (width != 2) && (width != 4) && (width != 8))
+                return false;
+            if ((offset + width > nSizeOf) || ((key == RADIX_FLOAT) && (width < 4)))
+                return false;
+            if (nItems <= 1)
+                return true;
+
+            // Allocate histograms and scratch buffer of the same capacity
+            size_t *counts  = static_cast<size_t *>(::malloc(width * 0x100 * sizeof(size_t)));
+            if (counts == NULL)
+                return false;
+            uint8_t *buf    = alloc_data(nCapacity);
+            if (buf == NULL)
+            {
+                ::free(counts);
+                return false;
+            }
+
+            // Build histograms of all digits with single pass
+            ::memset(counts, 0, width * 0x100 * sizeof(size_t));
+            for (size_t i=0; i<nItems; ++i)
+            {
+                const uint8_t *k    = &vItems[i * nSizeOf + offset];
+                for (size_t d=0; d<width; ++d)
+                    ++counts[(d << 8) + radix_digit(k, d, width, key)];
+            }
+
+            // Distribute elements starting with the least significant digit
+            uint8_t *src    = vItems;
+            uint8_t *dst    = buf;
+            for (size_t d=0; d<width; ++d)
+            {
+                size_t *c       = &counts[d << 8];
+
+                // Skip the digit if it is the same for all keys
+                if (c[radix_digit(&src[offset], d, width, key)] == nItems)
+                    continue;
+
+                for (size_t i=0, sum=0; i<0x100; ++i)
+                {
+                    size_t n        = c[i];
+                    c[i]            = sum;
+                    sum            += n;
+                }
+
+                for (size_t i=0; i<nItems; ++i)
+                {
+                    const uint8_t *p    = &src[i * nSizeOf];
+                    size_t pos          = c[radix_digit(&p[offset], d, width, key)]++;
+                    radix_copy(&dst[pos * nSizeOf], p, nSizeOf);
+                }
+
+                uint8_t *tmp    = src;
+                src             = dst;
+                dst             = tmp;
+            }
+
+            // Keep the buffer which contains the sorted data
+            free_data(dst);
+            vItems          = src;
+            ::free(counts);
+            ++nChanges;
+
+            return true;
+        }
+
+        raw_iterator raw_darray::iter()
+        {
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &nChanges;
+            it.change       = nChanges;
+            it.index        = 0;
+            it.limit        = 0;
+            it.item         = (nItems > 0) ? vItems : NULL;
+            return it;
+        }
+
+        void raw_darray::iter_advance(raw_iterator *i, size_t n)
+        {
+            raw_darray *self    = static_cast<raw_darray *>(i->container);
+            size_t left         = self->nItems - i->index;
+            if (n >= left)
+            {
+                i->index            = self->nItems;
+                i->item             = NULL;
+                return;
+            }
+
+            i->index           += n;
+            i->item             = &self->vItems[i->index * self->nSizeOf];
+        }
+
+        void *raw_darray::iter_get(const raw_iterator *i)
+        {
+            return i->item;
+        }
+
+        void raw_darray::iter_remove(raw_iterator *i)
+        {
+            raw_darray *self    = static_cast<raw_darray *>(i->container);
+            self->iremove(i->index, 1);
+
+            i->change           = self->nChanges;
+            i->item             = (i->index < self->nItems) ? &self->vItems[i->index * self->nSizeOf] : NULL;
         }
     }
 }
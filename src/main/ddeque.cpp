@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/ddeque.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_ddeque::init(size_t n_sizeof)
+        {
+            vItems      = NULL;
+            nHead       = 0;
+            nItems      = 0;
+            nCapacity   = 0;
+            nSizeOf     = n_sizeof;
+            nChanges    = 0;
+        }
+
+        bool raw_ddeque::grow(size_t capacity)
+        {
+            if (capacity <= nCapacity)
+                return true;
+
+            // Round capacity up to the power of two
+            size_t cap      = 32;
+            while (cap < capacity)
+                cap           <<= 1;
+
+            uint8_t *ptr    = static_cast<uint8_t *>(::malloc(cap * nSizeOf));
+            if (ptr == NULL)
+                return false;
+
+            // Move the content to the beginning of the new buffer
+            read(0, ptr, nItems);
+            if (vItems != NULL)
+                ::free(vItems);
+
+            vItems          = ptr;
+            nHead           = 0;
+            nCapacity       = cap;
+            ++nChanges;
+
+            return true;
+        }
+
+        void raw_ddeque::flush()
+        {
+            if (vItems != NULL)
+            {
+                ::free(vItems);
+                vItems          = NULL;
+            }
+            nHead           = 0;
+            nItems          = 0;
+            nCapacity       = 0;
+            ++nChanges;
+        }
+
+        void raw_ddeque::clear()
+        {
+            nHead           = 0;
+            nItems          = 0;
+            ++nChanges;
+        }
+
+        void raw_ddeque::write(size_t idx, const uint8_t *src, size_t n)
+        {
+            if ((n <= 0) || (src == NULL))
+                return;
+
+            // Copy data as at most two contiguous spans
+            size_t off      = (nHead + idx) & (nCapacity - 1);
+            size_t part     = nCapacity - off;
+            if (part > n)
+                part            = n;
+
+            ::memcpy(&vItems[off * nSizeOf], src, part * nSizeOf);
+            if (part < n)
+                ::memcpy(vItems, &src[part * nSizeOf], (n - part) * nSizeOf);
+        }
+
+        void raw_ddeque::read(size_t idx, uint8_t *dst, size_t n)
+        {
+            if ((n <= 0) || (dst == NULL))
+                return;
+
+            // Copy data as at most two contiguous spans
+            size_t off      = (nHead + idx) & (nCapacity - 1);
+            size_t part     = nCapacity - off;
+            if (part > n)
+                part            = n;
+
+            ::memcpy(dst, &vItems[off * nSizeOf], part * nSizeOf);
+            if (part < n)
+                ::memcpy(&dst[part * nSizeOf], vItems, (n - part) * nSizeOf);
+        }
+
+        uint8_t *raw_ddeque::get(size_t idx)
+        {
+            return (idx < nItems) ? at(idx) : NULL;
+        }
+
+        size_t raw_ddeque::segments(uint8_t **a, size_t *na, uint8_t **b, size_t *nb)
+        {
+            if (nItems <= 0)
+            {
+                *a              = NULL;
+                *na             = 0;
+                *b              = NULL;
+                *nb             = 0;
+                return 0;
+            }
+
+            size_t part     = nCapacity - nHead;
+            if (part >= nItems)
+            {
+                *a              = &vItems[nHead * nSizeOf];
+                *na             = nItems;
+                *b              = NULL;
+                *nb             = 0;
+                return 1;
+            }
+
+            *a              = &vItems[nHead * nSizeOf];
+            *na             = part;
+            *b              = vItems;
+            *nb             = nItems - part;
+            return 2;
+        }
+
+        uint8_t *raw_ddeque::append(const void *src)
+        {
+            if (nItems >= nCapacity)
+            {
+                if (!grow((nCapacity > 0) ? nCapacity << 1 : 1))
+                    return NULL;
+            }
+
+            uint8_t *ptr    = at(nItems++);
+            if (src != NULL)
+                ::memcpy(ptr, src, nSizeOf);
+            ++nChanges;
+
+            return ptr;
+        }
+
+        uint8_t *raw_ddeque::prepend(const void *src)
+        {
+            if (nItems >= nCapacity)
+            {
+                if (!grow((nCapacity > 0) ? nCapacity << 1 : 1))
+                    return NULL;
+            }
+
+            nHead           = (nHead - 1) & (nCapacity - 1);
+            ++nItems;
+            uint8_t *ptr    = at(0);
+            if (src != NULL)
+                ::memcpy(ptr, src, nSizeOf);
+            ++nChanges;
+
+            return ptr;
+        }
+
+        bool raw_ddeque::append(size_t n, const void *src)
+        {
+            if (nItems + n > nCapacity)
+            {
+                size_t cap      = nCapacity << 1;
+                if (!grow((cap > nItems + n) ? cap : nItems + n))
+                    return false;
+            }
+
+            write(nItems, static_cast<const uint8_t *>(src), n);
+            nItems         += n;
+            ++nChanges;
+
+            return true;
+        }
+
+        bool raw_ddeque::prepend(size_t n, const void *src)
+        {
+            if (nItems + n > nCapacity)
+            {
+                size_t cap      = nCapacity << 1;
+                if (!grow((cap > nItems + n) ? cap : nItems + n))
+                    return false;
+            }
+
+            nHead           = (nHead - n) & (nCapacity - 1);
+            nItems         += n;
+            write(0, static_cast<const uint8_t *>(src), n);
+            ++nChanges;
+
+            return true;
+        }
+
+        uint8_t *raw_ddeque::pop(void *dst)
+        {
+            if (nItems <= 0)
+                return NULL;
+
+            uint8_t *ptr    = at(--nItems);
+            ++nChanges;
+            if (dst == NULL)
+                return ptr;
+
+            ::memcpy(dst, ptr, nSizeOf);
+            return static_cast<uint8_t *>(dst);
+        }
+
+        uint8_t *raw_ddeque::shift(void *dst)
+        {
+            if (nItems <= 0)
+                return NULL;
+
+            uint8_t *ptr    = at(0);
+            nHead           = (nHead + 1) & (nCapacity - 1);
+            --nItems;
+            ++nChanges;
+            if (dst == NULL)
+                return ptr;
+
+            ::memcpy(dst, ptr, nSizeOf);
+            return static_cast<uint8_t *>(dst);
+        }
+
+        size_t raw_ddeque::pop(size_t n, void *dst)
+        {
+            if (n > nItems)
+                n               = nItems;
+
+            read(nItems - n, static_cast<uint8_t *>(dst), n);
+            nItems         -= n;
+            ++nChanges;
+
+            return n;
+        }
+
+        size_t raw_ddeque::shift(size_t n, void *dst)
+        {
+            if (n > nItems)
+                n               = nItems;
+
+            read(0, static_cast<uint8_t *>(dst), n);
+            if (nCapacity > 0)
+                nHead           = (nHead + n) & (nCapacity - 1);
+            nItems         -= n;
+            ++nChanges;
+
+            return n;
+        }
+    }
+}
@@ -0,0 +1,366 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/dheap.h>
+#include <lsp-plug.in/common/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_dheap::init(size_t n_sizeof, compare_func_t cmp, size_t cmp_size, bool indirect)
+        {
+            vItems.init(n_sizeof);
+            vHeap.init(sizeof(size_t));
+            vPos.init(sizeof(size_t));
+            nFree       = INVALID;
+            pTemp       = NULL;
+            pCmp        = cmp;
+            nCmpSize    = cmp_size;
+            bIndirect   = indirect;
+        }
+
+        bool raw_dheap::grow(size_t capacity)
+        {
+            if (pTemp == NULL)
+            {
+                pTemp       = static_cast<uint8_t *>(::malloc(vItems.nSizeOf));
+                if (pTemp == NULL)
+                    return false;
+            }
+
+            // Number of handles never exceeds the number of items, so all arrays have the same capacity
+            if ((capacity > vItems.nCapacity) && (!vItems.grow(capacity)))
+                return false;
+            if ((capacity > vHeap.nCapacity) && (!vHeap.grow(capacity)))
+                return false;
+            if ((capacity > vPos.nCapacity) && (!vPos.grow(capacity)))
+                return false;
+
+            return true;
+        }
+
+        void raw_dheap::flush()
+        {
+            vItems.flush();
+            vHeap.flush();
+            vPos.flush();
+            if (pTemp != NULL)
+            {
+                ::free(pTemp);
+                pTemp       = NULL;
+            }
+            nFree       = INVALID;
+        }
+
+        void raw_dheap::clear()
+        {
+            vItems.nItems   = 0;
+            vHeap.nItems    = 0;
+            vPos.nItems     = 0;
+            nFree           = INVALID;
+            ++vItems.nChanges;
+        }
+
+        void raw_dheap::swap(raw_dheap *src)
+        {
+            vItems.swap(&src->vItems);
+            vHeap.swap(&src->vHeap);
+            vPos.swap(&src->vPos);
+            lsp::swap(nFree, src->nFree);
+            lsp::swap(pTemp, src->pTemp);
+            lsp::swap(pCmp, src->pCmp);
+            lsp::swap(nCmpSize, src->nCmpSize);
+            lsp::swap(bIndirect, src->bIndirect);
+        }
+
+        size_t raw_dheap::alloc_handle()
+        {
+            // Reuse the free handle first
+            size_t h        = nFree;
+            if (h != INVALID)
+            {
+                nFree           = pos()[h];
+                return h;
+            }
+
+            return vPos.nItems++;
+        }
+
+        void raw_dheap::free_handle(size_t h)
+        {
+            pos()[h]        = nFree;
+            nFree           = h;
+        }
+
+        void raw_dheap::place(size_t idx, const uint8_t *src, size_t h)
+        {
+            ::memcpy(item(idx), src, vItems.nSizeOf);
+            heap()[idx]     = h;
+            pos()[h]        = idx;
+        }
+
+        size_t raw_dheap::sift_up(size_t idx, const uint8_t *src, size_t h)
+        {
+            // Move parents down to the hole while they are greater than the item
+            while (idx > 0)
+            {
+                size_t parent   = (idx - 1) / ARITY;
+                uint8_t *p      = item(parent);
+                if (compare(src, p) >= 0)
+                    break;
+
+                place(idx, p, heap()[parent]);
+                idx             = parent;
+            }
+
+            place(idx, src, h);
+            return idx;
+        }
+
+        size_t raw_dheap::sift_down(size_t idx, const uint8_t *src, size_t h)
+        {
+            size_t n        = vItems.nItems;
+
+            // Move the least child up to the hole while it is less than the item
+            while (true)
+            {
+                size_t first    = idx * ARITY + 1;
+                if (first >= n)
+                    break;
+                size_t last     = (first + ARITY < n) ? first + ARITY : n;
+
+                size_t best     = first;
+                uint8_t *b      = item(first);
+                for (size_t i=first+1; i<last; ++i)
+                {
+                    uint8_t *c      = item(i);
+                    if (compare(c, b) < 0)
+                    {
+                        best            = i;
+                        b               = c;
+                    }
+                }
+
+                if (compare(b, src) >= 0)
+                    break;
+
+                place(idx, b, heap()[best]);
+                idx             = best;
+            }
+
+            place(idx, src, h);
+            return idx;
+        }
+
+        void raw_dheap::restore(size_t idx, const uint8_t *src, size_t h)
+        {
+            if ((idx > 0) && (compare(src, item((idx - 1) / ARITY)) < 0))
+                sift_up(idx, src, h);
+            else
+                sift_down(idx, src, h);
+        }
+
+        void raw_dheap::heapify()
+        {
+            size_t n        = vItems.nItems;
+            if (n < 2)
+                return;
+
+            // Floyd's method: sift down all nodes that have children, starting from the last one
+            for (size_t i = (n - 2) / ARITY + 1; i > 0; )
+            {
+                --i;
+                ::memcpy(pTemp, item(i), vItems.nSizeOf);
+                sift_down(i, pTemp, heap()[i]);
+            }
+        }
+
+        bool raw_dheap::reserve(size_t size)
+        {
+            size_t cap      = vItems.nCapacity;
+            if ((size <= cap) && (pTemp != NULL))
+                return true;
+
+            cap            += cap >> 1;
+            return grow((size > cap) ? size : cap);
+        }
+
+        void raw_dheap::remove_at(size_t idx, void *dst)
+        {
+            size_t h        = heap()[idx];
+            if (dst != NULL)
+                ::memcpy(dst, item(idx), vItems.nSizeOf);
+            free_handle(h);
+
+            // Fill the hole with the last item
+            size_t last     = --vItems.nItems;
+            --vHeap.nItems;
+            if (idx < last)
+            {
+                ::memcpy(pTemp, item(last), vItems.nSizeOf);
+                restore(idx, pTemp, heap()[last]);
+            }
+
+            ++vItems.nChanges;
+        }
+
+        uint8_t *raw_dheap::top()
+        {
+            return (vItems.nItems > 0) ? vItems.vItems : NULL;
+        }
+
+        ssize_t raw_dheap::top_handle()
+        {
+            return (vItems.nItems > 0) ? heap()[0] : -1;
+        }
+
+        bool raw_dheap::contains(size_t h)
+        {
+            if (h >= vPos.nItems)
+                return false;
+            size_t idx      = pos()[h];
+            return (idx < vItems.nItems) && (heap()[idx] == h);
+        }
+
+        uint8_t *raw_dheap::get(size_t h)
+        {
+            return (contains(h)) ? item(pos()[h]) : NULL;
+        }
+
+        ssize_t raw_dheap::item_offset(const void *src) const
+        {
+            const uint8_t *p    = static_cast<const uint8_t *>(src);
+            const uint8_t *base = vItems.vItems;
+            if ((base == NULL) || (p < base) || (p >= &base[vItems.nItems * vItems.nSizeOf]))
+                return -1;
+            return p - base;
+        }
+
+        ssize_t raw_dheap::push(const void *src)
+        {
+            // Source may point to the item of the heap which is moved by reallocation
+            size_t n        = vItems.nItems;
+            ssize_t off     = item_offset(src);
+            if (!reserve(n + 1))
+                return -1;
+            if (off >= 0)
+                src             = &vItems.vItems[off];
+
+            ::memcpy(pTemp, src, vItems.nSizeOf);
+            size_t h        = alloc_handle();
+            ++vItems.nItems;
+            ++vHeap.nItems;
+            ++vItems.nChanges;
+
+            sift_up(n, pTemp, h);
+            return h;
+        }
+
+        bool raw_dheap::push(size_t n, const void *src, size_t *handles)
+        {
+            if (n <= 0)
+                return true;
+
+            // Source may point to the items of the heap which are moved by reallocation
+            size_t count    = vItems.nItems;
+            ssize_t off     = item_offset(src);
+            if (!reserve(count + n))
+                return false;
+            if (off >= 0)
+                src             = &vItems.vItems[off];
+
+            // Append all items to the end of the heap
+            ::memcpy(item(count), src, n * vItems.nSizeOf);
+            for (size_t i=0; i<n; ++i)
+            {
+                size_t h            = alloc_handle();
+                heap()[count + i]   = h;
+                pos()[h]            = count + i;
+                if (handles != NULL)
+                    handles[i]          = h;
+            }
+            vItems.nItems  += n;
+            vHeap.nItems   += n;
+            ++vItems.nChanges;
+
+            // Rebuilding the heap is O(n) and is cheaper than sifting up for large batches
+            if (n >= count)
+            {
+                heapify();
+                return true;
+            }
+
+            for (size_t i=count, last=count+n; i<last; ++i)
+            {
+                ::memcpy(pTemp, item(i), vItems.nSizeOf);
+                sift_up(i, pTemp, heap()[i]);
+            }
+
+            return true;
+        }
+
+        bool raw_dheap::pop(void *dst)
+        {
+            if (vItems.nItems <= 0)
+                return false;
+
+            remove_at(0, dst);
+            return true;
+        }
+
+        bool raw_dheap::remove(size_t h, void *dst)
+        {
+            if (!contains(h))
+                return false;
+
+            remove_at(pos()[h], dst);
+            return true;
+        }
+
+        bool raw_dheap::update(size_t h, const void *src)
+        {
+            if (!contains(h))
+                return false;
+
+            ::memcpy(pTemp, src, vItems.nSizeOf);
+            restore(pos()[h], pTemp, h);
+            ++vItems.nChanges;
+
+            return true;
+        }
+
+        bool raw_dheap::merge(raw_dheap *src)
+        {
+            if ((src == this) || (src->vItems.nItems <= 0))
+                return true;
+
+            if (!push(src->vItems.nItems, src->vItems.vItems, NULL))
+                return false;
+
+            src->clear();
+            return true;
+        }
+
+    }
+}
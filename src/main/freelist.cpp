@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/freelist.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_freelist::init(size_t n_sizeof)
+        {
+            nHead       = 0;
+            nFree       = 0;
+            nChunks     = 0;
+            nCapacity   = 0;
+            nSizeOf     = n_sizeof;
+            nStride     = HEADER_SIZE + ((n_sizeof + HEADER_SIZE - 1) & (~size_t(HEADER_SIZE - 1)));
+            for (size_t i=0; i<MAX_CHUNKS; ++i)
+            {
+                vChunks[i]  = NULL;
+                vData[i]    = NULL;
+            }
+        }
+
+        void raw_freelist::flush()
+        {
+            for (size_t i=0; i<MAX_CHUNKS; ++i)
+            {
+                if (vData[i] != NULL)
+                    ::free(vData[i]);
+                vChunks[i]  = NULL;
+                vData[i]    = NULL;
+            }
+
+            nHead       = 0;
+            nFree       = 0;
+            nChunks     = 0;
+            nCapacity   = 0;
+        }
+
+        raw_freelist::node_t *raw_freelist::node(uint32_t index)
+        {
+            // Chunk k contains CHUNK_SIZE * 2^k objects starting with index CHUNK_SIZE * (2^k - 1)
+            uint32_t q      = index / CHUNK_SIZE + 1;
+            uint32_t k      = 31 - __builtin_clz(q);
+            if (k >= MAX_CHUNKS)
+                return NULL;
+            uint8_t *chunk  = __atomic_load_n(&vChunks[k], __ATOMIC_ACQUIRE);
+            if (chunk == NULL)
+                return NULL;
+
+            size_t offset   = index - CHUNK_SIZE * ((uint32_t(1) << k) - 1);
+            return reinterpret_cast<node_t *>(&chunk[offset * nStride]);
+        }
+
+        void raw_freelist::push(node_t *first, node_t *last, size_t count)
+        {
+            // Increment counter first, so it never goes below zero
+            __atomic_fetch_add(&nFree, count, __ATOMIC_RELAXED);
+
+            uint64_t head   = __atomic_load_n(&nHead, __ATOMIC_RELAXED);
+            uint64_t next;
+            do
+            {
+                __atomic_store_n(&last->next, uint32_t(head), __ATOMIC_RELAXED);
+                next            = (((head >> 32) + 1) << 32) | (first->index + 1);
+            } while (!__atomic_compare_exchange_n(&nHead, &head, next, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+        }
+
+        bool raw_freelist::grow()
+        {
+            // Allocate aligned chunk data first, so the failed allocation does not waste the chunk slot
+            size_t k        = __atomic_load_n(&nChunks, __ATOMIC_RELAXED);
+            if (k >= MAX_CHUNKS)
+                return false;
+            size_t count    = size_t(CHUNK_SIZE) << k;
+            uint8_t *ptr    = static_cast<uint8_t *>(::malloc(count * nStride + HEADER_SIZE));
+            if (ptr == NULL)
+                return false;
+
+            // Reserve the chunk, if another thread has already reserved it then the list has grown
+            if (!__atomic_compare_exchange_n(&nChunks, &k, k + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                ::free(ptr);
+                return true;
+            }
+
+            uint8_t *chunk  = reinterpret_cast<uint8_t *>((reinterpret_cast<uintptr_t>(ptr) + HEADER_SIZE - 1) & (~uintptr_t(HEADER_SIZE - 1)));
+
+            // Link all objects of the chunk into the list
+            uint32_t base   = CHUNK_SIZE * ((uint32_t(1) << k) - 1);
+            for (size_t i=0; i<count; ++i)
+            {
+                node_t *n       = reinterpret_cast<node_t *>(&chunk[i * nStride]);
+                n->index        = base + i;
+                n->next         = base + i + 2;
+            }
+
+            // Publish the chunk and push objects to the list
+            vData[k]        = ptr;
+            __atomic_store_n(&vChunks[k], chunk, __ATOMIC_RELEASE);
+            __atomic_fetch_add(&nCapacity, count, __ATOMIC_RELAXED);
+            push(
+                reinterpret_cast<node_t *>(chunk),
+                reinterpret_cast<node_t *>(&chunk[(count - 1) * nStride]),
+                count);
+
+            return true;
+        }
+
+        bool raw_freelist::prefill(size_t count)
+        {
+            while (__atomic_load_n(&nFree, __ATOMIC_RELAXED) < count)
+            {
+                if (!grow())
+                    return false;
+            }
+
+            return true;
+        }
+
+        void *raw_freelist::alloc()
+        {
+            uint64_t head   = __atomic_load_n(&nHead, __ATOMIC_ACQUIRE);
+            node_t *n;
+
+            while (true)
+            {
+                uint32_t index  = uint32_t(head);
+                if (index == 0)
+                    return NULL;
+
+                // The node may be concurrently taken by another thread, in this case
+                // the next index may be invalid but the tag will not match
+                n               = node(index - 1);
+                uint64_t next   = (((head >> 32) + 1) << 32) | __atomic_load_n(&n->next, __ATOMIC_RELAXED);
+                if (__atomic_compare_exchange_n(&nHead, &head, next, true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+                    break;
+            }
+
+            __atomic_fetch_sub(&nFree, 1, __ATOMIC_RELAXED);
+            return reinterpret_cast<uint8_t *>(n) + HEADER_SIZE;
+        }
+
+        void raw_freelist::free(void *ptr)
+        {
+            node_t *n       = reinterpret_cast<node_t *>(static_cast<uint8_t *>(ptr) - HEADER_SIZE);
+            push(n, n, 1);
+        }
+
+        size_t raw_freelist::drain(void **items, size_t count)
+        {
+            if (count <= 0)
+                return 0;
+
+            uint64_t head   = __atomic_load_n(&nHead, __ATOMIC_ACQUIRE);
+
+            while (true)
+            {
+                uint32_t index  = uint32_t(head);
+                if (index == 0)
+                    return 0;
+
+                // Walk the list, the tag guarantees that the list has not been
+                // modified if compare-and-swap succeeds
+                size_t n        = 0;
+                while ((n < count) && (index != 0))
+                {
+                    node_t *x       = node(index - 1);
+                    if (x == NULL)
+                        break;
+                    items[n++]      = reinterpret_cast<uint8_t *>(x) + HEADER_SIZE;
+                    index           = __atomic_load_n(&x->next, __ATOMIC_RELAXED);
+                }
+
+                if ((n < count) && (index != 0))
+                {
+                    // The list has been concurrently modified, retry
+                    head            = __atomic_load_n(&nHead, __ATOMIC_ACQUIRE);
+                    continue;
+                }
+
+                uint64_t next   = (((head >> 32) + 1) << 32) | index;
+                if (__atomic_compare_exchange_n(&nHead, &head, next, true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+                {
+                    __atomic_fetch_sub(&nFree, n, __ATOMIC_RELAXED);
+                    return n;
+                }
+            }
+        }
+
+        void raw_freelist::fill(void * const *items, size_t count)
+        {
+            if (count <= 0)
+                return;
+
+            // Link objects into the chain and push it with single operation
+            node_t *first   = reinterpret_cast<node_t *>(static_cast<uint8_t *>(items[0]) - HEADER_SIZE);
+            node_t *last    = first;
+            for (size_t i=1; i<count; ++i)
+            {
+                node_t *n       = reinterpret_cast<node_t *>(static_cast<uint8_t *>(items[i]) - HEADER_SIZE);
+                __atomic_store_n(&last->next, n->index + 1, __ATOMIC_RELAXED);
+                last            = n;
+            }
+
+            push(first, last, count);
+        }
+    }
+}
@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/ihash.h>
+#include <stdlib.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        const iter_vtbl_t raw_ihash::iterator_vtbl =
+        {
+            raw_ihash::iter_advance,
+            raw_ihash::iter_get,
+            raw_ihash::iter_remove
+        };
+
+        void raw_ihash::init(size_t hoff, size_t koff, size_t ksize, bool indirect, const hash_iface &h, const compare_iface &c)
+        {
+            vBins       = NULL;
+            nBins       = 0;
+            nItems      = 0;
+            nChanges    = 0;
+            nHookOff    = hoff;
+            nKeyOff     = koff;
+            nKeySize    = ksize;
+            bIndirect   = indirect;
+            hash        = h;
+            cmp         = c;
+        }
+
+        void raw_ihash::flush()
+        {
+            if (vBins != NULL)
+            {
+                ::free(vBins);
+                vBins       = NULL;
+            }
+            nBins       = 0;
+            nItems      = 0;
+            ++nChanges;
+        }
+
+        void raw_ihash::clear()
+        {
+            for (size_t i=0; i<nBins; ++i)
+                vBins[i]    = NULL;
+            nItems      = 0;
+            ++nChanges;
+        }
+
+        void raw_ihash::swap(raw_ihash *src)
+        {
+            raw_ihash tmp   = *this;
+            *this           = *src;
+            *src            = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->nChanges   = nChanges + 1;
+            nChanges        = tmp.nChanges + 1;
+        }
+
+        ihook **raw_ihash::find(const void *key, size_t h)
+        {
+            if (vBins == NULL)
+                return NULL;
+
+            for (ihook **pcurr = &vBins[h & (nBins - 1)]; *pcurr != NULL; pcurr = &(*pcurr)->pNext)
+            {
+                ihook *curr     = *pcurr;
+                if ((curr->nHash == h) && (cmp.compare(this->key(object(curr)), key, nKeySize) == 0))
+                    return pcurr;
+            }
+
+            return NULL;
+        }
+
+        void raw_ihash::grow()
+        {
+            size_t bins     = (nBins > 0) ? nBins << 1 : size_t(MIN_BINS);
+            ihook **v       = static_cast<ihook **>(::malloc(bins * sizeof(ihook *)));
+            if (v == NULL)
+                return;     // Keep the current bins, chains just become longer
+
+            for (size_t i=0; i<bins; ++i)
+                v[i]            = NULL;
+
+            // Re-distribute objects using stored hash values
+            for (size_t i=0; i<nBins; ++i)
+            {
+                for (ihook *curr = vBins[i]; curr != NULL; )
+                {
+                    ihook *next     = curr->pNext;
+                    ihook **bin     = &v[curr->nHash & (bins - 1)];
+                    curr->pNext     = *bin;
+                    *bin            = curr;
+                    curr            = next;
+                }
+            }
+
+            if (vBins != NULL)
+                ::free(vBins);
+            vBins           = v;
+            nBins           = bins;
+        }
+
+        uint8_t *raw_ihash::get(const void *key)
+        {
+            if (vBins == NULL)
+                return NULL;
+
+            ihook **pcurr   = find(key, hash.hash(key, nKeySize));
+            return (pcurr != NULL) ? object(*pcurr) : NULL;
+        }
+
+        bool raw_ihash::put(void *obj, put_mode_t mode, void **ov)
+        {
+            ihook *h        = hook(obj);
+            const void *k   = key(obj);
+            size_t hv       = hash.hash(k, nKeySize);
+
+            ihook **pcurr   = find(k, hv);
+            if (pcurr != NULL)
+            {
+                ihook *curr     = *pcurr;
+                if ((mode == PUT_CREATE) || (curr == h))
+                {
+                    if (ov != NULL)
+                        *ov             = NULL;
+                    return (mode != PUT_CREATE);
+                }
+
+                // Replace the object in the chain
+                h->pNext        = curr->pNext;
+                h->nHash        = hv;
+                curr->pNext     = NULL;
+                *pcurr          = h;
+                ++nChanges;
+
+                if (ov != NULL)
+                    *ov             = object(curr);
+                return true;
+            }
+
+            if (nItems >= nBins)
+            {
+                grow();
+                if (vBins == NULL)
+                    return false;
+            }
+
+            ihook **bin     = &vBins[hv & (nBins - 1)];
+            h->pNext        = *bin;
+            h->nHash        = hv;
+            *bin            = h;
+            ++nItems;
+            ++nChanges;
+
+            if (ov != NULL)
+                *ov             = NULL;
+            return true;
+        }
+
+        bool raw_ihash::remove(void *obj)
+        {
+            if (vBins == NULL)
+                return false;
+
+            ihook *h        = hook(obj);
+            for (ihook **pcurr = &vBins[h->nHash & (nBins - 1)]; *pcurr != NULL; pcurr = &(*pcurr)->pNext)
+            {
+                if (*pcurr == h)
+                {
+                    *pcurr          = h->pNext;
+                    h->pNext        = NULL;
+                    --nItems;
+                    ++nChanges;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        uint8_t *raw_ihash::remove_key(const void *key)
+        {
+            if (vBins == NULL)
+                return NULL;
+
+            ihook **pcurr   = find(key, hash.hash(key, nKeySize));
+            if (pcurr == NULL)
+                return NULL;
+
+            ihook *h        = *pcurr;
+            *pcurr          = h->pNext;
+            h->pNext        = NULL;
+            --nItems;
+            ++nChanges;
+
+            return object(h);
+        }
+
+        raw_iterator raw_ihash::iter()
+        {
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &nChanges;
+            it.change       = nChanges;
+            it.index        = 0;
+            it.limit        = nBins;
+            it.item         = NULL;
+
+            // Find first non-empty bin
+            for (size_t i=0; i<nBins; ++i)
+            {
+                if (vBins[i] != NULL)
+                {
+                    it.index        = i;
+                    it.item         = vBins[i];
+                    break;
+                }
+            }
+
+            return it;
+        }
+
+        void raw_ihash::iter_advance(raw_iterator *i, size_t n)
+        {
+            raw_ihash *self     = static_cast<raw_ihash *>(i->container);
+            ihook *curr         = static_cast<ihook *>(i->item);
+            size_t bin          = i->index;
+
+            for ( ; n > 0; --n)
+            {
+                curr                = curr->pNext;
+                while (curr == NULL)
+                {
+                    if ((++bin) >= self->nBins)
+                    {
+                        i->item             = NULL;
+                        i->index            = bin;
+                        return;
+                    }
+                    curr                = self->vBins[bin];
+                }
+            }
+
+            i->item             = curr;
+            i->index            = bin;
+        }
+
+        void *raw_ihash::iter_get(const raw_iterator *i)
+        {
+            const raw_ihash *self   = static_cast<const raw_ihash *>(i->container);
+            return self->object(static_cast<ihook *>(i->item));
+        }
+
+        void raw_ihash::iter_remove(raw_iterator *i)
+        {
+            raw_ihash *self     = static_cast<raw_ihash *>(i->container);
+            ihook *h            = static_cast<ihook *>(i->item);
+            ihook **bin         = &self->vBins[i->index];
+
+            // Advance iterator before the object becomes unlinked
+            iter_advance(i, 1);
+
+            for (ihook **pcurr = bin; *pcurr != NULL; pcurr = &(*pcurr)->pNext)
+            {
+                if (*pcurr == h)
+                {
+                    *pcurr          = h->pNext;
+                    break;
+                }
+            }
+            h->pNext            = NULL;
+            --self->nItems;
+            i->change           = ++self->nChanges;
+        }
+    }
+}
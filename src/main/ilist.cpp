@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/ilist.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        const iter_vtbl_t raw_ilist::iterator_vtbl =
+        {
+            raw_ilist::iter_advance,
+            raw_ilist::iter_get,
+            raw_ilist::iter_remove
+        };
+
+        void raw_ilist::init(size_t offset)
+        {
+            sHead.pNext     = &sHead;
+            sHead.pPrev     = &sHead;
+            nItems          = 0;
+            nChanges        = 0;
+            nOffset         = offset;
+        }
+
+        void raw_ilist::link(ilink *l, ilink *next)
+        {
+            ilink *prev     = next->pPrev;
+            l->pNext        = next;
+            l->pPrev        = prev;
+            prev->pNext     = l;
+            next->pPrev     = l;
+        }
+
+        void raw_ilist::unlink(ilink *l)
+        {
+            l->pPrev->pNext = l->pNext;
+            l->pNext->pPrev = l->pPrev;
+        }
+
+        void raw_ilist::clear()
+        {
+            // Reset hooks to allow objects to be linked again
+            for (ilink *l = sHead.pNext; l != &sHead; )
+            {
+                ilink *next     = l->pNext;
+                l->init();
+                l               = next;
+            }
+
+            sHead.pNext     = &sHead;
+            sHead.pPrev     = &sHead;
+            nItems          = 0;
+            ++nChanges;
+        }
+
+        void raw_ilist::swap(raw_ilist *src)
+        {
+            ilink *head[2]  = { sHead.pNext, src->sHead.pNext };
+            ilink *tail[2]  = { sHead.pPrev, src->sHead.pPrev };
+            size_t items    = nItems;
+            size_t offset   = nOffset;
+
+            // Re-link the sentinels
+            if (src->nItems > 0)
+            {
+                sHead.pNext     = head[1];
+                sHead.pPrev     = tail[1];
+                head[1]->pPrev  = &sHead;
+                tail[1]->pNext  = &sHead;
+            }
+            else
+            {
+                sHead.pNext     = &sHead;
+                sHead.pPrev     = &sHead;
+            }
+
+            if (items > 0)
+            {
+                src->sHead.pNext    = head[0];
+                src->sHead.pPrev    = tail[0];
+                head[0]->pPrev      = &src->sHead;
+                tail[0]->pNext      = &src->sHead;
+            }
+            else
+            {
+                src->sHead.pNext    = &src->sHead;
+                src->sHead.pPrev    = &src->sHead;
+            }
+
+            nItems          = src->nItems;
+            nOffset         = src->nOffset;
+            src->nItems     = items;
+            src->nOffset    = offset;
+
+            ++nChanges;
+            ++src->nChanges;
+        }
+
+        bool raw_ilist::insert_before(void *pos, void *obj)
+        {
+            ilink *l        = hook(obj);
+            if (l->linked())
+                return false;
+
+            link(l, (pos != NULL) ? hook(pos) : &sHead);
+            ++nItems;
+            ++nChanges;
+            return true;
+        }
+
+        bool raw_ilist::insert_after(void *pos, void *obj)
+        {
+            ilink *l        = hook(obj);
+            if (l->linked())
+                return false;
+
+            link(l, (pos != NULL) ? hook(pos)->pNext : sHead.pNext);
+            ++nItems;
+            ++nChanges;
+            return true;
+        }
+
+        bool raw_ilist::remove(void *obj)
+        {
+            ilink *l        = hook(obj);
+            if (!l->linked())
+                return false;
+
+            unlink(l);
+            l->init();
+            --nItems;
+            ++nChanges;
+            return true;
+        }
+
+        bool raw_ilist::move_before(void *pos, void *obj)
+        {
+            ilink *l        = hook(obj);
+            if (!l->linked())
+                return false;
+
+            ilink *next     = (pos != NULL) ? hook(pos) : &sHead;
+            if ((next == l) || (next == l->pNext))
+                return true;
+
+            unlink(l);
+            link(l, next);
+            ++nChanges;
+            return true;
+        }
+
+        uint8_t *raw_ilist::pop()
+        {
+            uint8_t *obj    = last();
+            if (obj != NULL)
+                remove(obj);
+            return obj;
+        }
+
+        uint8_t *raw_ilist::shift()
+        {
+            uint8_t *obj    = first();
+            if (obj != NULL)
+                remove(obj);
+            return obj;
+        }
+
+        raw_iterator raw_ilist::iter()
+        {
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &nChanges;
+            it.change       = nChanges;
+            it.index        = 0;
+            it.limit        = nItems;
+            it.item         = (nItems > 0) ? sHead.pNext : NULL;
+            return it;
+        }
+
+        void raw_ilist::iter_advance(raw_iterator *i, size_t n)
+        {
+            raw_ilist *self     = static_cast<raw_ilist *>(i->container);
+            ilink *l            = static_cast<ilink *>(i->item);
+
+            for ( ; n > 0; --n)
+            {
+                l                   = l->pNext;
+                if (l == &self->sHead)
+                {
+                    i->item             = NULL;
+                    return;
+                }
+                ++i->index;
+            }
+
+            i->item             = l;
+        }
+
+        void *raw_ilist::iter_get(const raw_iterator *i)
+        {
+            const raw_ilist *self   = static_cast<const raw_ilist *>(i->container);
+            return self->object(static_cast<ilink *>(i->item));
+        }
+
+        void raw_ilist::iter_remove(raw_iterator *i)
+        {
+            raw_ilist *self     = static_cast<raw_ilist *>(i->container);
+            ilink *l            = static_cast<ilink *>(i->item);
+            ilink *next         = l->pNext;
+
+            self->unlink(l);
+            l->init();
+            --self->nItems;
+
+            i->item             = (next != &self->sHead) ? next : NULL;
+            i->limit            = self->nItems;
+            i->change           = ++self->nChanges;
+        }
+    }
+}
@@ -25,33 +25,15 @@ namespace lsp
 {
     namespace lltl
     {
-        raw_iterator *raw_iterator::reference(raw_iterator *src)
+        void raw_iterator::init()
         {
-            if (src == NULL)
-                return NULL;
-            ++src->refs;
-            return src;
-        }
-
-        raw_iterator *raw_iterator::dereference(raw_iterator *src)
-        {
-            if (src != NULL)
-            {
-                if ((--src->refs) <= 0)
-                    ::free(src);
-            }
-
-            return NULL;
-        }
-
-        raw_iterator *raw_iterator::replace(raw_iterator *xold, raw_iterator *xnew)
-        {
-            if (xold == xnew)
-                return xold;
-
-            raw_iterator *ref = reference(xnew);
-            dereference(xold);
-            return ref;
+            vtable      = NULL;
+            container   = NULL;
+            changes     = NULL;
+            change      = 0;
+            index       = 0;
+            limit       = 0;
+            item        = NULL;
         }
     }
 }
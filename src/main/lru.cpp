@@ -0,0 +1,433 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/lru.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_lru::init(size_t ksize, const hash_iface &h, const compare_iface &c, const allocator_iface &a, cache_policy_t policy)
+        {
+            vBins       = NULL;
+            nBins       = 0;
+            nEntries    = 0;
+            nItems      = 0;
+            nCost       = 0;
+            nBudget     = size_t(-1);
+            nKeySize    = ksize;
+            hash        = h;
+            cmp         = c;
+            alloc       = a;
+            enPolicy    = policy;
+            pEvict      = NULL;
+            pEvictArg   = NULL;
+            nHits       = 0;
+            nMisses     = 0;
+            nEvictions  = 0;
+
+            for (size_t i=0; i<Q_TOTAL; ++i)
+            {
+                queue_t *q  = &vQueues[i];
+                q->pHead    = NULL;
+                q->pTail    = NULL;
+                q->nCount   = 0;
+                q->nCost    = 0;
+            }
+
+            vPool.init(sizeof(entry_t));
+        }
+
+        void raw_lru::clear()
+        {
+            for (size_t i=0; i<nBins; ++i)
+            {
+                for (entry_t *e = vBins[i]; e != NULL; )
+                {
+                    entry_t *next   = e->pHNext;
+                    if (e->pKey != NULL)
+                        alloc.free(e->pKey);
+                    vPool.free(e);
+                    e               = next;
+                }
+                vBins[i]        = NULL;
+            }
+
+            for (size_t i=0; i<Q_TOTAL; ++i)
+            {
+                queue_t *q  = &vQueues[i];
+                q->pHead    = NULL;
+                q->pTail    = NULL;
+                q->nCount   = 0;
+                q->nCost    = 0;
+            }
+
+            nEntries    = 0;
+            nItems      = 0;
+            nCost       = 0;
+        }
+
+        void raw_lru::flush()
+        {
+            clear();
+            if (vBins != NULL)
+            {
+                ::free(vBins);
+                vBins       = NULL;
+            }
+            nBins       = 0;
+            vPool.flush();
+        }
+
+        void raw_lru::push(entry_t *e, size_t queue)
+        {
+            queue_t *q      = &vQueues[queue];
+
+            e->nQueue       = queue;
+            e->pNext        = NULL;
+            e->pPrev        = q->pTail;
+            if (q->pTail != NULL)
+                q->pTail->pNext = e;
+            else
+                q->pHead        = e;
+            q->pTail        = e;
+
+            ++q->nCount;
+            q->nCost       += e->nCost;
+            nCost          += e->nCost;
+        }
+
+        void raw_lru::unlink(entry_t *e)
+        {
+            queue_t *q      = &vQueues[e->nQueue];
+
+            if (e->pPrev != NULL)
+                e->pPrev->pNext = e->pNext;
+            else
+                q->pHead        = e->pNext;
+            if (e->pNext != NULL)
+                e->pNext->pPrev = e->pPrev;
+            else
+                q->pTail        = e->pPrev;
+
+            --q->nCount;
+            q->nCost       -= e->nCost;
+            nCost          -= e->nCost;
+        }
+
+        raw_lru::entry_t *raw_lru::find(const void *key, size_t hash, bool ghost)
+        {
+            if (nBins <= 0)
+                return NULL;
+
+            // Entries with values match by key, ghost entries match by hash only
+            entry_t *g      = NULL;
+            for (entry_t *e = vBins[hash & (nBins - 1)]; e != NULL; e = e->pHNext)
+            {
+                if (e->nHash != hash)
+                    continue;
+                if (e->pKey == NULL)
+                {
+                    if (g == NULL)
+                        g               = e;
+                }
+                else if (cmp.compare(e->pKey, key, nKeySize) == 0)
+                    return e;
+            }
+
+            return (ghost) ? g : NULL;
+        }
+
+        void raw_lru::remove_entry(entry_t *e)
+        {
+            // Remove from the hash chain, the entry should be already unlinked from the queue
+            for (entry_t **p = &vBins[e->nHash & (nBins - 1)]; *p != NULL; p = &(*p)->pHNext)
+            {
+                if (*p == e)
+                {
+                    *p              = e->pHNext;
+                    break;
+                }
+            }
+
+            if (e->pKey != NULL)
+                alloc.free(e->pKey);
+            vPool.free(e);
+            --nEntries;
+        }
+
+        bool raw_lru::grow()
+        {
+            size_t bins     = (nBins > 0) ? nBins << 1 : size_t(MIN_BINS);
+            entry_t **v     = static_cast<entry_t **>(::calloc(bins, sizeof(entry_t *)));
+            if (v == NULL)
+                return false;
+
+            // Rehash entries by stored hash codes
+            for (size_t i=0; i<nBins; ++i)
+            {
+                for (entry_t *e = vBins[i]; e != NULL; )
+                {
+                    entry_t *next   = e->pHNext;
+                    entry_t **bin   = &v[e->nHash & (bins - 1)];
+                    e->pHNext       = *bin;
+                    *bin            = e;
+                    e               = next;
+                }
+            }
+
+            if (vBins != NULL)
+                ::free(vBins);
+            vBins           = v;
+            nBins           = bins;
+
+            return true;
+        }
+
+        void raw_lru::touch(entry_t *e)
+        {
+            switch (enPolicy)
+            {
+                case CACHE_CLOCK:
+                    e->nFreq        = 1;
+                    break;
+                case CACHE_S3FIFO:
+                    if (e->nFreq < MAX_FREQ)
+                        ++e->nFreq;
+                    break;
+                default:
+                    unlink(e);
+                    push(e, Q_MAIN);
+                    break;
+            }
+        }
+
+        void raw_lru::evict_entry(entry_t *e, bool ghost)
+        {
+            unlink(e);
+            --nItems;
+            ++nEvictions;
+            if (pEvict != NULL)
+                pEvict(e->pKey, e->pValue, e->nCost, pEvictArg);
+
+            if (!ghost)
+            {
+                remove_entry(e);
+                return;
+            }
+
+            // Keep only the hash code of the key in the ghost queue
+            alloc.free(e->pKey);
+            e->pKey         = NULL;
+            e->pValue       = NULL;
+            e->nCost        = 0;
+            e->nFreq        = 0;
+            push(e, Q_GHOST);
+
+            // The ghost queue is limited by the number of entries with values
+            while (vQueues[Q_GHOST].nCount > nItems)
+            {
+                e               = vQueues[Q_GHOST].pHead;
+                unlink(e);
+                remove_entry(e);
+            }
+        }
+
+        bool raw_lru::evict_main()
+        {
+            queue_t *q      = &vQueues[Q_MAIN];
+
+            // Give the second chance to recently accessed entries
+            for (entry_t *e = q->pHead; e != NULL; e = q->pHead)
+            {
+                if (e->nFreq <= 0)
+                {
+                    evict_entry(e, false);
+                    return true;
+                }
+
+                --e->nFreq;
+                unlink(e);
+                push(e, Q_MAIN);
+            }
+
+            return false;
+        }
+
+        bool raw_lru::evict_small()
+        {
+            queue_t *q      = &vQueues[Q_SMALL];
+
+            // Promote accessed entries to the main queue, evict others to the ghost queue
+            for (entry_t *e = q->pHead; e != NULL; e = q->pHead)
+            {
+                if (e->nFreq <= 0)
+                {
+                    evict_entry(e, true);
+                    return true;
+                }
+
+                e->nFreq        = 0;
+                unlink(e);
+                push(e, Q_MAIN);
+            }
+
+            return false;
+        }
+
+        bool raw_lru::evict()
+        {
+            if (enPolicy != CACHE_S3FIFO)
+                return evict_main();
+
+            if ((vQueues[Q_SMALL].nCost > nBudget / 100 * SMALL_RATIO) || (vQueues[Q_MAIN].nCount <= 0))
+            {
+                if (evict_small())
+                    return true;
+            }
+
+            return (evict_main()) ? true : evict_small();
+        }
+
+        void raw_lru::make_room(size_t cost)
+        {
+            while ((nCost > nBudget) || (cost > nBudget - nCost))
+            {
+                if (!evict())
+                    break;
+            }
+        }
+
+        void raw_lru::set_budget(size_t budget)
+        {
+            nBudget         = budget;
+            make_room(0);
+        }
+
+        void *raw_lru::get(const void *key, void *dfl, bool update)
+        {
+            entry_t *e      = (nBins > 0) ? find(key, hash.hash(key, nKeySize), false) : NULL;
+            if (e == NULL)
+            {
+                if (update)
+                    ++nMisses;
+                return dfl;
+            }
+
+            if (update)
+            {
+                ++nHits;
+                touch(e);
+            }
+            return e->pValue;
+        }
+
+        bool raw_lru::put(const void *key, void *value, size_t cost, void **ov)
+        {
+            if ((value == NULL) || (cost > nBudget))
+                return false;
+
+            size_t h        = hash.hash(key, nKeySize);
+            entry_t *e      = find(key, h, enPolicy == CACHE_S3FIFO);
+
+            // Replace value of existing entry, the entry is excluded from eviction
+            if ((e != NULL) && (e->pKey != NULL))
+            {
+                size_t queue    = e->nQueue;
+                unlink(e);
+                make_room(cost);
+
+                if (ov != NULL)
+                    *ov             = e->pValue;
+                e->pValue       = value;
+                e->nCost        = cost;
+                push(e, queue);
+                return true;
+            }
+
+            // Create new entry or revive the ghost entry
+            void *k         = alloc.clone(key, nKeySize);
+            if (k == NULL)
+                return false;
+
+            size_t queue    = (enPolicy == CACHE_S3FIFO) ? Q_SMALL : Q_MAIN;
+            if (e != NULL)
+            {
+                unlink(e);
+                queue           = Q_MAIN;
+            }
+            else
+            {
+                if ((nEntries >= nBins) && (!grow()))
+                {
+                    alloc.free(k);
+                    return false;
+                }
+
+                e               = static_cast<entry_t *>(vPool.alloc());
+                if ((e == NULL) && (vPool.prefill(1)))
+                    e               = static_cast<entry_t *>(vPool.alloc());
+                if (e == NULL)
+                {
+                    alloc.free(k);
+                    return false;
+                }
+
+                entry_t **bin   = &vBins[h & (nBins - 1)];
+                e->pHNext       = *bin;
+                e->nHash        = h;
+                *bin            = e;
+                ++nEntries;
+            }
+
+            // The entry is not linked to any queue yet, so eviction does not touch it
+            make_room(cost);
+
+            e->pKey         = k;
+            e->pValue       = value;
+            e->nFreq        = 0;
+            e->nCost        = cost;
+            push(e, queue);
+            ++nItems;
+
+            if (ov != NULL)
+                *ov             = NULL;
+            return true;
+        }
+
+        bool raw_lru::remove(const void *key, void **ov)
+        {
+            entry_t *e      = (nBins > 0) ? find(key, hash.hash(key, nKeySize), false) : NULL;
+            if (e == NULL)
+                return false;
+
+            if (ov != NULL)
+                *ov             = e->pValue;
+            --nItems;
+            unlink(e);
+            remove_entry(e);
+
+            return true;
+        }
+    }
+}
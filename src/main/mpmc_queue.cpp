@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/mpmc_queue.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_mpmc_queue::init(size_t n_sizeof)
+        {
+            // Slot consists of sequence number and payload aligned to the size of sequence number
+            size_t stride   = sizeof(size_t) + n_sizeof;
+            stride          = (stride + sizeof(size_t) - 1) & (~(sizeof(size_t) - 1));
+
+            vData.init(stride);
+            nMask           = 0;
+            nSizeOf         = n_sizeof;
+            nHead           = 0;
+            nTail           = 0;
+        }
+
+        bool raw_mpmc_queue::reserve(size_t capacity)
+        {
+            if ((vData.vItems != NULL) && (capacity <= nMask + 1))
+                return true;
+
+            // Round capacity up to the power of two
+            size_t count    = nHead - nTail;
+            size_t cap      = 1;
+            while (cap < capacity)
+                cap           <<= 1;
+
+            // Allocate new storage
+            raw_darray tmp;
+            tmp.init(vData.nSizeOf);
+            if (!tmp.grow(cap))
+                return false;
+
+            // Move the data to the beginning of the new storage
+            size_t mask     = tmp.nCapacity - 1;
+            for (size_t i=0; i<count; ++i)
+            {
+                size_t *dst     = reinterpret_cast<size_t *>(&tmp.vItems[i * tmp.nSizeOf]);
+                size_t *src     = slot(nTail + i);
+                dst[0]          = i + 1;
+                ::memcpy(&dst[1], &src[1], nSizeOf);
+            }
+            for (size_t i=count; i<=mask; ++i)
+                *reinterpret_cast<size_t *>(&tmp.vItems[i * tmp.nSizeOf])  = i;
+
+            vData.swap(&tmp);
+            tmp.flush();
+
+            nMask           = mask;
+            nHead           = count;
+            nTail           = 0;
+
+            return true;
+        }
+
+        void raw_mpmc_queue::flush()
+        {
+            vData.flush();
+            nMask           = 0;
+            nHead           = 0;
+            nTail           = 0;
+        }
+
+        void raw_mpmc_queue::clear()
+        {
+            nHead           = 0;
+            nTail           = 0;
+            if (vData.vItems == NULL)
+                return;
+
+            for (size_t i=0; i<=nMask; ++i)
+                *slot(i)        = i;
+        }
+
+        size_t raw_mpmc_queue::size() const
+        {
+            size_t tail     = __atomic_load_n(&nTail, __ATOMIC_RELAXED);
+            size_t head     = __atomic_load_n(&nHead, __ATOMIC_RELAXED);
+            return (head > tail) ? head - tail : 0;
+        }
+
+        bool raw_mpmc_queue::push(const void *item)
+        {
+            if (vData.vItems == NULL)
+                return false;
+
+            size_t *s;
+            size_t pos      = __atomic_load_n(&nHead, __ATOMIC_RELAXED);
+
+            while (true)
+            {
+                s               = slot(pos);
+                size_t seq      = __atomic_load_n(s, __ATOMIC_ACQUIRE);
+                ssize_t diff    = ssize_t(seq) - ssize_t(pos);
+
+                if (diff == 0)
+                {
+                    // The slot is free, try to own it
+                    if (__atomic_compare_exchange_n(&nHead, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                        break;
+                }
+                else if (diff < 0)
+                    return false;   // The queue is full
+                else
+                    pos             = __atomic_load_n(&nHead, __ATOMIC_RELAXED);
+            }
+
+            // Write the payload and publish the slot for consumers
+            ::memcpy(&s[1], item, nSizeOf);
+            __atomic_store_n(s, pos + 1, __ATOMIC_RELEASE);
+
+            return true;
+        }
+
+        bool raw_mpmc_queue::pop(void *item)
+        {
+            if (vData.vItems == NULL)
+                return false;
+
+            size_t *s;
+            size_t pos      = __atomic_load_n(&nTail, __ATOMIC_RELAXED);
+
+            while (true)
+            {
+                s               = slot(pos);
+                size_t seq      = __atomic_load_n(s, __ATOMIC_ACQUIRE);
+                ssize_t diff    = ssize_t(seq) - ssize_t(pos + 1);
+
+                if (diff == 0)
+                {
+                    // The slot contains data, try to own it
+                    if (__atomic_compare_exchange_n(&nTail, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                        break;
+                }
+                else if (diff < 0)
+                    return false;   // The queue is empty
+                else
+                    pos             = __atomic_load_n(&nTail, __ATOMIC_RELAXED);
+            }
+
+            // Read the payload and release the slot for producers of the next lap
+            ::memcpy(item, &s[1], nSizeOf);
+            __atomic_store_n(s, pos + nMask + 1, __ATOMIC_RELEASE);
+
+            return true;
+        }
+    }
+}
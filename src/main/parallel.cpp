@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/parallel.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+#include <pthread.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        typedef struct chunk_t
+        {
+            pthread_t       thread;
+            parallel_func_t func;
+            void           *arg;
+            size_t          index;
+            size_t          first;
+            size_t          last;
+            bool            launched;
+        } chunk_t;
+
+        static void *chunk_main(void *arg)
+        {
+            chunk_t *c = static_cast<chunk_t *>(arg);
+            c->func(c->index, c->first, c->last, c->arg);
+            return NULL;
+        }
+
+        size_t parallel_for(size_t count, size_t threads, parallel_func_t func, void *arg)
+        {
+            if (count == 0)
+                return 0;
+            if (threads > count)
+                threads     = count;
+            if (threads <= 1)
+            {
+                func(0, 0, count, arg);
+                return 1;
+            }
+
+            chunk_t *vc = static_cast<chunk_t *>(::malloc(threads * sizeof(chunk_t)));
+            if (vc == NULL)
+            {
+                func(0, 0, count, arg);
+                return 1;
+            }
+
+            // Split the range and launch threads, chunk 0 is processed by the caller
+            size_t step = count / threads, rem = count % threads, first = 0;
+            for (size_t i=0; i<threads; ++i)
+            {
+                chunk_t *c      = &vc[i];
+                c->func         = func;
+                c->arg          = arg;
+                c->index        = i;
+                c->first        = first;
+                c->last         = first + step + ((i < rem) ? 1 : 0);
+                c->launched     = (i > 0) && (pthread_create(&c->thread, NULL, chunk_main, c) == 0);
+                first           = c->last;
+            }
+
+            // Process chunks that have not been launched
+            for (size_t i=0; i<threads; ++i)
+            {
+                chunk_t *c      = &vc[i];
+                if (!c->launched)
+                    func(c->index, c->first, c->last, c->arg);
+            }
+
+            // Wait for other threads
+            for (size_t i=1; i<threads; ++i)
+            {
+                chunk_t *c      = &vc[i];
+                if (c->launched)
+                    pthread_join(c->thread, NULL);
+            }
+
+            ::free(vc);
+
+            return threads;
+        }
+
+        typedef struct sort_context_t
+        {
+            uint8_t        *src;            // Source buffer
+            uint8_t        *dst;            // Destination buffer
+            size_t         *runs;           // Boundaries of sorted runs
+            size_t          nruns;          // Number of sorted runs
+            size_t          size;           // Size of element
+            parallel_cmp_t  cmp;            // Comparison function
+            void           *arg;            // Argument of comparison function
+        } sort_context_t;
+
+        static void sort_chunk(size_t thread, size_t first, size_t last, void *arg)
+        {
+            sort_context_t *ctx = static_cast<sort_context_t *>(arg);
+            lsp::qsort_r(&ctx->src[first * ctx->size], last - first, ctx->size, ctx->cmp, ctx->arg);
+            ctx->runs[thread + 1]   = last;
+        }
+
+        static inline void copy_item(uint8_t *dst, const uint8_t *src, size_t size)
+        {
+            switch (size)
+            {
+                case sizeof(uint32_t): *reinterpret_cast<uint32_t *>(dst) = *reinterpret_cast<const uint32_t *>(src); break;
+                case sizeof(uint64_t): *reinterpret_cast<uint64_t *>(dst) = *reinterpret_cast<const uint64_t *>(src); break;
+                default: ::memcpy(dst, src, size); break;
+            }
+        }
+
+        /**
+         * Compute the number of elements taken from run a when first d elements
+         * of merged runs a and b are produced, elements of a go first on ties
+         */
+        static size_t co_rank(const sort_context_t *ctx, const uint8_t *a, size_t na, const uint8_t *b, size_t nb, size_t d)
+        {
+            size_t lo = (d > nb) ? d - nb : 0;
+            size_t hi = (d < na) ? d : na;
+
+            while (lo < hi)
+            {
+                size_t i    = (lo + hi) >> 1;
+                size_t j    = d - i;
+                if ((j > 0) && (ctx->cmp(&a[i * ctx->size], &b[(j - 1) * ctx->size], ctx->arg) <= 0))
+                    lo          = i + 1;
+                else
+                    hi          = i;
+            }
+
+            return lo;
+        }
+
+        static void merge_chunk(size_t thread, size_t first, size_t last, void *arg)
+        {
+            sort_context_t *ctx = static_cast<sort_context_t *>(arg);
+            const size_t size   = ctx->size;
+
+            // Process all pairs of runs which intersect the output range [first, last)
+            for (size_t p=0; p < ctx->nruns; p += 2)
+            {
+                size_t start    = ctx->runs[p];
+                size_t mid      = ctx->runs[p + 1];
+                size_t end      = (p + 2 <= ctx->nruns) ? ctx->runs[p + 2] : mid;
+                if ((end <= first) || (start >= last))
+                    continue;
+
+                const uint8_t *a    = &ctx->src[start * size];
+                const uint8_t *b    = &ctx->src[mid * size];
+                size_t na           = mid - start;
+                size_t nb           = end - mid;
+                size_t d0           = ((first > start) ? first : start) - start;
+                size_t d1           = ((last < end) ? last : end) - start;
+
+                size_t i            = co_rank(ctx, a, na, b, nb, d0);
+                size_t j            = d0 - i;
+                size_t i1           = co_rank(ctx, a, na, b, nb, d1);
+                size_t j1           = d1 - i1;
+                uint8_t *dst        = &ctx->dst[(start + d0) * size];
+
+                while ((i < i1) && (j < j1))
+                {
+                    if (ctx->cmp(&a[i * size], &b[j * size], ctx->arg) <= 0)
+                        copy_item(dst, &a[(i++) * size], size);
+                    else
+                        copy_item(dst, &b[(j++) * size], size);
+                    dst    += size;
+                }
+                if (i < i1)
+                    ::memcpy(dst, &a[i * size], (i1 - i) * size);
+                else if (j < j1)
+                    ::memcpy(dst, &b[j * size], (j1 - j) * size);
+            }
+        }
+
+        void parallel_sort(void *base, size_t count, size_t size, parallel_cmp_t cmp, void *arg, size_t threads, size_t cutoff)
+        {
+            // Limit number of threads by the cutoff
+            if (cutoff < 1)
+                cutoff      = 1;
+            if (threads > count / cutoff)
+                threads     = count / cutoff;
+            if (threads <= 1)
+            {
+                lsp::qsort_r(base, count, size, cmp, arg);
+                return;
+            }
+
+            // Allocate scratch buffer and run boundaries
+            size_t bytes    = (count * size + sizeof(size_t) - 1) & (~(sizeof(size_t) - 1));
+            uint8_t *buf    = static_cast<uint8_t *>(::malloc(bytes + (threads + 1) * sizeof(size_t)));
+            if (buf == NULL)
+            {
+                lsp::qsort_r(base, count, size, cmp, arg);
+                return;
+            }
+
+            sort_context_t ctx;
+            ctx.src         = static_cast<uint8_t *>(base);
+            ctx.dst         = buf;
+            ctx.runs        = reinterpret_cast<size_t *>(&buf[bytes]);
+            ctx.size        = size;
+            ctx.cmp         = cmp;
+            ctx.arg         = arg;
+            ctx.runs[0]     = 0;
+
+            // Sort chunks
+            ctx.nruns       = parallel_for(count, threads, sort_chunk, &ctx);
+
+            // Merge pairs of runs until the single run remains
+            while (ctx.nruns > 1)
+            {
+                parallel_for(count, threads, merge_chunk, &ctx);
+
+                // Each pair of runs now is a single run
+                size_t n        = 0;
+                for (size_t i=0; i<ctx.nruns; i += 2)
+                    ctx.runs[n++]   = ctx.runs[i];
+                ctx.runs[n]     = count;
+                ctx.nruns       = n;
+
+                uint8_t *tmp    = ctx.src;
+                ctx.src         = ctx.dst;
+                ctx.dst         = tmp;
+            }
+
+            if (ctx.src != base)
+                ::memcpy(base, ctx.src, count * size);
+
+            ::free(buf);
+        }
+    }
+}
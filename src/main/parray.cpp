@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/lltl/search.h>
 #include <lsp-plug.in/stdlib/stdlib.h>
 
 namespace lsp
@@ -28,11 +29,19 @@ namespace lsp
     {
         inline size_t nonzero(size_t count, size_t n) { return ((count + n) > 0) ? n : 1; }
 
+        const iter_vtbl_t raw_parray::iterator_vtbl =
+        {
+            raw_parray::iter_advance,
+            raw_parray::iter_get,
+            raw_parray::iter_remove
+        };
+
         void raw_parray::init()
         {
             nItems      = 0;
             vItems      = NULL;
             nCapacity   = 0;
+            nChanges    = 0;
         }
 
         bool raw_parray::grow(size_t capacity)
@@ -48,6 +57,7 @@ namespace lsp
             // Update pointer and capacity
             vItems          = ptr;
             nCapacity       = capacity;
+            ++nChanges;
             return true;
         }
 
@@ -75,6 +85,7 @@ namespace lsp
             nCapacity       = capacity;
             if (nItems > capacity)
                 nItems          = capacity;
+            ++nChanges;
             return true;
         }
 
@@ -87,6 +98,7 @@ namespace lsp
             }
             nCapacity   = 0;
             nItems      = 0;
+            ++nChanges;
         }
 
         void raw_parray::swap(raw_parray *src)
@@ -94,6 +106,10 @@ namespace lsp
             raw_parray tmp = *this;
             *this   = *src;
             *src    = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->nChanges   = nChanges + 1;
+            nChanges        = tmp.nChanges + 1;
         }
 
         bool raw_parray::xswap(size_t i1, size_t i2)
@@ -111,8 +127,38 @@ namespace lsp
 
         ssize_t raw_parray::index_of(const void *ptr)
         {
-            for (size_t i=0; i<nItems; ++i)
-                if (vItems[i] == ptr)
+            return find_ptr(vItems, nItems, ptr);
+        }
+
+        size_t raw_parray::count(const void *ptr)
+        {
+            return count_ptr(vItems, nItems, ptr);
+        }
+
+        ssize_t raw_parray::find(const void *value, size_t first, sort_closure_t *c)
+        {
+            // NULL value matches only NULL elements
+            if (value == NULL)
+            {
+                if (first >= nItems)
+                    return -1;
+                ssize_t idx = find_ptr(&vItems[first], nItems - first, NULL);
+                return (idx >= 0) ? idx + first : -1;
+            }
+
+            for (size_t i=first; i<nItems; ++i)
+            {
+                const void *item = vItems[i];
+                if ((item != NULL) && (c->compare(item, value, c->size) == 0))
+                    return i;
+            }
+            return -1;
+        }
+
+        ssize_t raw_parray::find_if(pred_func_t f, void *arg, size_t first)
+        {
+            for (size_t i=first; i<nItems; ++i)
+                if (f(vItems[i], arg))
                     return i;
             return -1;
         }
@@ -152,6 +198,7 @@ namespace lsp
 
             ::memcpy(vItems, src, n * sizeof(void *));
             nItems          = n;
+            ++nChanges;
             return vItems;
         }
 
@@ -178,6 +225,7 @@ namespace lsp
 
             void **ptr      = &vItems[nItems];
             nItems         += n;
+            ++nChanges;
             return ptr;
         }
 
@@ -193,6 +241,7 @@ namespace lsp
 
             void **res      = &vItems[nItems];
             nItems          = size;
+            ++nChanges;
             *res            = ptr;
             return res;
         }
@@ -210,6 +259,7 @@ namespace lsp
 
             void **res      = &vItems[nItems];
             nItems         += n;
+            ++nChanges;
             ::memcpy(res, src, n * sizeof(void *));
             return res;
         }
@@ -231,6 +281,7 @@ namespace lsp
             if (index < nItems)
                 ::memmove(&res[n], res, (nItems - index) * sizeof(void *));
             nItems         += n;
+            ++nChanges;
             return res;
         }
 
@@ -250,6 +301,7 @@ namespace lsp
                 ::memmove(&res[1], res, (nItems - index) * sizeof(void *));
 
             nItems          ++;
+            ++nChanges;
             *res            = ptr;
             return res;
         }
@@ -273,13 +325,17 @@ namespace lsp
                 ::memmove(&res[n], res, (nItems - index) * sizeof(void *));
 
             nItems         += n;
+            ++nChanges;
             ::memcpy(res, src, n * sizeof(void *));
             return res;
         }
 
         void *raw_parray::pop()
         {
-            return (nItems > 0) ? vItems[--nItems] : NULL;
+            if (nItems <= 0)
+                return NULL;
+            ++nChanges;
+            return vItems[--nItems];
         }
 
         void **raw_parray::pop(void **dst)
@@ -287,12 +343,16 @@ namespace lsp
             if (nItems <= 0)
                 return NULL;
             *dst = vItems[--nItems];
+            ++nChanges;
             return dst;
         }
 
         void **raw_parray::pop(size_t n)
         {
-            return (nItems >= n) ? &vItems[nItems -= n] : NULL;
+            if (nItems < n)
+                return NULL;
+            ++nChanges;
+            return &vItems[nItems -= n];
         }
 
         void **raw_parray::pop(size_t n, void **dst)
@@ -300,6 +360,7 @@ namespace lsp
             if (nItems < n)
                 return NULL;
             nItems -= n;
+            ++nChanges;
             ::memcpy(dst, &vItems[nItems], n * sizeof(void *));
             return dst;
         }
@@ -312,7 +373,10 @@ namespace lsp
             size_t size = nItems - n;
             void **res = cs->append(n, &vItems[size]);
             if (res)
+            {
                 nItems = size;
+                ++nChanges;
+            }
             return res;
         }
 
@@ -325,6 +389,7 @@ namespace lsp
             if (tail < nItems)
                 ::memmove(&vItems[idx], &vItems[tail], (nItems - tail) * sizeof(void *));
             nItems     -= 1;
+            ++nChanges;
             return const_cast<void *>(ptr);
         }
 
@@ -340,6 +405,7 @@ namespace lsp
             if (tail < nItems)
                 ::memmove(&vItems[idx], &vItems[tail], (nItems - tail) * sizeof(void *));
             nItems     -= n;
+            ++nChanges;
             return true;
         }
 
@@ -356,6 +422,7 @@ namespace lsp
             if (tail < nItems)
                 ::memmove(&vItems[idx], &vItems[tail], (nItems - tail) * sizeof(void *));
             nItems     -= n;
+            ++nChanges;
             return dst;
         }
 
@@ -374,6 +441,7 @@ namespace lsp
                 if (tail < nItems)
                     ::memmove(&vItems[idx], &vItems[tail], (nItems - tail) * sizeof(void *));
                 nItems     -= n;
+                ++nChanges;
             }
             return res;
         }
@@ -387,6 +455,7 @@ namespace lsp
             if (last < nItems)
                 ::memmove(&vItems[idx], &vItems[last], (nItems - last) * sizeof(void *));
             nItems     -= 1;
+            ++nChanges;
             return res;
         }
 
@@ -399,6 +468,7 @@ namespace lsp
             if (idx < size)
                 vItems[idx] = vItems[size];
             nItems      = size;
+            ++nChanges;
             return res;
         }
 
@@ -410,6 +480,7 @@ namespace lsp
             if (last < nItems)
                 ::memmove(&vItems[idx], &vItems[last], (nItems - last) * sizeof(void *));
             nItems     -= n;
+            ++nChanges;
             return true;
         }
 
@@ -422,6 +493,7 @@ namespace lsp
             if (last < nItems)
                 ::memmove(&vItems[idx], &vItems[last], (nItems - last) * sizeof(void *));
             nItems     -= n;
+            ++nChanges;
             return dst;
         }
 
@@ -437,6 +509,7 @@ namespace lsp
                 if (last < nItems)
                     ::memmove(&vItems[idx], &vItems[last], (nItems - last) * sizeof(void *));
                 nItems     -= n;
+                ++nChanges;
             }
             return res;
         }
@@ -462,6 +535,7 @@ namespace lsp
         void raw_parray::qsort(sort_closure_t *c)
         {
             lsp::qsort_r(vItems, nItems, sizeof(void *), closure_cmp, c);
+            ++nChanges;
         }
 
         void raw_parray::qsort(cmp_func_t f)
@@ -473,8 +547,67 @@ namespace lsp
             } xf;
             xf.f = f;
             lsp::qsort_r(vItems, nItems, sizeof(void *), raw_cmp, xf.p);
+            ++nChanges;
         }
-    }
-}
 
+        void raw_parray::psort(sort_closure_t *c, size_t threads, size_t cutoff)
+        {
+            parallel_sort(vItems, nItems, sizeof(void *), closure_cmp, c, threads, cutoff);
+            ++nChanges;
+        }
+
+        void raw_parray::psort(cmp_func_t f, size_t threads, size_t cutoff)
+        {
+            union
+            {
+                cmp_func_t f;
+                void *p;
+            } xf;
+            xf.f = f;
+            parallel_sort(vItems, nItems, sizeof(void *), raw_cmp, xf.p, threads, cutoff);
+            ++nChanges;
+        }
 
+        raw_iterator raw_parray::iter()
+        {
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &nChanges;
+            it.change       = nChanges;
+            it.index        = 0;
+            it.limit        = 0;
+            it.item         = (nItems > 0) ? vItems : NULL;
+            return it;
+        }
+
+        void raw_parray::iter_advance(raw_iterator *i, size_t n)
+        {
+            raw_parray *self    = static_cast<raw_parray *>(i->container);
+            size_t left         = self->nItems - i->index;
+            if (n >= left)
+            {
+                i->index            = self->nItems;
+                i->item             = NULL;
+                return;
+            }
+
+            i->index           += n;
+            i->item             = &self->vItems[i->index];
+        }
+
+        void *raw_parray::iter_get(const raw_iterator *i)
+        {
+            return *static_cast<void **>(i->item);
+        }
+
+        void raw_parray::iter_remove(raw_iterator *i)
+        {
+            raw_parray *self    = static_cast<raw_parray *>(i->container);
+            self->iremove(i->index);
+
+            i->change           = self->nChanges;
+            i->item             = (i->index < self->nItems) ? &self->vItems[i->index] : NULL;
+        }
+    }
+}
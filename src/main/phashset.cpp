@@ -21,11 +21,19 @@
 
 #include <lsp-plug.in/lltl/phashset.h>
 #include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
 
 namespace lsp
 {
     namespace lltl
     {
+        const iter_vtbl_t raw_phashset::iterator_vtbl =
+        {
+            raw_phashset::iter_advance,
+            raw_phashset::iter_get,
+            raw_phashset::iter_remove
+        };
+
         void raw_phashset::destroy_bin(bin_t *bin)
         {
             for (tuple_t *curr = bin->data; curr != NULL; )
@@ -80,6 +88,7 @@ namespace lsp
                         curr->next  = NULL;
                         --bin->size;
                         --size;
+                        ++changes;
                         return curr;
                     }
                     pcurr   = &curr->next;
@@ -96,6 +105,7 @@ namespace lsp
                         curr->next  = NULL;
                         --bin->size;
                         --size;
+                        ++changes;
                         return curr;
                     }
                     pcurr   = &curr->next;
@@ -125,6 +135,7 @@ namespace lsp
             bin_t *bin      = &bins[hash & (cap - 1)];
             ++bin->size;
             ++size;
+            ++changes;
 
             tuple->hash     = hash;
             tuple->next     = bin->data;
@@ -192,6 +203,7 @@ namespace lsp
 
             // Split success
             cap         = ncap;
+            ++changes;
 
             return true;
         }
@@ -209,6 +221,7 @@ namespace lsp
 
             size    = 0;
             cap     = 0;
+            ++changes;
         }
 
         void raw_phashset::clear()
@@ -221,6 +234,7 @@ namespace lsp
             }
 
             size    = 0;
+            ++changes;
         }
 
         void raw_phashset::swap(raw_phashset *src)
@@ -228,6 +242,10 @@ namespace lsp
             raw_phashset tmp    = *this;
             *this               = *src;
             *src                = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->changes    = changes + 1;
+            changes         = tmp.changes + 1;
         }
 
         void *raw_phashset::get(const void *value, void *dfl)
@@ -345,7 +363,41 @@ namespace lsp
             return true;
         }
 
-        bool raw_phashset::values(raw_parray *v)
+        int raw_phashset::value_cmp(const void *a, const void *b, void *c)
+        {
+            const raw_phashset *self    = static_cast<const raw_phashset *>(c);
+            const void *va              = *static_cast<const void * const *>(a);
+            const void *vb              = *static_cast<const void * const *>(b);
+
+            // NULL values come first
+            if (va == NULL)
+                return (vb == NULL) ? 0 : -1;
+            else if (vb == NULL)
+                return 1;
+
+            ssize_t res = self->cmp.compare(va, vb, self->vsize);
+            return (res > 0) ? 1 : (res < 0) ? -1 : 0;
+        }
+
+        size_t raw_phashset::dump(void **v, size_t count, bool sort)
+        {
+            size_t n = 0;
+            if (count > size)
+                count = size;
+
+            for (size_t i=0; (i<cap) && (n<count); ++i)
+            {
+                for (tuple_t *t = bins[i].data; (t != NULL) && (n<count); t = t->next, ++n)
+                    v[n]    = t->value;
+            }
+
+            if (sort)
+                lsp::qsort_r(v, n, sizeof(void *), value_cmp, this);
+
+            return n;
+        }
+
+        bool raw_phashset::values(raw_parray *v, bool sort)
         {
             raw_parray kv;
 
@@ -355,21 +407,121 @@ namespace lsp
                 return false;
 
             // Make a snapshot
-            for (size_t i=0; i<cap; ++i)
+            kv.nItems   = dump(kv.vItems, size, sort);
+
+            // Return collection data
+            kv.swap(v);
+            kv.flush();
+
+            return true;
+        }
+
+        size_t raw_phashset::visit(visitor_t func, void *arg)
+        {
+            return visit(0, cap, func, arg);
+        }
+
+        size_t raw_phashset::visit(size_t first, size_t last, visitor_t func, void *arg)
+        {
+            size_t n = 0;
+            if (last > cap)
+                last    = cap;
+
+            for (size_t i=first; i<last; ++i)
+            {
                 for (tuple_t *t = bins[i].data; t != NULL; t = t->next)
                 {
-                    if (!kv.append(t->value))
+                    ++n;
+                    if (!func(t->value, arg))
+                        return n;
+                }
+            }
+
+            return n;
+        }
+
+        raw_iterator raw_phashset::iter(size_t first, size_t last)
+        {
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &changes;
+            it.change       = changes;
+            it.index        = 0;
+            it.limit        = (last < cap) ? last : cap;
+            it.item         = NULL;
+
+            // Lookup for the first non-empty bin
+            for (size_t i=first; i<it.limit; ++i)
+            {
+                if (bins[i].data != NULL)
+                {
+                    it.index        = i;
+                    it.item         = bins[i].data;
+                    break;
+                }
+            }
+
+            return it;
+        }
+
+        raw_iterator raw_phashset::iter()
+        {
+            return iter(0, cap);
+        }
+
+        void raw_phashset::iter_advance(raw_iterator *i, size_t n)
+        {
+            raw_phashset *self  = static_cast<raw_phashset *>(i->container);
+            tuple_t *t          = static_cast<tuple_t *>(i->item);
+
+            for ( ; n > 0; --n)
+            {
+                // Move to the next tuple, skip empty bins
+                t                   = t->next;
+                while (t == NULL)
+                {
+                    if ((++i->index) >= i->limit)
                     {
-                        kv.flush();
-                        return false;
+                        i->item             = NULL;
+                        return;
                     }
+                    t                   = self->bins[i->index].data;
                 }
+            }
 
-            // Return collection data
-            kv.swap(v);
-            kv.flush();
+            i->item             = t;
+        }
 
-            return true;
+        void *raw_phashset::iter_get(const raw_iterator *i)
+        {
+            return static_cast<tuple_t *>(i->item)->value;
+        }
+
+        void raw_phashset::iter_remove(raw_iterator *i)
+        {
+            raw_phashset *self  = static_cast<raw_phashset *>(i->container);
+            tuple_t *tuple      = static_cast<tuple_t *>(i->item);
+            bin_t *bin          = &self->bins[i->index];
+
+            // Advance iterator before the tuple becomes unlinked
+            iter_advance(i, 1);
+
+            // Unlink the tuple
+            for (tuple_t **pcurr = &bin->data; *pcurr != NULL; pcurr = &(*pcurr)->next)
+            {
+                if (*pcurr == tuple)
+                {
+                    *pcurr          = tuple->next;
+                    break;
+                }
+            }
+            --bin->size;
+            --self->size;
+            i->change           = ++self->changes;
+
+            // Free tuple data
+            ::free(tuple);
         }
     }
 }
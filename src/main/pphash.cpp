@@ -20,12 +20,27 @@
  */
 
 #include <lsp-plug.in/lltl/pphash.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
 #include <stdlib.h>
 
 namespace lsp
 {
     namespace lltl
     {
+        const iter_vtbl_t raw_pphash::key_iterator_vtbl =
+        {
+            raw_pphash::iter_advance,
+            raw_pphash::iter_get_key,
+            raw_pphash::iter_remove
+        };
+
+        const iter_vtbl_t raw_pphash::value_iterator_vtbl =
+        {
+            raw_pphash::iter_advance,
+            raw_pphash::iter_get_value,
+            raw_pphash::iter_remove
+        };
+
         void raw_pphash::destroy_bin(bin_t *bin)
         {
             for (tuple_t *curr = bin->data; curr != NULL; )
@@ -82,6 +97,7 @@ namespace lsp
                         curr->next  = NULL;
                         --bin->size;
                         --size;
+                        ++changes;
                         return curr;
                     }
                     pcurr   = &curr->next;
@@ -98,6 +114,7 @@ namespace lsp
                         curr->next  = NULL;
                         --bin->size;
                         --size;
+                        ++changes;
                         return curr;
                     }
                     pcurr   = &curr->next;
@@ -140,6 +157,7 @@ namespace lsp
             bin_t *bin      = &bins[hash & (cap - 1)];
             ++bin->size;
             ++size;
+            ++changes;
 
             tuple->hash     = hash;
             tuple->key      = kcopy;
@@ -208,6 +226,7 @@ namespace lsp
 
             // Split success
             cap         = ncap;
+            ++changes;
 
             return true;
         }
@@ -225,6 +244,7 @@ namespace lsp
 
             size    = 0;
             cap     = 0;
+            ++changes;
         }
 
         void raw_pphash::clear()
@@ -237,6 +257,7 @@ namespace lsp
             }
 
             size    = 0;
+            ++changes;
         }
 
         void raw_pphash::swap(raw_pphash *src)
@@ -244,6 +265,10 @@ namespace lsp
             raw_pphash tmp  = *this;
             *this           = *src;
             *src            = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->changes    = changes + 1;
+            changes         = tmp.changes + 1;
         }
 
         void *raw_pphash::get(const void *key, void *dfl)
@@ -339,7 +364,65 @@ namespace lsp
             return true;
         }
 
-        bool raw_pphash::keys(raw_parray *k)
+        int raw_pphash::key_cmp(const void *a, const void *b, void *c)
+        {
+            const raw_pphash *self  = static_cast<const raw_pphash *>(c);
+            const void *ka          = *static_cast<const void * const *>(a);
+            const void *kb          = *static_cast<const void * const *>(b);
+
+            // NULL keys come first
+            if (ka == NULL)
+                return (kb == NULL) ? 0 : -1;
+            else if (kb == NULL)
+                return 1;
+
+            ssize_t res = self->cmp.compare(ka, kb, self->ksize);
+            return (res > 0) ? 1 : (res < 0) ? -1 : 0;
+        }
+
+        size_t raw_pphash::dump(void **k, void **v, size_t count)
+        {
+            size_t n = 0;
+            if (count > size)
+                count = size;
+
+            for (size_t i=0; (i<cap) && (n<count); ++i)
+            {
+                for (tuple_t *t = bins[i].data; (t != NULL) && (n<count); t = t->next, ++n)
+                {
+                    if (k != NULL)
+                        k[n]    = t->key;
+                    if (v != NULL)
+                        v[n]    = t->value;
+                }
+            }
+
+            return n;
+        }
+
+        size_t raw_pphash::dump(pair_t *p, size_t count, bool sort)
+        {
+            size_t n = 0;
+            if (count > size)
+                count = size;
+
+            for (size_t i=0; (i<cap) && (n<count); ++i)
+            {
+                for (tuple_t *t = bins[i].data; (t != NULL) && (n<count); t = t->next, ++n)
+                {
+                    p[n].key    = t->key;
+                    p[n].value  = t->value;
+                }
+            }
+
+            // Key is the first field of the pair, so pairs can be compared as keys
+            if (sort)
+                lsp::qsort_r(p, n, sizeof(pair_t), key_cmp, this);
+
+            return n;
+        }
+
+        bool raw_pphash::keys(raw_parray *k, bool sort)
         {
             raw_parray kt;
 
@@ -349,15 +432,9 @@ namespace lsp
                 return false;
 
             // Make a snapshot
-            for (size_t i=0; i<cap; ++i)
-                for (tuple_t *t = bins[i].data; t != NULL; t = t->next)
-                {
-                    if (!kt.append(t->key))
-                    {
-                        kt.flush();
-                        return false;
-                    }
-                }
+            kt.nItems   = dump(kt.vItems, NULL, size);
+            if (sort)
+                lsp::qsort_r(kt.vItems, kt.nItems, sizeof(void *), key_cmp, this);
 
             // Return collection data
             kt.swap(k);
@@ -376,15 +453,7 @@ namespace lsp
                 return false;
 
             // Make a snapshot
-            for (size_t i=0; i<cap; ++i)
-                for (tuple_t *t = bins[i].data; t != NULL; t = t->next)
-                {
-                    if (!kv.append(t->value))
-                    {
-                        kv.flush();
-                        return false;
-                    }
-                }
+            kv.nItems   = dump(NULL, kv.vItems, size);
 
             // Return collection data
             kv.swap(v);
@@ -393,7 +462,7 @@ namespace lsp
             return true;
         }
 
-        bool raw_pphash::items(raw_parray *k, raw_parray *v)
+        bool raw_pphash::items(raw_parray *k, raw_parray *v, bool sort)
         {
             raw_parray kt, vt;
 
@@ -410,28 +479,189 @@ namespace lsp
             }
 
             // Make a snapshot
-            for (size_t i=0; i<cap; ++i)
-                for (tuple_t *t = bins[i].data; t != NULL; t = t->next)
+            if (sort)
+            {
+                pair_t *p = static_cast<pair_t *>(::malloc(sizeof(pair_t) * ((size > 0) ? size : 1)));
+                if (p == NULL)
                 {
-                    if ((!kt.append(t->key)) ||
-                        (!vt.append(t->value)))
-                    {
-                        kt.flush();
-                        vt.flush();
-                        return false;
-                    }
+                    kt.flush();
+                    vt.flush();
+                    return false;
+                }
+
+                size_t n    = dump(p, size, true);
+                for (size_t i=0; i<n; ++i)
+                {
+                    kt.vItems[i]    = p[i].key;
+                    vt.vItems[i]    = p[i].value;
                 }
+                kt.nItems   = n;
+                vt.nItems   = n;
+
+                ::free(p);
+            }
+            else
+            {
+                kt.nItems   = dump(kt.vItems, vt.vItems, size);
+                vt.nItems   = kt.nItems;
+            }
 
             // Return collection data
             kt.swap(k);
             vt.swap(v);
-
             kt.flush();
             vt.flush();
 
             return true;
         }
-    }
-}
 
+        bool raw_pphash::items(raw_darray *p, bool sort)
+        {
+            raw_darray pt;
+
+            // Initialize collection
+            pt.init(sizeof(pair_t), p->nAlign);
+            if (!pt.grow(size))
+                return false;
+
+            // Make a snapshot
+            pt.nItems   = dump(reinterpret_cast<pair_t *>(pt.vItems), size, sort);
+
+            // Return collection data
+            pt.swap(p);
+            pt.flush();
+
+            return true;
+        }
 
+        size_t raw_pphash::visit(visitor_t func, void *arg)
+        {
+            return visit(0, cap, func, arg);
+        }
+
+        size_t raw_pphash::visit(size_t first, size_t last, visitor_t func, void *arg)
+        {
+            size_t n = 0;
+            if (last > cap)
+                last    = cap;
+
+            for (size_t i=first; i<last; ++i)
+            {
+                for (tuple_t *t = bins[i].data; t != NULL; t = t->next)
+                {
+                    ++n;
+                    if (!func(t->key, t->value, arg))
+                        return n;
+                }
+            }
+
+            return n;
+        }
+
+        raw_iterator raw_pphash::iter(const iter_vtbl_t *vtbl, size_t first, size_t last)
+        {
+            raw_iterator it;
+            it.vtable       = vtbl;
+            it.container    = this;
+            it.changes      = &changes;
+            it.change       = changes;
+            it.index        = 0;
+            it.limit        = (last < cap) ? last : cap;
+            it.item         = NULL;
+
+            // Lookup for the first non-empty bin
+            for (size_t i=first; i<it.limit; ++i)
+            {
+                if (bins[i].data != NULL)
+                {
+                    it.index        = i;
+                    it.item         = bins[i].data;
+                    break;
+                }
+            }
+
+            return it;
+        }
+
+        raw_iterator raw_pphash::kiter()
+        {
+            return iter(&key_iterator_vtbl, 0, cap);
+        }
+
+        raw_iterator raw_pphash::kiter(size_t first, size_t last)
+        {
+            return iter(&key_iterator_vtbl, first, last);
+        }
+
+        raw_iterator raw_pphash::viter()
+        {
+            return iter(&value_iterator_vtbl, 0, cap);
+        }
+
+        raw_iterator raw_pphash::viter(size_t first, size_t last)
+        {
+            return iter(&value_iterator_vtbl, first, last);
+        }
+
+        void raw_pphash::iter_advance(raw_iterator *i, size_t n)
+        {
+            raw_pphash *self    = static_cast<raw_pphash *>(i->container);
+            tuple_t *t          = static_cast<tuple_t *>(i->item);
+
+            for ( ; n > 0; --n)
+            {
+                // Move to the next tuple, skip empty bins
+                t                   = t->next;
+                while (t == NULL)
+                {
+                    if ((++i->index) >= i->limit)
+                    {
+                        i->item             = NULL;
+                        return;
+                    }
+                    t                   = self->bins[i->index].data;
+                }
+            }
+
+            i->item             = t;
+        }
+
+        void *raw_pphash::iter_get_key(const raw_iterator *i)
+        {
+            return static_cast<tuple_t *>(i->item)->key;
+        }
+
+        void *raw_pphash::iter_get_value(const raw_iterator *i)
+        {
+            return static_cast<tuple_t *>(i->item)->value;
+        }
+
+        void raw_pphash::iter_remove(raw_iterator *i)
+        {
+            raw_pphash *self    = static_cast<raw_pphash *>(i->container);
+            tuple_t *tuple      = static_cast<tuple_t *>(i->item);
+            bin_t *bin          = &self->bins[i->index];
+
+            // Advance iterator before the tuple becomes unlinked
+            iter_advance(i, 1);
+
+            // Unlink the tuple
+            for (tuple_t **pcurr = &bin->data; *pcurr != NULL; pcurr = &(*pcurr)->next)
+            {
+                if (*pcurr == tuple)
+                {
+                    *pcurr          = tuple->next;
+                    break;
+                }
+            }
+            --bin->size;
+            --self->size;
+            i->change           = ++self->changes;
+
+            // Free tuple data
+            if (tuple->key != NULL)
+                self->alloc.free(tuple->key);
+            ::free(tuple);
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/rcu.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_rcu::init(free_func_t free)
+        {
+            pCurrent    = NULL;
+            nEpoch      = 1;
+            vReaders    = NULL;
+            pReaders    = NULL;
+            nReaders    = 0;
+            vRetired.init(sizeof(retired_t));
+            pFree       = free;
+        }
+
+        bool raw_rcu::reserve(size_t readers)
+        {
+            if (readers <= nReaders)
+                return true;
+
+            // Allocate cache-aligned slots
+            uint8_t *ptr    = static_cast<uint8_t *>(::malloc((readers + 1) * CACHE_LINE_SIZE));
+            if (ptr == NULL)
+                return false;
+            uint8_t *slots  = reinterpret_cast<uint8_t *>((reinterpret_cast<uintptr_t>(ptr) + CACHE_LINE_SIZE - 1) & (~uintptr_t(CACHE_LINE_SIZE - 1)));
+
+            // Copy state of existing readers, mark others as inactive
+            if (vReaders != NULL)
+                ::memcpy(slots, vReaders, nReaders * CACHE_LINE_SIZE);
+            for (size_t i=nReaders; i<readers; ++i)
+                *reinterpret_cast<size_t *>(&slots[i * CACHE_LINE_SIZE]) = 0;
+
+            if (pReaders != NULL)
+                ::free(pReaders);
+            vReaders    = slots;
+            pReaders    = ptr;
+            nReaders    = readers;
+
+            return true;
+        }
+
+        void raw_rcu::flush()
+        {
+            // Destroy retired objects
+            retired_t *r    = reinterpret_cast<retired_t *>(vRetired.vItems);
+            for (size_t i=0; i<vRetired.nItems; ++i)
+                pFree(r[i].ptr);
+            vRetired.flush();
+
+            // Destroy current object
+            if (pCurrent != NULL)
+            {
+                pFree(pCurrent);
+                pCurrent    = NULL;
+            }
+
+            // Destroy readers
+            if (pReaders != NULL)
+            {
+                ::free(pReaders);
+                pReaders    = NULL;
+            }
+            vReaders    = NULL;
+            nReaders    = 0;
+        }
+
+        void *raw_rcu::lock(size_t reader)
+        {
+            // Announce the epoch first, then read the pointer. Both operations are sequentially
+            // consistent, so the writer either sees the announcement or the reader sees the
+            // pointer published before the epoch has been advanced.
+            size_t *s       = slot(reader);
+            __atomic_store_n(s, __atomic_load_n(&nEpoch, __ATOMIC_SEQ_CST), __ATOMIC_SEQ_CST);
+            return __atomic_load_n(&pCurrent, __ATOMIC_SEQ_CST);
+        }
+
+        void raw_rcu::unlock(size_t reader)
+        {
+            __atomic_store_n(slot(reader), 0, __ATOMIC_RELEASE);
+        }
+
+        bool raw_rcu::publish(void *ptr)
+        {
+            // Reserve space for retired object first
+            retired_t *r    = reinterpret_cast<retired_t *>(vRetired.append(1));
+            if (r == NULL)
+                return false;
+
+            // Replace the object and advance the epoch
+            r->ptr          = __atomic_exchange_n(&pCurrent, ptr, __ATOMIC_SEQ_CST);
+            r->epoch        = __atomic_add_fetch(&nEpoch, 1, __ATOMIC_SEQ_CST);
+            if (r->ptr == NULL)
+                vRetired.pop(1);
+
+            reclaim();
+            return true;
+        }
+
+        size_t raw_rcu::reclaim()
+        {
+            if (vRetired.nItems <= 0)
+                return 0;
+
+            // Find the oldest epoch of active readers
+            size_t min      = __atomic_load_n(&nEpoch, __ATOMIC_SEQ_CST);
+            for (size_t i=0; i<nReaders; ++i)
+            {
+                size_t epoch    = __atomic_load_n(slot(i), __ATOMIC_SEQ_CST);
+                if ((epoch != 0) && (epoch < min))
+                    min             = epoch;
+            }
+
+            // Destroy objects retired not later than the oldest reader has started
+            retired_t *r    = reinterpret_cast<retired_t *>(vRetired.vItems);
+            size_t n        = 0;
+            for (size_t i=0; i<vRetired.nItems; ++i)
+            {
+                if (r[i].epoch <= min)
+                    pFree(r[i].ptr);
+                else
+                    r[n++]          = r[i];
+            }
+            vRetired.nItems = n;
+
+            return n;
+        }
+    }
+}
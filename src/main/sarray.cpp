@@ -0,0 +1,327 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/sarray.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        const iter_vtbl_t raw_sarray::iterator_vtbl =
+        {
+            raw_sarray::iter_advance,
+            raw_sarray::iter_get,
+            raw_sarray::iter_remove
+        };
+
+        void raw_sarray::init(size_t n_sizeof)
+        {
+            // Free slots store index of the next free slot
+            size_t stride   = (n_sizeof > sizeof(uint32_t)) ? n_sizeof : sizeof(uint32_t);
+            size_t items    = CHUNK_SIZE / stride;
+            if (items < MIN_ITEMS)
+                items           = MIN_ITEMS;
+
+            // Round number of items down to the power of two
+            size_t shift    = 0;
+            while ((size_t(2) << shift) <= items)
+                ++shift;
+
+            vChunks     = NULL;
+            vOrder      = NULL;
+            nChunks     = 0;
+            nChunkCap   = 0;
+            nItems      = 0;
+            nTail       = 0;
+            nFree       = NONE;
+            nSizeOf     = n_sizeof;
+            nStride     = stride;
+            nShift      = shift;
+            nMaskOff    = ((stride << shift) + sizeof(uint64_t) - 1) & (~(sizeof(uint64_t) - 1));
+            nChanges    = 0;
+        }
+
+        bool raw_sarray::add_chunk()
+        {
+            // Grow the chunk index
+            if (nChunks >= nChunkCap)
+            {
+                size_t cap      = (nChunkCap > 0) ? nChunkCap << 1 : size_t(MIN_CHUNKS);
+                uint8_t **chunks= static_cast<uint8_t **>(::realloc(vChunks, cap * sizeof(uint8_t *)));
+                if (chunks == NULL)
+                    return false;
+                vChunks         = chunks;
+
+                uint32_t *order = static_cast<uint32_t *>(::realloc(vOrder, cap * sizeof(uint32_t)));
+                if (order == NULL)
+                    return false;
+                vOrder          = order;
+                nChunkCap       = cap;
+            }
+
+            // Allocate chunk with empty bitmap
+            size_t items    = size_t(1) << nShift;
+            size_t words    = (items + 63) >> 6;
+            uint8_t *chunk  = static_cast<uint8_t *>(::malloc(nMaskOff + words * sizeof(uint64_t)));
+            if (chunk == NULL)
+                return false;
+            ::memset(&chunk[nMaskOff], 0, words * sizeof(uint64_t));
+
+            // Keep chunks ordered by address for index_of()
+            size_t first = 0, last = nChunks;
+            while (first < last)
+            {
+                size_t mid      = (first + last) >> 1;
+                if (vChunks[vOrder[mid]] < chunk)
+                    first           = mid + 1;
+                else
+                    last            = mid;
+            }
+            ::memmove(&vOrder[first + 1], &vOrder[first], (nChunks - first) * sizeof(uint32_t));
+            vOrder[first]   = uint32_t(nChunks);
+            vChunks[nChunks++]  = chunk;
+
+            return true;
+        }
+
+        bool raw_sarray::grow(size_t capacity)
+        {
+            while (this->capacity() < capacity)
+            {
+                if (!add_chunk())
+                    return false;
+            }
+            return true;
+        }
+
+        void raw_sarray::flush()
+        {
+            for (size_t i=0; i<nChunks; ++i)
+                ::free(vChunks[i]);
+            if (vChunks != NULL)
+            {
+                ::free(vChunks);
+                vChunks     = NULL;
+            }
+            if (vOrder != NULL)
+            {
+                ::free(vOrder);
+                vOrder      = NULL;
+            }
+
+            nChunks     = 0;
+            nChunkCap   = 0;
+            nItems      = 0;
+            nTail       = 0;
+            nFree       = NONE;
+            ++nChanges;
+        }
+
+        void raw_sarray::clear()
+        {
+            // Reset bitmaps of all used chunks but keep the memory
+            size_t chunks   = (nTail + (size_t(1) << nShift) - 1) >> nShift;
+            size_t words    = ((size_t(1) << nShift) + 63) >> 6;
+            for (size_t i=0; i<chunks; ++i)
+                ::memset(&vChunks[i][nMaskOff], 0, words * sizeof(uint64_t));
+
+            nItems      = 0;
+            nTail       = 0;
+            nFree       = NONE;
+            ++nChanges;
+        }
+
+        void raw_sarray::swap(raw_sarray *src)
+        {
+            raw_sarray tmp  = *this;
+            *this           = *src;
+            *src            = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->nChanges   = nChanges + 1;
+            nChanges        = tmp.nChanges + 1;
+        }
+
+        ssize_t raw_sarray::next(size_t idx) const
+        {
+            size_t step     = (nShift < 6) ? size_t(1) << nShift : 64;
+
+            while (idx < nTail)
+            {
+                uint64_t word   = *mask(idx) >> (idx & 0x3f);
+                if (word != 0)
+                {
+                    idx            += __builtin_ctzll(word);
+                    return (idx < nTail) ? idx : -1;
+                }
+                idx             = (idx | (step - 1)) + 1;
+            }
+
+            return -1;
+        }
+
+        ssize_t raw_sarray::index_of(const void *ptr) const
+        {
+            if ((ptr == NULL) || (nChunks <= 0))
+                return -1;
+            const uint8_t *p = static_cast<const uint8_t *>(ptr);
+
+            // Find the last chunk which address is not greater than the pointer
+            size_t first = 0, last = nChunks;
+            while (first < last)
+            {
+                size_t mid      = (first + last) >> 1;
+                if (vChunks[vOrder[mid]] <= p)
+                    first           = mid + 1;
+                else
+                    last            = mid;
+            }
+            if (first <= 0)
+                return -1;
+
+            size_t chunk    = vOrder[first - 1];
+            size_t off      = p - vChunks[chunk];
+            if ((off >= (nStride << nShift)) || ((off % nStride) != 0))
+                return -1;
+
+            size_t idx      = (chunk << nShift) + off / nStride;
+            return ((idx < nTail) && (used(idx))) ? idx : -1;
+        }
+
+        uint8_t *raw_sarray::append(const void *src, size_t *idx)
+        {
+            size_t index;
+            if (nFree != NONE)
+            {
+                // Reuse the free slot
+                index           = nFree;
+                ::memcpy(&nFree, slot(index), sizeof(uint32_t));
+            }
+            else
+            {
+                if (nTail >= NONE)
+                    return NULL;
+                if ((nTail >= capacity()) && (!add_chunk()))
+                    return NULL;
+                index           = nTail++;
+            }
+
+            *mask(index)   |= uint64_t(1) << (index & 0x3f);
+            ++nItems;
+            ++nChanges;
+
+            uint8_t *ptr    = slot(index);
+            if (src != NULL)
+                ::memcpy(ptr, src, nSizeOf);
+            if (idx != NULL)
+                *idx            = index;
+
+            return ptr;
+        }
+
+        uint8_t *raw_sarray::iremove(size_t idx, void *dst)
+        {
+            if ((idx >= nTail) || (!used(idx)))
+                return NULL;
+
+            uint8_t *ptr    = slot(idx);
+            if (dst != NULL)
+                ::memcpy(dst, ptr, nSizeOf);
+
+            *mask(idx)     &= ~(uint64_t(1) << (idx & 0x3f));
+            ++nChanges;
+
+            // Start from the beginning when the array becomes empty
+            if ((--nItems) <= 0)
+            {
+                nTail           = 0;
+                nFree           = NONE;
+            }
+            else
+            {
+                uint32_t next   = nFree;
+                ::memcpy(ptr, &next, sizeof(uint32_t));
+                nFree           = uint32_t(idx);
+            }
+
+            return (dst != NULL) ? static_cast<uint8_t *>(dst) : ptr;
+        }
+
+        uint8_t *raw_sarray::premove(const void *ptr, void *dst)
+        {
+            ssize_t idx     = index_of(ptr);
+            return (idx >= 0) ? iremove(idx, dst) : NULL;
+        }
+
+        raw_iterator raw_sarray::iter()
+        {
+            ssize_t idx     = next(0);
+
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &nChanges;
+            it.change       = nChanges;
+            it.index        = (idx >= 0) ? idx : 0;
+            it.limit        = nTail;
+            it.item         = (idx >= 0) ? slot(idx) : NULL;
+            return it;
+        }
+
+        void raw_sarray::iter_advance(raw_iterator *i, size_t n)
+        {
+            const raw_sarray *self  = static_cast<const raw_sarray *>(i->container);
+            ssize_t idx     = i->index;
+
+            for ( ; n > 0; --n)
+            {
+                idx             = self->next(idx + 1);
+                if (idx < 0)
+                {
+                    i->item         = NULL;
+                    return;
+                }
+            }
+
+            i->index        = idx;
+            i->item         = self->slot(idx);
+        }
+
+        void *raw_sarray::iter_get(const raw_iterator *i)
+        {
+            return i->item;
+        }
+
+        void raw_sarray::iter_remove(raw_iterator *i)
+        {
+            raw_sarray *self    = static_cast<raw_sarray *>(i->container);
+            size_t idx          = i->index;
+
+            // Advance iterator before the item is removed
+            iter_advance(i, 1);
+            self->iremove(idx, NULL);
+            i->limit            = self->nTail;
+            i->change           = self->nChanges;
+        }
+    }
+}
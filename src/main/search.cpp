@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/search.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#elif defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
+namespace lsp
+{
+    namespace lltl
+    {
+        // Each vectorized step processes 64 bytes of data
+        ssize_t find_u32(const uint32_t *v, size_t n, uint32_t value)
+        {
+            size_t i = 0;
+
+        #if defined(__SSE2__)
+            const __m128i x = _mm_set1_epi32(value);
+            for ( ; i + 16 <= n; i += 16)
+            {
+                __m128i a   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i])), x);
+                __m128i b   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 4])), x);
+                __m128i c   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 8])), x);
+                __m128i d   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 12])), x);
+                if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))))
+                    break;
+            }
+        #elif defined(__aarch64__)
+            const uint32x4_t x = vdupq_n_u32(value);
+            for ( ; i + 16 <= n; i += 16)
+            {
+                uint32x4_t a    = vceqq_u32(vld1q_u32(&v[i]), x);
+                uint32x4_t b    = vceqq_u32(vld1q_u32(&v[i + 4]), x);
+                uint32x4_t c    = vceqq_u32(vld1q_u32(&v[i + 8]), x);
+                uint32x4_t d    = vceqq_u32(vld1q_u32(&v[i + 12]), x);
+                if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))))
+                    break;
+            }
+        #endif
+
+            // Locate the element within the last block or process the tail
+            for ( ; i < n; ++i)
+                if (v[i] == value)
+                    return i;
+
+            return -1;
+        }
+
+        ssize_t find_u64(const uint64_t *v, size_t n, uint64_t value)
+        {
+            size_t i = 0;
+
+        #if defined(__SSE2__)
+            // SSE2 has no 64-bit comparison: both 32-bit halves should match
+            const __m128i x = _mm_set_epi32(uint32_t(value >> 32), uint32_t(value), uint32_t(value >> 32), uint32_t(value));
+            for ( ; i + 8 <= n; i += 8)
+            {
+                __m128i a   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i])), x);
+                __m128i b   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 2])), x);
+                __m128i c   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 4])), x);
+                __m128i d   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 6])), x);
+                a           = _mm_and_si128(a, _mm_shuffle_epi32(a, 0xb1));
+                b           = _mm_and_si128(b, _mm_shuffle_epi32(b, 0xb1));
+                c           = _mm_and_si128(c, _mm_shuffle_epi32(c, 0xb1));
+                d           = _mm_and_si128(d, _mm_shuffle_epi32(d, 0xb1));
+                if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))))
+                    break;
+            }
+        #elif defined(__aarch64__)
+            const uint64x2_t x = vdupq_n_u64(value);
+            for ( ; i + 8 <= n; i += 8)
+            {
+                uint64x2_t a    = vceqq_u64(vld1q_u64(&v[i]), x);
+                uint64x2_t b    = vceqq_u64(vld1q_u64(&v[i + 2]), x);
+                uint64x2_t c    = vceqq_u64(vld1q_u64(&v[i + 4]), x);
+                uint64x2_t d    = vceqq_u64(vld1q_u64(&v[i + 6]), x);
+                if (vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(vorrq_u64(a, b), vorrq_u64(c, d)))))
+                    break;
+            }
+        #endif
+
+            for ( ; i < n; ++i)
+                if (v[i] == value)
+                    return i;
+
+            return -1;
+        }
+
+        size_t count_u32(const uint32_t *v, size_t n, uint32_t value)
+        {
+            size_t i = 0, count = 0;
+
+        #if defined(__SSE2__)
+            const __m128i x = _mm_set1_epi32(value);
+            for ( ; i + 16 <= n; i += 16)
+            {
+                __m128i a   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i])), x);
+                __m128i b   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 4])), x);
+                __m128i c   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 8])), x);
+                __m128i d   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 12])), x);
+                // Each matching element gives 2 bits in the byte mask
+                count      += __builtin_popcount(_mm_movemask_epi8(_mm_packs_epi32(a, b))) +
+                              __builtin_popcount(_mm_movemask_epi8(_mm_packs_epi32(c, d)));
+            }
+            count     >>= 1;
+        #elif defined(__aarch64__)
+            const uint32x4_t x = vdupq_n_u32(value);
+            for ( ; i + 16 <= n; i += 16)
+            {
+                uint32x4_t a    = vshrq_n_u32(vceqq_u32(vld1q_u32(&v[i]), x), 31);
+                uint32x4_t b    = vshrq_n_u32(vceqq_u32(vld1q_u32(&v[i + 4]), x), 31);
+                uint32x4_t c    = vshrq_n_u32(vceqq_u32(vld1q_u32(&v[i + 8]), x), 31);
+                uint32x4_t d    = vshrq_n_u32(vceqq_u32(vld1q_u32(&v[i + 12]), x), 31);
+                count          += vaddvq_u32(vaddq_u32(vaddq_u32(a, b), vaddq_u32(c, d)));
+            }
+        #endif
+
+            for ( ; i < n; ++i)
+                if (v[i] == value)
+                    ++count;
+
+            return count;
+        }
+
+        size_t count_u64(const uint64_t *v, size_t n, uint64_t value)
+        {
+            size_t i = 0, count = 0;
+
+        #if defined(__SSE2__)
+            const __m128i x = _mm_set_epi32(uint32_t(value >> 32), uint32_t(value), uint32_t(value >> 32), uint32_t(value));
+            for ( ; i + 8 <= n; i += 8)
+            {
+                __m128i a   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i])), x);
+                __m128i b   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 2])), x);
+                __m128i c   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 4])), x);
+                __m128i d   = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&v[i + 6])), x);
+                a           = _mm_and_si128(a, _mm_shuffle_epi32(a, 0xb1));
+                b           = _mm_and_si128(b, _mm_shuffle_epi32(b, 0xb1));
+                c           = _mm_and_si128(c, _mm_shuffle_epi32(c, 0xb1));
+                d           = _mm_and_si128(d, _mm_shuffle_epi32(d, 0xb1));
+                // Each matching element gives 4 bits in the byte mask
+                count      += __builtin_popcount(_mm_movemask_epi8(_mm_packs_epi32(a, b))) +
+                              __builtin_popcount(_mm_movemask_epi8(_mm_packs_epi32(c, d)));
+            }
+            count     >>= 2;
+        #elif defined(__aarch64__)
+            const uint64x2_t x = vdupq_n_u64(value);
+            for ( ; i + 8 <= n; i += 8)
+            {
+                uint64x2_t a    = vshrq_n_u64(vceqq_u64(vld1q_u64(&v[i]), x), 63);
+                uint64x2_t b    = vshrq_n_u64(vceqq_u64(vld1q_u64(&v[i + 2]), x), 63);
+                uint64x2_t c    = vshrq_n_u64(vceqq_u64(vld1q_u64(&v[i + 4]), x), 63);
+                uint64x2_t d    = vshrq_n_u64(vceqq_u64(vld1q_u64(&v[i + 6]), x), 63);
+                count          += vaddvq_u64(vaddq_u64(vaddq_u64(a, b), vaddq_u64(c, d)));
+            }
+        #endif
+
+            for ( ; i < n; ++i)
+                if (v[i] == value)
+                    ++count;
+
+            return count;
+        }
+    }
+}
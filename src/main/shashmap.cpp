@@ -0,0 +1,334 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/shashmap.h>
+#include <pthread.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        /**
+         * Shard of the hash map: raw hash with its own lock
+         */
+        struct shard_t: public raw_pphash
+        {
+            pthread_rwlock_t    lock;
+
+            inline tuple_t *find(const void *key, size_t h)         { return find_tuple(key, h);        }
+            inline tuple_t *create(const void *key, size_t h)       { return create_tuple(key, h);      }
+            inline tuple_t *remove(const void *key, size_t h)       { return remove_tuple(key, h);      }
+        };
+
+        typedef struct visit_closure_t
+        {
+            raw_pphash::visitor_t   func;
+            void                   *arg;
+            bool                    stop;
+        } visit_closure_t;
+
+        static bool visit_shard(void *key, void *value, void *arg)
+        {
+            visit_closure_t *c  = static_cast<visit_closure_t *>(arg);
+            c->stop             = !c->func(key, value, c->arg);
+            return !c->stop;
+        }
+
+        static inline size_t shard_stride()
+        {
+            return (sizeof(shard_t) + CACHE_LINE_SIZE - 1) & (~(CACHE_LINE_SIZE - 1));
+        }
+
+        void *raw_shashmap::shard(size_t h)
+        {
+            // Multiplicative mixing, the shard is selected by the highest bits of the product
+            static const size_t mult = (sizeof(size_t) > 4) ? size_t(0x9e3779b97f4a7c15ULL) : size_t(0x9e3779b9UL);
+            size_t idx  = (nShards > 1) ? (h * mult) >> nShift : 0;
+            return &vShards[idx * shard_stride()];
+        }
+
+        bool raw_shashmap::init(size_t shards)
+        {
+            // Round number of shards up to the power of two
+            size_t n = 1, bits = 0;
+            while (n < shards)
+            {
+                n     <<= 1;
+                ++bits;
+            }
+
+            // Allocate aligned shards
+            size_t stride   = shard_stride();
+            uint8_t *ptr    = static_cast<uint8_t *>(::malloc((n + 1) * stride));
+            if (ptr == NULL)
+                return false;
+            uint8_t *data   = reinterpret_cast<uint8_t *>((reinterpret_cast<uintptr_t>(ptr) + CACHE_LINE_SIZE - 1) & (~uintptr_t(CACHE_LINE_SIZE - 1)));
+
+            for (size_t i=0; i<n; ++i)
+            {
+                shard_t *s      = reinterpret_cast<shard_t *>(&data[i * stride]);
+                s->size         = 0;
+                s->cap          = 0;
+                s->bins         = NULL;
+                s->ksize        = ksize;
+                s->hash         = hash;
+                s->cmp          = cmp;
+                s->alloc        = alloc;
+                s->changes      = 0;
+                pthread_rwlock_init(&s->lock, NULL);
+            }
+
+            // Replace previous shards
+            flush();
+            vShards     = data;
+            pData       = ptr;
+            nShards     = n;
+            nShift      = sizeof(size_t) * 8 - bits;
+
+            return true;
+        }
+
+        void raw_shashmap::flush()
+        {
+            if (pData == NULL)
+                return;
+
+            size_t stride   = shard_stride();
+            for (size_t i=0; i<nShards; ++i)
+            {
+                shard_t *s      = reinterpret_cast<shard_t *>(&vShards[i * stride]);
+                s->flush();
+                pthread_rwlock_destroy(&s->lock);
+            }
+
+            ::free(pData);
+            vShards     = NULL;
+            pData       = NULL;
+            nShards     = 0;
+            nShift      = 0;
+        }
+
+        void raw_shashmap::clear()
+        {
+            size_t stride   = shard_stride();
+            for (size_t i=0; i<nShards; ++i)
+            {
+                shard_t *s      = reinterpret_cast<shard_t *>(&vShards[i * stride]);
+                pthread_rwlock_wrlock(&s->lock);
+                s->clear();
+                pthread_rwlock_unlock(&s->lock);
+            }
+        }
+
+        size_t raw_shashmap::size()
+        {
+            size_t res      = 0;
+            size_t stride   = shard_stride();
+            for (size_t i=0; i<nShards; ++i)
+            {
+                shard_t *s      = reinterpret_cast<shard_t *>(&vShards[i * stride]);
+                pthread_rwlock_rdlock(&s->lock);
+                res            += s->size;
+                pthread_rwlock_unlock(&s->lock);
+            }
+            return res;
+        }
+
+        void *raw_shashmap::get(const void *key, void *dfl)
+        {
+            if (vShards == NULL)
+                return dfl;
+
+            size_t h        = (key != NULL) ? hash.hash(key, ksize) : 0;
+            shard_t *s      = static_cast<shard_t *>(shard(h));
+
+            pthread_rwlock_rdlock(&s->lock);
+            raw_pphash::tuple_t *tuple  = s->find(key, h);
+            void *res       = (tuple != NULL) ? tuple->value : dfl;
+            pthread_rwlock_unlock(&s->lock);
+
+            return res;
+        }
+
+        bool raw_shashmap::exists(const void *key)
+        {
+            if (vShards == NULL)
+                return false;
+
+            size_t h        = (key != NULL) ? hash.hash(key, ksize) : 0;
+            shard_t *s      = static_cast<shard_t *>(shard(h));
+
+            pthread_rwlock_rdlock(&s->lock);
+            bool res        = s->find(key, h) != NULL;
+            pthread_rwlock_unlock(&s->lock);
+
+            return res;
+        }
+
+        bool raw_shashmap::put(const void *key, void *value, void **ov)
+        {
+            if (vShards == NULL)
+                return false;
+
+            size_t h        = (key != NULL) ? hash.hash(key, ksize) : 0;
+            shard_t *s      = static_cast<shard_t *>(shard(h));
+            void *old       = NULL;
+
+            pthread_rwlock_wrlock(&s->lock);
+            raw_pphash::tuple_t *tuple  = s->find(key, h);
+            if (tuple == NULL)
+                tuple           = s->create(key, h);
+            else
+                old             = tuple->value;
+            if (tuple != NULL)
+                tuple->value    = value;
+            pthread_rwlock_unlock(&s->lock);
+
+            if (tuple == NULL)
+                return false;
+            if (ov != NULL)
+                *ov             = old;
+            return true;
+        }
+
+        bool raw_shashmap::create(const void *key, void *value)
+        {
+            if (vShards == NULL)
+                return false;
+
+            size_t h        = (key != NULL) ? hash.hash(key, ksize) : 0;
+            shard_t *s      = static_cast<shard_t *>(shard(h));
+
+            pthread_rwlock_wrlock(&s->lock);
+            raw_pphash::tuple_t *tuple  = s->find(key, h);
+            tuple           = (tuple == NULL) ? s->create(key, h) : NULL;
+            if (tuple != NULL)
+                tuple->value    = value;
+            pthread_rwlock_unlock(&s->lock);
+
+            return tuple != NULL;
+        }
+
+        bool raw_shashmap::replace(const void *key, void *value, void **ov)
+        {
+            if (vShards == NULL)
+                return false;
+
+            size_t h        = (key != NULL) ? hash.hash(key, ksize) : 0;
+            shard_t *s      = static_cast<shard_t *>(shard(h));
+            void *old       = NULL;
+
+            pthread_rwlock_wrlock(&s->lock);
+            raw_pphash::tuple_t *tuple  = s->find(key, h);
+            if (tuple != NULL)
+            {
+                old             = tuple->value;
+                tuple->value    = value;
+            }
+            pthread_rwlock_unlock(&s->lock);
+
+            if (tuple == NULL)
+                return false;
+            if (ov != NULL)
+                *ov             = old;
+            return true;
+        }
+
+        bool raw_shashmap::remove(const void *key, void **ov)
+        {
+            if (vShards == NULL)
+                return false;
+
+            size_t h        = (key != NULL) ? hash.hash(key, ksize) : 0;
+            shard_t *s      = static_cast<shard_t *>(shard(h));
+
+            pthread_rwlock_wrlock(&s->lock);
+            raw_pphash::tuple_t *tuple  = s->remove(key, h);
+            pthread_rwlock_unlock(&s->lock);
+
+            if (tuple == NULL)
+                return false;
+            if (ov != NULL)
+                *ov             = tuple->value;
+
+            // Free tuple data outside of the lock
+            if (tuple->key != NULL)
+                alloc.free(tuple->key);
+            ::free(tuple);
+            return true;
+        }
+
+        bool raw_shashmap::values(raw_parray *v)
+        {
+            raw_parray kv;
+            size_t stride   = shard_stride();
+
+            // Initialize collection
+            kv.init();
+            if (!kv.grow(size()))
+                return false;
+
+            // Make a snapshot shard by shard
+            for (size_t i=0; i<nShards; ++i)
+            {
+                shard_t *s      = reinterpret_cast<shard_t *>(&vShards[i * stride]);
+                pthread_rwlock_rdlock(&s->lock);
+
+                void **dst      = kv.append(s->size);
+                if (dst != NULL)
+                    s->dump(NULL, dst, s->size);
+
+                pthread_rwlock_unlock(&s->lock);
+
+                if (dst == NULL)
+                {
+                    kv.flush();
+                    return false;
+                }
+            }
+
+            // Return collection data
+            kv.swap(v);
+            kv.flush();
+
+            return true;
+        }
+
+        size_t raw_shashmap::visit(raw_pphash::visitor_t func, void *arg)
+        {
+            visit_closure_t c;
+            c.func          = func;
+            c.arg           = arg;
+            c.stop          = false;
+
+            size_t res      = 0;
+            size_t stride   = shard_stride();
+            for (size_t i=0; (i<nShards) && (!c.stop); ++i)
+            {
+                shard_t *s      = reinterpret_cast<shard_t *>(&vShards[i * stride]);
+                pthread_rwlock_rdlock(&s->lock);
+                res            += s->visit(visit_shard, &c);
+                pthread_rwlock_unlock(&s->lock);
+            }
+            return res;
+        }
+    }
+}
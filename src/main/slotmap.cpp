@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/slotmap.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        const iter_vtbl_t raw_slotmap::iterator_vtbl =
+        {
+            raw_slotmap::iter_advance,
+            raw_slotmap::iter_get,
+            raw_slotmap::iter_remove
+        };
+
+        void raw_slotmap::init(size_t n_sizeof)
+        {
+            vItems.init(n_sizeof);
+            vBack.init(sizeof(uint32_t));
+            vSlots.init(sizeof(slot_t));
+            nFree       = NONE;
+            nChanges    = 0;
+        }
+
+        bool raw_slotmap::grow(size_t capacity)
+        {
+            if ((capacity > vItems.nCapacity) && (!vItems.grow(capacity)))
+                return false;
+            if ((capacity > vBack.nCapacity) && (!vBack.grow(capacity)))
+                return false;
+            if ((capacity > vSlots.nCapacity) && (!vSlots.grow(capacity)))
+                return false;
+            return true;
+        }
+
+        void raw_slotmap::flush()
+        {
+            vItems.flush();
+            vBack.flush();
+            vSlots.flush();
+            nFree       = NONE;
+            ++nChanges;
+        }
+
+        void raw_slotmap::clear()
+        {
+            // Release all slots, generation change makes all handles stale
+            slot_t *s       = slots();
+            const uint32_t *b = back();
+            for (size_t i=0, n=vItems.nItems; i<n; ++i)
+            {
+                slot_t *x       = &s[b[i]];
+                if ((++x->nGen) == 0)
+                    x->nGen         = 1;
+                x->nIndex       = nFree;
+                nFree           = b[i];
+            }
+
+            vItems.nItems   = 0;
+            vBack.nItems    = 0;
+            ++nChanges;
+        }
+
+        void raw_slotmap::swap(raw_slotmap *src)
+        {
+            vItems.swap(&src->vItems);
+            vBack.swap(&src->vBack);
+            vSlots.swap(&src->vSlots);
+
+            uint32_t free   = nFree;
+            nFree           = src->nFree;
+            src->nFree      = free;
+
+            ++nChanges;
+            ++src->nChanges;
+        }
+
+        ssize_t raw_slotmap::index_of(slot_handle_t h) const
+        {
+            uint32_t slot   = uint32_t(h);
+            if (slot >= vSlots.nItems)
+                return -1;
+
+            // Free slots are detected by the back reference
+            const slot_t *s = &slots()[slot];
+            if ((s->nGen != uint32_t(h >> 32)) || (s->nIndex >= vItems.nItems))
+                return -1;
+
+            return (back()[s->nIndex] == slot) ? ssize_t(s->nIndex) : -1;
+        }
+
+        slot_handle_t raw_slotmap::handle_of(size_t idx) const
+        {
+            if (idx >= vItems.nItems)
+                return 0;
+
+            uint32_t slot   = back()[idx];
+            return make_handle(slot, slots()[slot].nGen);
+        }
+
+        uint8_t *raw_slotmap::append(const void *src, slot_handle_t *h)
+        {
+            size_t idx      = vItems.nItems;
+            if (idx >= NONE)
+                return NULL;
+
+            // Allocate space in dense arrays
+            uint8_t *ptr    = vItems.append(1);
+            if (ptr == NULL)
+                return NULL;
+            uint32_t *b     = reinterpret_cast<uint32_t *>(vBack.append(1));
+            if (b == NULL)
+            {
+                --vItems.nItems;
+                return NULL;
+            }
+
+            // Allocate slot
+            uint32_t slot;
+            slot_t *s;
+            if (nFree != NONE)
+            {
+                slot            = nFree;
+                s               = &slots()[slot];
+                nFree           = s->nIndex;
+            }
+            else
+            {
+                slot            = uint32_t(vSlots.nItems);
+                s               = reinterpret_cast<slot_t *>(vSlots.append(1));
+                if ((s == NULL) || (slot >= NONE))
+                {
+                    --vItems.nItems;
+                    --vBack.nItems;
+                    if (s != NULL)
+                        --vSlots.nItems;
+                    return NULL;
+                }
+                s->nGen         = 1;
+            }
+
+            s->nIndex       = uint32_t(idx);
+            *b              = slot;
+            if (src != NULL)
+                ::memcpy(ptr, src, vItems.nSizeOf);
+            if (h != NULL)
+                *h              = make_handle(slot, s->nGen);
+            ++nChanges;
+
+            return ptr;
+        }
+
+        uint8_t *raw_slotmap::iremove(size_t idx, void *dst)
+        {
+            size_t n        = vItems.nItems;
+            if (idx >= n)
+                return NULL;
+
+            size_t size     = vItems.nSizeOf;
+            uint8_t *ptr    = &vItems.vItems[idx * size];
+            uint32_t *b     = back();
+            slot_t *s       = slots();
+            uint32_t slot   = b[idx];
+
+            if (dst != NULL)
+                ::memcpy(dst, ptr, size);
+
+            // Move the last item to the place of the removed one
+            size_t last     = n - 1;
+            if (idx != last)
+            {
+                ::memcpy(ptr, &vItems.vItems[last * size], size);
+                b[idx]          = b[last];
+                s[b[idx]].nIndex= uint32_t(idx);
+            }
+            vItems.nItems   = last;
+            vBack.nItems    = last;
+
+            // Release the slot
+            slot_t *x       = &s[slot];
+            if ((++x->nGen) == 0)
+                x->nGen         = 1;
+            x->nIndex       = nFree;
+            nFree           = slot;
+            ++nChanges;
+
+            return (dst != NULL) ? static_cast<uint8_t *>(dst) : ptr;
+        }
+
+        uint8_t *raw_slotmap::remove(slot_handle_t h, void *dst)
+        {
+            ssize_t idx     = index_of(h);
+            return (idx >= 0) ? iremove(idx, dst) : NULL;
+        }
+
+        raw_iterator raw_slotmap::iter()
+        {
+            raw_iterator it;
+            it.vtable       = &iterator_vtbl;
+            it.container    = this;
+            it.changes      = &nChanges;
+            it.change       = nChanges;
+            it.index        = 0;
+            it.limit        = vItems.nItems;
+            it.item         = (vItems.nItems > 0) ? vItems.vItems : NULL;
+            return it;
+        }
+
+        void raw_slotmap::iter_advance(raw_iterator *i, size_t n)
+        {
+            const raw_slotmap *self = static_cast<const raw_slotmap *>(i->container);
+            i->index           += n;
+            i->item             = (i->index < self->vItems.nItems) ? &self->vItems.vItems[i->index * self->vItems.nSizeOf] : NULL;
+        }
+
+        void *raw_slotmap::iter_get(const raw_iterator *i)
+        {
+            return i->item;
+        }
+
+        void raw_slotmap::iter_remove(raw_iterator *i)
+        {
+            raw_slotmap *self   = static_cast<raw_slotmap *>(i->container);
+
+            // The last item takes place of the removed one, so the position does not change
+            self->iremove(i->index, NULL);
+            i->limit            = self->vItems.nItems;
+            i->change           = self->nChanges;
+            iter_advance(i, 0);
+        }
+    }
+}
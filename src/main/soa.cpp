@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/soa.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        typedef struct soa_sort_t
+        {
+            const uint8_t          *keys;
+            size_t                  size;
+            raw_soa::cmp_func_t     cmp;
+            void                   *arg;
+        } soa_sort_t;
+
+        static int soa_index_cmp(const void *a, const void *b, void *c)
+        {
+            const soa_sort_t *s = static_cast<const soa_sort_t *>(c);
+            size_t ia   = *static_cast<const size_t *>(a);
+            size_t ib   = *static_cast<const size_t *>(b);
+            ssize_t res = s->cmp(&s->keys[ia * s->size], &s->keys[ib * s->size], s->arg);
+            return (res > 0) ? 1 : (res < 0) ? -1 : 0;
+        }
+
+        void raw_soa::init(size_t fields, const size_t *sizes, size_t align)
+        {
+            // Alignment should be the power of two
+            size_t a        = MIN_FIELD_ALIGN;
+            while (a < align)
+                a             <<= 1;
+
+            nItems      = 0;
+            nCapacity   = 0;
+            nFields     = (fields < MAX_FIELDS) ? fields : size_t(MAX_FIELDS);
+            nAlign      = a;
+            nChanges    = 0;
+            pData       = NULL;
+
+            for (size_t i=0; i<MAX_FIELDS; ++i)
+            {
+                vSizes[i]   = (i < nFields) ? sizes[i] : 0;
+                vFields[i]  = NULL;
+            }
+        }
+
+        bool raw_soa::grow(size_t capacity)
+        {
+            if (capacity < 32)
+                capacity        = 32;
+            if (capacity < nItems)
+                capacity        = nItems;
+
+            // Allocate block with aligned array for each field
+            size_t total    = 0;
+            for (size_t i=0; i<nFields; ++i)
+                total          += align(vSizes[i] * capacity);
+
+            uint8_t *ptr    = static_cast<uint8_t *>(::malloc(total + nAlign));
+            if (ptr == NULL)
+                return false;
+            uint8_t *base   = reinterpret_cast<uint8_t *>((reinterpret_cast<uintptr_t>(ptr) + nAlign - 1) & (~uintptr_t(nAlign - 1)));
+
+            // Copy only existing items
+            for (size_t i=0; i<nFields; ++i)
+            {
+                if (nItems > 0)
+                    ::memcpy(base, vFields[i], nItems * vSizes[i]);
+                vFields[i]      = base;
+                base           += align(vSizes[i] * capacity);
+            }
+
+            if (pData != NULL)
+                ::free(pData);
+            pData           = ptr;
+            nCapacity       = capacity;
+            ++nChanges;
+
+            return true;
+        }
+
+        bool raw_soa::truncate(size_t capacity)
+        {
+            if (capacity > nCapacity)
+                return true;
+            if (capacity <= 0)
+            {
+                flush();
+                return true;
+            }
+
+            if (nItems > capacity)
+                nItems          = capacity;
+            return grow(capacity);
+        }
+
+        void raw_soa::flush()
+        {
+            if (pData != NULL)
+            {
+                ::free(pData);
+                pData       = NULL;
+            }
+            for (size_t i=0; i<nFields; ++i)
+                vFields[i]  = NULL;
+
+            nItems      = 0;
+            nCapacity   = 0;
+            ++nChanges;
+        }
+
+        void raw_soa::swap(raw_soa *src)
+        {
+            raw_soa tmp     = *this;
+            *this           = *src;
+            *src            = tmp;
+
+            // Modification counters are not exchanged and should be updated
+            src->nChanges   = nChanges + 1;
+            nChanges        = tmp.nChanges + 1;
+        }
+
+        ssize_t raw_soa::append(size_t n)
+        {
+            size_t size     = nItems + n;
+            if (size > nCapacity)
+            {
+                size_t dn       = nCapacity + ((n > 0) ? n : 1);
+                if (!grow(dn + (dn >> 1)))
+                    return -1;
+            }
+
+            ssize_t idx     = nItems;
+            nItems          = size;
+            ++nChanges;
+            return idx;
+        }
+
+        bool raw_soa::iremove(size_t idx, size_t n)
+        {
+            size_t last     = idx + n;
+            if ((last > nItems) || (last < idx))
+                return false;
+
+            for (size_t i=0; i<nFields; ++i)
+            {
+                size_t s        = vSizes[i];
+                ::memmove(&vFields[i][idx * s], &vFields[i][last * s], (nItems - last) * s);
+            }
+
+            nItems         -= n;
+            ++nChanges;
+            return true;
+        }
+
+        bool raw_soa::qremove(size_t idx)
+        {
+            if (idx >= nItems)
+                return false;
+
+            size_t last     = --nItems;
+            if (idx != last)
+            {
+                for (size_t i=0; i<nFields; ++i)
+                {
+                    size_t s        = vSizes[i];
+                    ::memcpy(&vFields[i][idx * s], &vFields[i][last * s], s);
+                }
+            }
+
+            ++nChanges;
+            return true;
+        }
+
+        bool raw_soa::xswap(size_t i1, size_t i2)
+        {
+            if ((i1 >= nItems) || (i2 >= nItems))
+                return false;
+            if (i1 == i2)
+                return true;
+
+            for (size_t i=0; i<nFields; ++i)
+            {
+                size_t s        = vSizes[i];
+                uint8_t *a      = &vFields[i][i1 * s];
+                uint8_t *b      = &vFields[i][i2 * s];
+                for (size_t j=0; j<s; ++j)
+                {
+                    uint8_t t       = a[j];
+                    a[j]            = b[j];
+                    b[j]            = t;
+                }
+            }
+
+            ++nChanges;
+            return true;
+        }
+
+        bool raw_soa::sort(size_t f, cmp_func_t cmp, void *arg)
+        {
+            if (f >= nFields)
+                return false;
+            if (nItems <= 1)
+                return true;
+
+            // Allocate permutation and temporary buffer for the largest field
+            size_t max      = 0;
+            for (size_t i=0; i<nFields; ++i)
+                max             = (vSizes[i] > max) ? vSizes[i] : max;
+
+            size_t *index   = static_cast<size_t *>(::malloc(nItems * (sizeof(size_t) + max)));
+            if (index == NULL)
+                return false;
+            uint8_t *tmp    = reinterpret_cast<uint8_t *>(&index[nItems]);
+
+            // Sort the permutation by the key field
+            for (size_t i=0; i<nItems; ++i)
+                index[i]        = i;
+
+            soa_sort_t s;
+            s.keys          = vFields[f];
+            s.size          = vSizes[f];
+            s.cmp           = cmp;
+            s.arg           = arg;
+            lsp::qsort_r(index, nItems, sizeof(size_t), soa_index_cmp, &s);
+
+            // Apply the permutation to each field
+            for (size_t i=0; i<nFields; ++i)
+            {
+                size_t size     = vSizes[i];
+                const uint8_t *src = vFields[i];
+                for (size_t j=0; j<nItems; ++j)
+                    ::memcpy(&tmp[j * size], &src[index[j] * size], size);
+                ::memcpy(vFields[i], tmp, nItems * size);
+            }
+
+            ::free(index);
+            ++nChanges;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/spsc_ring.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_spsc_ring::init(size_t n_sizeof)
+        {
+            vData.init(n_sizeof);
+            nMask       = 0;
+            nHead       = 0;
+            nTailCache  = 0;
+            nTail       = 0;
+            nHeadCache  = 0;
+        }
+
+        bool raw_spsc_ring::reserve(size_t capacity)
+        {
+            if ((vData.vItems != NULL) && (capacity <= nMask + 1))
+                return true;
+
+            // Round capacity up to the power of two
+            size_t count    = nHead - nTail;
+            size_t cap      = 1;
+            while (cap < capacity)
+                cap           <<= 1;
+
+            // Allocate new storage
+            raw_darray tmp;
+            tmp.init(vData.nSizeOf);
+            if (!tmp.grow(cap))
+                return false;
+
+            // Move the data to the beginning of the new storage
+            read(nTail, tmp.vItems, count);
+            vData.swap(&tmp);
+            tmp.flush();
+
+            nMask       = vData.nCapacity - 1;
+            nTail       = 0;
+            nTailCache  = 0;
+            nHead       = count;
+            nHeadCache  = count;
+
+            return true;
+        }
+
+        void raw_spsc_ring::flush()
+        {
+            vData.flush();
+            nMask       = 0;
+            clear();
+        }
+
+        void raw_spsc_ring::clear()
+        {
+            nHead       = 0;
+            nTailCache  = 0;
+            nTail       = 0;
+            nHeadCache  = 0;
+        }
+
+        size_t raw_spsc_ring::size() const
+        {
+            size_t tail     = __atomic_load_n(&nTail, __ATOMIC_ACQUIRE);
+            size_t head     = __atomic_load_n(&nHead, __ATOMIC_ACQUIRE);
+            return head - tail;
+        }
+
+        void raw_spsc_ring::write(size_t head, const uint8_t *src, size_t n)
+        {
+            if (n <= 0)
+                return;
+
+            // Copy data as at most two contiguous spans
+            size_t off      = head & nMask;
+            size_t part     = nMask + 1 - off;
+            if (part > n)
+                part            = n;
+
+            ::memcpy(&vData.vItems[off * vData.nSizeOf], src, part * vData.nSizeOf);
+            if (part < n)
+                ::memcpy(vData.vItems, &src[part * vData.nSizeOf], (n - part) * vData.nSizeOf);
+        }
+
+        void raw_spsc_ring::read(size_t tail, uint8_t *dst, size_t n)
+        {
+            if (n <= 0)
+                return;
+
+            // Copy data as at most two contiguous spans
+            size_t off      = tail & nMask;
+            size_t part     = nMask + 1 - off;
+            if (part > n)
+                part            = n;
+
+            ::memcpy(dst, &vData.vItems[off * vData.nSizeOf], part * vData.nSizeOf);
+            if (part < n)
+                ::memcpy(&dst[part * vData.nSizeOf], vData.vItems, (n - part) * vData.nSizeOf);
+        }
+
+        bool raw_spsc_ring::push(const void *item)
+        {
+            return push_n(item, 1) > 0;
+        }
+
+        size_t raw_spsc_ring::push_n(const void *items, size_t n)
+        {
+            if (vData.vItems == NULL)
+                return 0;
+
+            size_t head     = nHead;
+            size_t cap      = nMask + 1;
+
+            // Re-read the tail position only if cached one does not provide enough space
+            size_t avail    = cap - (head - nTailCache);
+            if (avail < n)
+            {
+                nTailCache      = __atomic_load_n(&nTail, __ATOMIC_ACQUIRE);
+                avail           = cap - (head - nTailCache);
+                if (n > avail)
+                    n               = avail;
+            }
+
+            write(head, static_cast<const uint8_t *>(items), n);
+            __atomic_store_n(&nHead, head + n, __ATOMIC_RELEASE);
+
+            return n;
+        }
+
+        bool raw_spsc_ring::pop(void *item)
+        {
+            return pop_n(item, 1) > 0;
+        }
+
+        size_t raw_spsc_ring::pop_n(void *items, size_t n)
+        {
+            size_t tail     = nTail;
+
+            // Re-read the head position only if cached one does not provide enough items
+            size_t avail    = nHeadCache - tail;
+            if (avail < n)
+            {
+                nHeadCache      = __atomic_load_n(&nHead, __ATOMIC_ACQUIRE);
+                avail           = nHeadCache - tail;
+                if (n > avail)
+                    n               = avail;
+            }
+
+            read(tail, static_cast<uint8_t *>(items), n);
+            __atomic_store_n(&nTail, tail + n, __ATOMIC_RELEASE);
+
+            return n;
+        }
+
+        void *raw_spsc_ring::front()
+        {
+            size_t tail     = nTail;
+            if (nHeadCache == tail)
+            {
+                nHeadCache      = __atomic_load_n(&nHead, __ATOMIC_ACQUIRE);
+                if (nHeadCache == tail)
+                    return NULL;
+            }
+
+            return &vData.vItems[(tail & nMask) * vData.nSizeOf];
+        }
+
+        bool raw_spsc_ring::skip(size_t n)
+        {
+            size_t tail     = nTail;
+            if ((nHeadCache - tail) < n)
+            {
+                nHeadCache      = __atomic_load_n(&nHead, __ATOMIC_ACQUIRE);
+                if ((nHeadCache - tail) < n)
+                    return false;
+            }
+
+            __atomic_store_n(&nTail, tail + n, __ATOMIC_RELEASE);
+            return true;
+        }
+    }
+}
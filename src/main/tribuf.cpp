@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/tribuf.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_tribuf::init()
+        {
+            nBack       = 0;
+            nMiddle     = 1;
+            nFront      = 2;
+        }
+
+        void raw_tribuf::publish()
+        {
+            // Give the back buffer to the consumer and take the middle one
+            size_t middle   = __atomic_exchange_n(&nMiddle, nBack | FRESH, __ATOMIC_ACQ_REL);
+            nBack           = middle & INDEX_MASK;
+        }
+
+        bool raw_tribuf::fetch()
+        {
+            // Take the middle buffer only if it contains the new frame
+            if (!(__atomic_load_n(&nMiddle, __ATOMIC_RELAXED) & FRESH))
+                return false;
+
+            size_t middle   = __atomic_exchange_n(&nMiddle, nFront, __ATOMIC_ACQ_REL);
+            nFront          = middle & INDEX_MASK;
+
+            return true;
+        }
+
+        bool raw_tribuf::pending() const
+        {
+            return __atomic_load_n(&nMiddle, __ATOMIC_RELAXED) & FRESH;
+        }
+    }
+}
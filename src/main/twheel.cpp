@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/twheel.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_twheel::init(size_t n_sizeof)
+        {
+            // Keep event data aligned to 8 bytes
+            vNodes.init((sizeof(node_t) + n_sizeof + 7) & ~size_t(7));
+            nSizeOf     = n_sizeof;
+            nTime       = 0;
+            clear();
+        }
+
+        bool raw_twheel::grow(size_t capacity)
+        {
+            return (capacity <= vNodes.nCapacity) ? true : vNodes.grow(capacity);
+        }
+
+        void raw_twheel::flush()
+        {
+            vNodes.flush();
+            clear();
+        }
+
+        void raw_twheel::clear()
+        {
+            vNodes.nItems   = 0;
+            nItems          = 0;
+            nFree           = NONE;
+            for (size_t i=0; i<LEVELS; ++i)
+                vMask[i]        = 0;
+            for (size_t i=0; i<BUCKETS; ++i)
+            {
+                vHead[i]        = NONE;
+                vTail[i]        = NONE;
+            }
+            ++vNodes.nChanges;
+        }
+
+        void raw_twheel::reset(uint64_t time)
+        {
+            clear();
+            nTime           = time;
+        }
+
+        uint32_t raw_twheel::bucket_of(uint64_t time) const
+        {
+            // Late events are placed to the current bucket of the lowest level
+            if (time <= nTime)
+                return nTime & (SLOTS - 1);
+
+            // Find the highest bit that differs from the current time
+            size_t level    = (63 - __builtin_clzll((unsigned long long)(time ^ nTime))) / BITS;
+            if (level >= LEVELS)
+                return OVERFLOW;
+
+            return level * SLOTS + ((time >> (level * BITS)) & (SLOTS - 1));
+        }
+
+        void raw_twheel::link(uint32_t idx, uint32_t bucket)
+        {
+            node_t *n       = node(idx);
+            uint32_t tail   = vTail[bucket];
+
+            n->nNext        = NONE;
+            n->nPrev        = tail;
+            n->nBucket      = bucket;
+
+            if (tail != NONE)
+                node(tail)->nNext   = idx;
+            else
+            {
+                vHead[bucket]       = idx;
+                if (bucket < OVERFLOW)
+                    vMask[bucket / SLOTS]  |= uint64_t(1) << (bucket & (SLOTS - 1));
+            }
+            vTail[bucket]   = idx;
+        }
+
+        void raw_twheel::unlink(uint32_t idx)
+        {
+            node_t *n       = node(idx);
+            uint32_t bucket = n->nBucket;
+
+            if (n->nPrev != NONE)
+                node(n->nPrev)->nNext   = n->nNext;
+            else
+                vHead[bucket]           = n->nNext;
+
+            if (n->nNext != NONE)
+                node(n->nNext)->nPrev   = n->nPrev;
+            else
+                vTail[bucket]           = n->nPrev;
+
+            if ((vHead[bucket] == NONE) && (bucket < OVERFLOW))
+                vMask[bucket / SLOTS]  &= ~(uint64_t(1) << (bucket & (SLOTS - 1)));
+
+            n->nBucket      = DETACHED;
+        }
+
+        void raw_twheel::cascade(uint32_t bucket)
+        {
+            // Detach the whole list and redistribute it, the order of events is preserved
+            uint32_t idx    = vHead[bucket];
+            vHead[bucket]   = NONE;
+            vTail[bucket]   = NONE;
+            if (bucket < OVERFLOW)
+                vMask[bucket / SLOTS]  &= ~(uint64_t(1) << (bucket & (SLOTS - 1)));
+
+            while (idx != NONE)
+            {
+                node_t *n       = node(idx);
+                uint32_t next   = n->nNext;
+                link(idx, bucket_of(n->nTime));
+                idx             = next;
+            }
+        }
+
+        uint64_t raw_twheel::min_time(uint32_t bucket)
+        {
+            uint64_t time   = ~uint64_t(0);
+            for (uint32_t idx = vHead[bucket]; idx != NONE; )
+            {
+                node_t *n       = node(idx);
+                if (n->nTime < time)
+                    time            = n->nTime;
+                idx             = n->nNext;
+            }
+            return time;
+        }
+
+        void raw_twheel::free_node(uint32_t idx)
+        {
+            node_t *n       = node(idx);
+            n->nNext        = nFree;
+            n->nBucket      = FREE;
+            nFree           = idx;
+        }
+
+        uint32_t raw_twheel::pop_node(uint64_t limit)
+        {
+            while (nItems > 0)
+            {
+                // Lowest level: the bucket index is the exact time
+                size_t cur      = nTime & (SLOTS - 1);
+                uint64_t mask   = vMask[0] & (~uint64_t(0) << cur);
+                if (mask != 0)
+                {
+                    uint64_t time   = (nTime & ~uint64_t(SLOTS - 1)) | __builtin_ctzll((unsigned long long)(mask));
+                    if (time >= limit)
+                        return NONE;
+
+                    nTime           = time;
+                    uint32_t idx    = vHead[time & (SLOTS - 1)];
+                    unlink(idx);
+                    --nItems;
+                    return idx;
+                }
+
+                // Upper levels: find the next non-empty bucket and redistribute it
+                bool found      = false;
+                for (size_t level=1; level<LEVELS; ++level)
+                {
+                    size_t shift    = level * BITS;
+                    cur             = (nTime >> shift) & (SLOTS - 1);
+                    if (cur >= SLOTS - 1)
+                        continue;
+                    mask            = vMask[level] & (~uint64_t(0) << (cur + 1));
+                    if (mask == 0)
+                        continue;
+
+                    size_t slot     = __builtin_ctzll((unsigned long long)(mask));
+                    uint64_t time   = (nTime & ~((uint64_t(1) << (shift + BITS)) - 1)) | (uint64_t(slot) << shift);
+                    if (time >= limit)
+                        return NONE;
+
+                    // The bucket starts before the limit but events may not, do not move
+                    // the current time if there is nothing to fetch
+                    if (min_time(level * SLOTS + slot) >= limit)
+                        return NONE;
+
+                    nTime           = time;
+                    cascade(level * SLOTS + slot);
+                    found           = true;
+                    break;
+                }
+                if (found)
+                    continue;
+
+                // Overflow bucket: move to the earliest event and redistribute
+                if (vHead[OVERFLOW] == NONE)
+                    return NONE;
+
+                uint64_t time   = min_time(OVERFLOW);
+                if (time >= limit)
+                    return NONE;
+
+                nTime           = time;
+                cascade(OVERFLOW);
+            }
+
+            return NONE;
+        }
+
+        void raw_twheel::seek(uint64_t time)
+        {
+            // All pending events are not earlier than the new time here
+            if (time <= nTime)
+                return;
+
+            uint64_t diff   = time ^ nTime;
+            nTime           = time;
+
+            // The top level has been changed: some overflow events may fall into levels now
+            if ((diff >> (LEVELS * BITS)) != 0)
+            {
+                cascade(OVERFLOW);
+                return;
+            }
+
+            // Redistribute current buckets of upper levels
+            for (size_t level=1; level<LEVELS; ++level)
+            {
+                uint32_t bucket = level * SLOTS + ((time >> (level * BITS)) & (SLOTS - 1));
+                if (vHead[bucket] != NONE)
+                    cascade(bucket);
+            }
+        }
+
+        uint8_t *raw_twheel::get(size_t h)
+        {
+            if (h >= vNodes.nItems)
+                return NULL;
+            node_t *n       = node(h);
+            return (n->nBucket < BUCKETS) ? data(n) : NULL;
+        }
+
+        ssize_t raw_twheel::insert(uint64_t time, const void *src)
+        {
+            uint32_t idx    = nFree;
+            node_t *n;
+
+            // Take the node from the pool or allocate new one
+            if (idx != NONE)
+            {
+                n               = node(idx);
+                nFree           = n->nNext;
+            }
+            else
+            {
+                if (vNodes.nItems >= NONE)
+                    return -1;
+                n               = reinterpret_cast<node_t *>(vNodes.append(1));
+                if (n == NULL)
+                    return -1;
+                idx             = vNodes.nItems - 1;
+            }
+
+            n->nTime        = time;
+            n->nReserved    = 0;
+            if (src != NULL)
+                ::memcpy(data(n), src, nSizeOf);
+            link(idx, bucket_of(time));
+            ++nItems;
+
+            return idx;
+        }
+
+        bool raw_twheel::cancel(size_t h, void *dst)
+        {
+            uint8_t *ptr    = get(h);
+            if (ptr == NULL)
+                return false;
+
+            if (dst != NULL)
+                ::memcpy(dst, ptr, nSizeOf);
+            unlink(h);
+            free_node(h);
+            --nItems;
+            ++vNodes.nChanges;
+
+            return true;
+        }
+
+        bool raw_twheel::pop(uint64_t limit, uint64_t *time, void *dst)
+        {
+            uint32_t idx    = pop_node(limit);
+            if (idx == NONE)
+                return false;
+
+            node_t *n       = node(idx);
+            if (time != NULL)
+                *time           = n->nTime;
+            if (dst != NULL)
+                ::memcpy(dst, data(n), nSizeOf);
+            free_node(idx);
+            ++vNodes.nChanges;
+
+            return true;
+        }
+
+        size_t raw_twheel::advance(uint64_t delta, visitor_t func, void *arg)
+        {
+            uint64_t limit  = nTime + delta;
+            size_t count    = 0;
+
+            for (uint32_t idx; (idx = pop_node(limit)) != NONE; )
+            {
+                ++count;
+                ++vNodes.nChanges;
+
+                // The node is detached, the visitor may insert new events but does not
+                // get the same node since it is returned to the pool after the call
+                bool next       = (func != NULL) ? func(node(idx)->nTime, data(node(idx)), arg) : true;
+                free_node(idx);
+                if (!next)
+                    return count;
+            }
+
+            seek(limit);
+            return count;
+        }
+    }
+}
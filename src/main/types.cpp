@@ -26,6 +26,100 @@ namespace lsp
 {
     namespace lltl
     {
+        ssize_t default_cmp_func(const void *a, const void *b, size_t size)
+        {
+            return ::memcmp(a, b, size);
+        }
+
+        ssize_t signed_cmp_func(const void *a, const void *b, size_t size)
+        {
+            int64_t va, vb;
+            switch (size)
+            {
+                case sizeof(int8_t):
+                    va = *static_cast<const int8_t *>(a);
+                    vb = *static_cast<const int8_t *>(b);
+                    break;
+                case sizeof(int16_t):
+                    va = *static_cast<const int16_t *>(a);
+                    vb = *static_cast<const int16_t *>(b);
+                    break;
+                case sizeof(int32_t):
+                    va = *static_cast<const int32_t *>(a);
+                    vb = *static_cast<const int32_t *>(b);
+                    break;
+                case sizeof(int64_t):
+                    va = *static_cast<const int64_t *>(a);
+                    vb = *static_cast<const int64_t *>(b);
+                    break;
+                default:
+                    return ::memcmp(a, b, size);
+            }
+
+            return (va > vb) ? 1 : (va < vb) ? -1 : 0;
+        }
+
+        ssize_t unsigned_cmp_func(const void *a, const void *b, size_t size)
+        {
+            uint64_t va, vb;
+            switch (size)
+            {
+                case sizeof(uint8_t):
+                    va = *static_cast<const uint8_t *>(a);
+                    vb = *static_cast<const uint8_t *>(b);
+                    break;
+                case sizeof(uint16_t):
+                    va = *static_cast<const uint16_t *>(a);
+                    vb = *static_cast<const uint16_t *>(b);
+                    break;
+                case sizeof(uint32_t):
+                    va = *static_cast<const uint32_t *>(a);
+                    vb = *static_cast<const uint32_t *>(b);
+                    break;
+                case sizeof(uint64_t):
+                    va = *static_cast<const uint64_t *>(a);
+                    vb = *static_cast<const uint64_t *>(b);
+                    break;
+                default:
+                    return ::memcmp(a, b, size);
+            }
+
+            return (va > vb) ? 1 : (va < vb) ? -1 : 0;
+        }
+
+        ssize_t float_cmp_func(const void *a, const void *b, size_t size)
+        {
+            // Map the binary representation to the signed integer with the same order:
+            // negative values have inverted order of the magnitude bits
+            int64_t va, vb;
+            switch (size)
+            {
+                case sizeof(int32_t):
+                {
+                    int32_t xa, xb;
+                    ::memcpy(&xa, a, sizeof(xa));
+                    ::memcpy(&xb, b, sizeof(xb));
+                    va = (xa < 0) ? int32_t(xa ^ 0x7fffffff) : xa;
+                    vb = (xb < 0) ? int32_t(xb ^ 0x7fffffff) : xb;
+                    break;
+                }
+                case sizeof(int64_t):
+                {
+                    ::memcpy(&va, a, sizeof(va));
+                    ::memcpy(&vb, b, sizeof(vb));
+                    if (va < 0)
+                        va ^= int64_t(~uint64_t(0) >> 1);
+                    if (vb < 0)
+                        vb ^= int64_t(~uint64_t(0) >> 1);
+                    break;
+                }
+                default:
+                    return ::memcmp(a, b, size);
+            }
+
+            return (va > vb) ? 1 : (va < vb) ? -1 : 0;
+        }
+
         size_t default_hash_func(const void *ptr, size_t size)
         {
             size_t v, hash = 0;
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/wsdeque.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        void raw_wsdeque::init()
+        {
+            nTop        = 0;
+            nBottom     = 0;
+            pArray      = NULL;
+            vRetired.init();
+        }
+
+        raw_wsdeque::array_t *raw_wsdeque::grow(array_t *a, ssize_t top, ssize_t bottom, size_t capacity)
+        {
+            // Round capacity up to the power of two
+            size_t cap      = 32;
+            while (cap < capacity)
+                cap           <<= 1;
+
+            // Allocate array and retire the previous one
+            if ((a != NULL) && (vRetired.append(a) == NULL))
+                return NULL;
+
+            array_t *na     = static_cast<array_t *>(::malloc(sizeof(array_t) + cap * sizeof(void *)));
+            if (na == NULL)
+            {
+                if (a != NULL)
+                    vRetired.pop();
+                return NULL;
+            }
+            na->nMask       = cap - 1;
+            na->vItems      = reinterpret_cast<void **>(&na[1]);
+
+            // Copy pointers that may still be accessed
+            if (a != NULL)
+            {
+                for (ssize_t i=top; i<bottom; ++i)
+                    __atomic_store_n(&na->vItems[i & na->nMask], __atomic_load_n(&a->vItems[i & a->nMask], __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+            }
+
+            __atomic_store_n(&pArray, na, __ATOMIC_RELEASE);
+            return na;
+        }
+
+        bool raw_wsdeque::reserve(size_t capacity)
+        {
+            array_t *a      = pArray;
+            if ((a != NULL) && (capacity <= a->nMask + 1))
+                return true;
+
+            ssize_t top     = __atomic_load_n(&nTop, __ATOMIC_ACQUIRE);
+            return grow(a, top, nBottom, capacity) != NULL;
+        }
+
+        void raw_wsdeque::flush()
+        {
+            for (size_t i=0; i<vRetired.nItems; ++i)
+                ::free(vRetired.vItems[i]);
+            vRetired.flush();
+
+            if (pArray != NULL)
+            {
+                ::free(pArray);
+                pArray      = NULL;
+            }
+            nTop        = 0;
+            nBottom     = 0;
+        }
+
+        size_t raw_wsdeque::size() const
+        {
+            ssize_t bottom  = __atomic_load_n(&nBottom, __ATOMIC_RELAXED);
+            ssize_t top     = __atomic_load_n(&nTop, __ATOMIC_RELAXED);
+            return (bottom > top) ? bottom - top : 0;
+        }
+
+        size_t raw_wsdeque::capacity() const
+        {
+            array_t *a      = __atomic_load_n(&pArray, __ATOMIC_ACQUIRE);
+            return (a != NULL) ? a->nMask + 1 : 0;
+        }
+
+        bool raw_wsdeque::push(void *item)
+        {
+            ssize_t bottom  = __atomic_load_n(&nBottom, __ATOMIC_RELAXED);
+            ssize_t top     = __atomic_load_n(&nTop, __ATOMIC_ACQUIRE);
+            array_t *a      = pArray;
+
+            if ((a == NULL) || (bottom - top > ssize_t(a->nMask)))
+            {
+                a               = grow(a, top, bottom, (a != NULL) ? (a->nMask + 1) << 1 : 0);
+                if (a == NULL)
+                    return false;
+            }
+
+            __atomic_store_n(&a->vItems[bottom & a->nMask], item, __ATOMIC_RELAXED);
+            __atomic_store_n(&nBottom, bottom + 1, __ATOMIC_RELEASE);
+
+            return true;
+        }
+
+        void *raw_wsdeque::pop()
+        {
+            array_t *a      = pArray;
+            if (a == NULL)
+                return NULL;
+
+            // Reserve the bottom item before looking at the top
+            ssize_t bottom  = __atomic_load_n(&nBottom, __ATOMIC_RELAXED) - 1;
+            __atomic_store_n(&nBottom, bottom, __ATOMIC_SEQ_CST);
+            ssize_t top     = __atomic_load_n(&nTop, __ATOMIC_SEQ_CST);
+
+            if (top > bottom)
+            {
+                // The deque is empty
+                __atomic_store_n(&nBottom, bottom + 1, __ATOMIC_RELAXED);
+                return NULL;
+            }
+
+            void *item      = __atomic_load_n(&a->vItems[bottom & a->nMask], __ATOMIC_RELAXED);
+            if (top == bottom)
+            {
+                // The last item, compete with thieves
+                if (!__atomic_compare_exchange_n(&nTop, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+                    item            = NULL;
+                __atomic_store_n(&nBottom, bottom + 1, __ATOMIC_RELAXED);
+            }
+
+            return item;
+        }
+
+        void *raw_wsdeque::steal()
+        {
+            while (true)
+            {
+                ssize_t top     = __atomic_load_n(&nTop, __ATOMIC_SEQ_CST);
+                ssize_t bottom  = __atomic_load_n(&nBottom, __ATOMIC_SEQ_CST);
+                if (top >= bottom)
+                    return NULL;
+
+                array_t *a      = __atomic_load_n(&pArray, __ATOMIC_ACQUIRE);
+                void *item      = __atomic_load_n(&a->vItems[top & a->nMask], __ATOMIC_RELAXED);
+                if (__atomic_compare_exchange_n(&nTop, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+                    return item;
+            }
+        }
+    }
+}
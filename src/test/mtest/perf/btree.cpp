@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/btree.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <stdlib.h>
+#include "perf.h"
+
+#define LOOKUPS             1000000
+#define RANGES              10000
+#define RANGE_SIZE          100
+#define MAX_SORTED_INSERT   50000
+
+MTEST_BEGIN("lltl.perf", btree)
+
+    typedef struct item_t
+    {
+        int         key;
+        int         value;
+    } item_t;
+
+    static ssize_t cmp_int(const void *a, const void *b, size_t size)
+    {
+        int ia = *static_cast<const int *>(a);
+        int ib = *static_cast<const int *>(b);
+        return (ia < ib) ? -1 : (ia > ib) ? 1 : 0;
+    }
+
+    static ssize_t cmp_item(const item_t *a, const item_t *b)
+    {
+        return (a->key < b->key) ? -1 : (a->key > b->key) ? 1 : 0;
+    }
+
+    // Sorted array: find the first item which key is not less than k
+    static size_t sorted_lower_bound(lltl::darray<item_t> &a, int k)
+    {
+        size_t first = 0, last = a.size();
+        const item_t *v = a.array();
+        while (first < last)
+        {
+            size_t mid      = (first + last) >> 1;
+            if (v[mid].key < k)
+                first           = mid + 1;
+            else
+                last            = mid;
+        }
+        return first;
+    }
+
+    void run(size_t count)
+    {
+        lltl::btree<int, int> t(cmp_int), l(cmp_int);
+        lltl::darray<item_t> a;
+        int *keys       = static_cast<int *>(malloc(count * sizeof(int)));
+        int *values     = static_cast<int *>(malloc(count * sizeof(int)));
+        MTEST_ASSERT((keys != NULL) && (values != NULL));
+
+        // Unique keys in random order
+        for (size_t i=0; i<count; ++i)
+            keys[i]     = i * 2;
+        for (size_t i=count; i>1; --i)
+        {
+            size_t j    = rand() % i;
+            int k       = keys[i-1];
+            keys[i-1]   = keys[j];
+            keys[j]     = k;
+        }
+
+        printf("%d items:\n", int(count));
+
+        // Insertion
+        double start = lltl::perf::now();
+        for (size_t i=0; i<count; ++i)
+            t.put(keys[i], keys[i]);
+        double tb = lltl::perf::now() - start;
+
+        if (count <= MAX_SORTED_INSERT)
+        {
+            start = lltl::perf::now();
+            for (size_t i=0; i<count; ++i)
+            {
+                item_t it   = { keys[i], keys[i] };
+                a.insert(sorted_lower_bound(a, it.key), &it);
+            }
+            double ta = lltl::perf::now() - start;
+            printf("  insert: btree %10.3f ops/ms, sorted darray %10.3f ops/ms\n",
+                count / tb * 1e-3, count / ta * 1e-3);
+        }
+        else
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                item_t it   = { keys[i], keys[i] };
+                a.add(&it);
+            }
+            a.qsort(cmp_item);
+            printf("  insert: btree %10.3f ops/ms\n", count / tb * 1e-3);
+        }
+
+        // Bulk load from sorted input
+        for (size_t i=0; i<count; ++i)
+        {
+            keys[i]     = i * 2;
+            values[i]   = i * 2;
+        }
+        start = lltl::perf::now();
+        MTEST_ASSERT(l.load(count, keys, values));
+        tb = lltl::perf::now() - start;
+        printf("  load:   btree %10.3f items/ms\n", count / tb * 1e-3);
+
+        // Lookup
+        size_t found = 0;
+        srand(1);
+        start = lltl::perf::now();
+        for (size_t i=0; i<LOOKUPS; ++i)
+            found      += (t.get(rand() % (count * 2)) != NULL);
+        tb = lltl::perf::now() - start;
+
+        srand(1);
+        start = lltl::perf::now();
+        for (size_t i=0; i<LOOKUPS; ++i)
+        {
+            int k       = rand() % (count * 2);
+            size_t idx  = sorted_lower_bound(a, k);
+            found      += (idx < a.size()) && (a.uget(idx)->key == k);
+        }
+        double ta = lltl::perf::now() - start;
+        printf("  lookup: btree %10.3f ops/ms, sorted darray %10.3f ops/ms (found %d)\n",
+            LOOKUPS / tb * 1e-3, LOOKUPS / ta * 1e-3, int(found));
+
+        // Range scan
+        int sum = 0;
+        srand(2);
+        start = lltl::perf::now();
+        for (size_t i=0; i<RANGES; ++i)
+        {
+            int first   = rand() % (count * 2);
+            for (lltl::btree<int, int>::iterator it = t.range(first, first + RANGE_SIZE * 2); it; ++it)
+                sum        += *it.get();
+        }
+        tb = lltl::perf::now() - start;
+
+        srand(2);
+        start = lltl::perf::now();
+        for (size_t i=0; i<RANGES; ++i)
+        {
+            int first   = rand() % (count * 2);
+            int last    = first + RANGE_SIZE * 2;
+            for (size_t idx = sorted_lower_bound(a, first); (idx < a.size()) && (a.uget(idx)->key < last); ++idx)
+                sum        += a.uget(idx)->value;
+        }
+        ta = lltl::perf::now() - start;
+        printf("  range:  btree %10.3f ranges/ms, sorted darray %10.3f ranges/ms (sum %d)\n",
+            RANGES / tb * 1e-3, RANGES / ta * 1e-3, sum & 0xff);
+
+        free(keys);
+        free(values);
+    }
+
+    MTEST_MAIN
+    {
+        static const size_t counts[] = { 1000, 10000, 50000, 1000000 };
+
+        for (size_t i=0; i<sizeof(counts)/sizeof(counts[0]); ++i)
+            run(counts[i]);
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/ddeque.h>
+#include "perf.h"
+
+#define OPERATIONS          2000000
+
+MTEST_BEGIN("lltl.perf", ddeque)
+
+    void run_darray(size_t depth)
+    {
+        lltl::darray<size_t> q;
+        size_t x, sum = 0;
+
+        for (size_t i=0; i<depth; ++i)
+            MTEST_ASSERT(q.push(&i) != NULL);
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<OPERATIONS; ++i)
+        {
+            q.push(&i);
+            q.shift(&x);
+            sum        += x;
+        }
+        double time = lltl::perf::now() - start;
+
+        printf("darray depth=%-6d: %10.3f ops/ms (sum=%d)\n",
+            int(depth), OPERATIONS / time * 1e-3, int(sum & 0xff));
+    }
+
+    void run_ddeque(size_t depth)
+    {
+        lltl::ddeque<size_t> q;
+        size_t x, sum = 0;
+
+        for (size_t i=0; i<depth; ++i)
+            MTEST_ASSERT(q.push(&i) != NULL);
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<OPERATIONS; ++i)
+        {
+            q.push(&i);
+            q.shift(&x);
+            sum        += x;
+        }
+        double time = lltl::perf::now() - start;
+
+        printf("ddeque depth=%-6d: %10.3f ops/ms (sum=%d)\n",
+            int(depth), OPERATIONS / time * 1e-3, int(sum & 0xff));
+    }
+
+    MTEST_MAIN
+    {
+        static const size_t depths[] = { 16, 1000, 10000 };
+
+        printf("FIFO of %d push+shift operations\n", int(OPERATIONS));
+        for (size_t i=0; i<sizeof(depths)/sizeof(depths[0]); ++i)
+        {
+            run_darray(depths[i]);
+            run_ddeque(depths[i]);
+        }
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/dheap.h>
+#include <stdlib.h>
+#include "perf.h"
+
+#define OPERATIONS          20000
+#define BATCH               100000
+
+MTEST_BEGIN("lltl.perf", dheap)
+
+    typedef struct event_t
+    {
+        uint64_t    time;
+        size_t      id;
+    } event_t;
+
+    static ssize_t cmp_event(const void *a, const void *b, size_t size)
+    {
+        const event_t *ea = static_cast<const event_t *>(a);
+        const event_t *eb = static_cast<const event_t *>(b);
+        return (ea->time < eb->time) ? -1 : (ea->time > eb->time) ? 1 : 0;
+    }
+
+    static ssize_t cmp_event_ptr(const event_t *a, const event_t *b)
+    {
+        return (a->time < b->time) ? -1 : (a->time > b->time) ? 1 : 0;
+    }
+
+    void run_sorted(size_t depth)
+    {
+        lltl::darray<event_t> q;
+        event_t ev;
+        uint64_t sum = 0;
+
+        srand(0);
+        for (size_t i=0; i<depth; ++i)
+        {
+            ev.time     = rand() % 10000;
+            ev.id       = i;
+            MTEST_ASSERT(q.add(&ev) != NULL);
+        }
+        q.qsort(cmp_event_ptr);
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<OPERATIONS; ++i)
+        {
+            MTEST_ASSERT(q.shift(&ev) != NULL);
+            sum        += ev.id;
+            ev.time    += rand() % 10000;
+            q.add(&ev);
+            q.qsort(cmp_event_ptr);
+        }
+        double time = lltl::perf::now() - start;
+
+        printf("darray+qsort depth=%-5d: %10.3f ops/ms (sum=%d)\n",
+            int(depth), OPERATIONS / time * 1e-3, int(sum & 0xff));
+    }
+
+    void run_heap(size_t depth)
+    {
+        lltl::dheap<event_t> q(cmp_event);
+        event_t ev;
+        uint64_t sum = 0;
+
+        srand(0);
+        for (size_t i=0; i<depth; ++i)
+        {
+            ev.time     = rand() % 10000;
+            ev.id       = i;
+            MTEST_ASSERT(q.push(&ev) >= 0);
+        }
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<OPERATIONS; ++i)
+        {
+            MTEST_ASSERT(q.pop(&ev) != NULL);
+            sum        += ev.id;
+            ev.time    += rand() % 10000;
+            q.push(&ev);
+        }
+        double time = lltl::perf::now() - start;
+
+        printf("dheap        depth=%-5d: %10.3f ops/ms (sum=%d)\n",
+            int(depth), OPERATIONS / time * 1e-3, int(sum & 0xff));
+    }
+
+    void run_batch(event_t *events)
+    {
+        lltl::darray<event_t> a;
+        lltl::dheap<event_t> h(cmp_event);
+        event_t ev;
+        uint64_t sa = 0, sh = 0;
+
+        MTEST_ASSERT(a.reserve(BATCH));
+        MTEST_ASSERT(h.reserve(BATCH));
+
+        // Sort the batch and consume in order
+        double start = lltl::perf::now();
+        MTEST_ASSERT(a.add_n(BATCH, events) != NULL);
+        a.qsort(cmp_event_ptr);
+        for (size_t i=0; i<BATCH; ++i)
+            sa         += a.uget(i)->id * i;
+        double ta = lltl::perf::now() - start;
+
+        // Heapify the batch and consume in order
+        start = lltl::perf::now();
+        MTEST_ASSERT(h.push_n(BATCH, events));
+        for (size_t i=0; i<BATCH; ++i)
+        {
+            h.pop(&ev);
+            sh         += ev.id * i;
+        }
+        double th = lltl::perf::now() - start;
+
+        printf("batch of %d events: qsort %.3f ms, heapify+pop %.3f ms (%s)\n",
+            int(BATCH), ta * 1e+3, th * 1e+3, (sa == sh) ? "same order" : "different order");
+    }
+
+    MTEST_MAIN
+    {
+        static const size_t depths[] = { 64, 1024, 4096 };
+
+        printf("Scheduling %d events over pending queue\n", int(OPERATIONS));
+        for (size_t i=0; i<sizeof(depths)/sizeof(depths[0]); ++i)
+        {
+            run_sorted(depths[i]);
+            run_heap(depths[i]);
+        }
+
+        event_t *events = static_cast<event_t *>(malloc(BATCH * sizeof(event_t)));
+        MTEST_ASSERT(events != NULL);
+        for (size_t i=0; i<BATCH; ++i)
+        {
+            events[i].time  = (uint64_t(rand()) << 16) ^ rand();
+            events[i].id    = i;
+        }
+        run_batch(events);
+        free(events);
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/freelist.h>
+#include <pthread.h>
+#include "perf.h"
+
+#define OPERATIONS          4000000
+#define BATCH               32
+#define MAX_THREADS         8
+
+MTEST_BEGIN("lltl.perf", freelist)
+
+    typedef struct event_t
+    {
+        uint32_t    id;
+        uint32_t    type;
+        float       value;
+        uint32_t    flags;
+        uint8_t     data[48];
+    } event_t;
+
+    typedef struct context_t
+    {
+        lltl::freelist<event_t>    *list;
+        size_t                      ops;
+    } context_t;
+
+    static void *malloc_worker(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        event_t *items[BATCH];
+
+        for (size_t i=0; i<ctx->ops; i += BATCH)
+        {
+            for (size_t j=0; j<BATCH; ++j)
+            {
+                items[j]        = static_cast<event_t *>(::malloc(sizeof(event_t)));
+                items[j]->id    = j;
+            }
+            for (size_t j=0; j<BATCH; ++j)
+                ::free(items[j]);
+        }
+        return NULL;
+    }
+
+    static void *freelist_worker(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        event_t *items[BATCH];
+
+        for (size_t i=0; i<ctx->ops; i += BATCH)
+        {
+            for (size_t j=0; j<BATCH; ++j)
+            {
+                items[j]        = ctx->list->alloc();
+                items[j]->id    = j;
+            }
+            for (size_t j=0; j<BATCH; ++j)
+                ctx->list->free(items[j]);
+        }
+        return NULL;
+    }
+
+    static void *bulk_worker(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        event_t *items[BATCH];
+
+        for (size_t i=0; i<ctx->ops; i += BATCH)
+        {
+            size_t n = ctx->list->drain(items, BATCH);
+            for (size_t j=0; j<n; ++j)
+                items[j]->id    = j;
+            ctx->list->fill(items, n);
+        }
+        return NULL;
+    }
+
+    double run(void *(*func)(void *), lltl::freelist<event_t> *list, size_t threads)
+    {
+        context_t ctx[MAX_THREADS];
+        pthread_t tid[MAX_THREADS];
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<threads; ++i)
+        {
+            ctx[i].list     = list;
+            ctx[i].ops      = OPERATIONS / threads;
+            MTEST_ASSERT(pthread_create(&tid[i], NULL, func, &ctx[i]) == 0);
+        }
+        for (size_t i=0; i<threads; ++i)
+            pthread_join(tid[i], NULL);
+
+        return OPERATIONS / (lltl::perf::now() - start) * 1e-6;
+    }
+
+    MTEST_MAIN
+    {
+        lltl::freelist<event_t> list;
+        MTEST_ASSERT(list.prefill(MAX_THREADS * BATCH));
+
+        printf("Allocating and freeing %d objects of size %d in batches of %d\n",
+            int(OPERATIONS), int(sizeof(event_t)), int(BATCH));
+
+        for (size_t threads=1; threads<=MAX_THREADS; threads <<= 1)
+        {
+            double malloc_speed     = run(malloc_worker, &list, threads);
+            double list_speed       = run(freelist_worker, &list, threads);
+            double bulk_speed       = run(bulk_worker, &list, threads);
+            printf("threads=%d: malloc/free %8.3f Mops/s, alloc/free %8.3f Mops/s, drain/fill %8.3f Mops/s\n",
+                int(threads), malloc_speed, list_speed, bulk_speed);
+        }
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/pphash.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include "perf.h"
+
+#define ITEMS           100000
+#define REPEATS         20
+
+MTEST_BEGIN("lltl.perf", hash_export)
+
+    typedef lltl::pair<char, char> pair_t;
+
+    static bool count_item(char *key, char *value, size_t *count)
+    {
+        *count     += (key != value);
+        return true;
+    }
+
+    MTEST_MAIN
+    {
+        char buf[32];
+        lltl::pphash<char, char> h;
+        lltl::parray<char> vk, vv;
+        lltl::darray<pair_t> vp;
+        pair_t *fp;
+        double start, time;
+
+        printf("Generating %d items...\n", int(ITEMS));
+        for (size_t i=0; i<ITEMS; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "%lx", long(i * 7919));
+            MTEST_ASSERT(h.put(buf, ::strdup(buf), NULL));
+        }
+        MTEST_ASSERT(fp = static_cast<pair_t *>(::malloc(sizeof(pair_t) * ITEMS)));
+
+        // Per-element append through iterators
+        start = lltl::perf::now();
+        for (size_t i=0; i<REPEATS; ++i)
+        {
+            vk.clear();
+            vv.clear();
+            for (lltl::iterator<char> it = h.keys(); it; ++it)
+                MTEST_ASSERT(vk.add(it.get()));
+            for (lltl::iterator<char> it = h.values(); it; ++it)
+                MTEST_ASSERT(vv.add(it.get()));
+        }
+        time = (lltl::perf::now() - start) * 1000.0 / REPEATS;
+        printf("iterator append:  %8.3f ms/snapshot\n", time);
+
+        // Export to parray
+        start = lltl::perf::now();
+        for (size_t i=0; i<REPEATS; ++i)
+            MTEST_ASSERT(h.items(&vk, &vv));
+        time = (lltl::perf::now() - start) * 1000.0 / REPEATS;
+        printf("items(parray):    %8.3f ms/snapshot\n", time);
+
+        // Export to darray of pairs
+        start = lltl::perf::now();
+        for (size_t i=0; i<REPEATS; ++i)
+            MTEST_ASSERT(h.items(&vp));
+        time = (lltl::perf::now() - start) * 1000.0 / REPEATS;
+        printf("items(darray):    %8.3f ms/snapshot\n", time);
+
+        // Export to flat buffer
+        start = lltl::perf::now();
+        for (size_t i=0; i<REPEATS; ++i)
+            MTEST_ASSERT(h.copy_items(fp, ITEMS) == ITEMS);
+        time = (lltl::perf::now() - start) * 1000.0 / REPEATS;
+        printf("copy_items():     %8.3f ms/snapshot\n", time);
+
+        // Sorted export to darray of pairs
+        start = lltl::perf::now();
+        for (size_t i=0; i<REPEATS; ++i)
+            MTEST_ASSERT(h.sorted_items(&vp));
+        time = (lltl::perf::now() - start) * 1000.0 / REPEATS;
+        printf("sorted_items():   %8.3f ms/snapshot\n", time);
+
+        // Visitor
+        size_t count = 0;
+        start = lltl::perf::now();
+        for (size_t i=0; i<REPEATS; ++i)
+            MTEST_ASSERT(h.visit(count_item, &count) == ITEMS);
+        time = (lltl::perf::now() - start) * 1000.0 / REPEATS;
+        printf("visit():          %8.3f ms/pass\n", time);
+        MTEST_ASSERT(count == ITEMS * REPEATS);
+
+        // Cleanup
+        ::free(fp);
+        MTEST_ASSERT(h.values(&vv));
+        for (size_t i=0; i<vv.size(); ++i)
+            ::free(vv.uget(i));
+    }
+
+MTEST_END
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/pphash.h>
+#include <lsp-plug.in/lltl/parallel.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include "perf.h"
+
+#define ITEMS           1000000
+#define MAX_THREADS     16
+#define REPEATS         10
+
+MTEST_BEGIN("lltl.perf", hash_scan)
+
+    typedef struct scan_t
+    {
+        lltl::pphash<char, char>   *hash;
+        size_t                      bins;
+        size_t                      threads;
+        size_t                      sum[MAX_THREADS];
+    } scan_t;
+
+    static void scan_range(size_t thread, size_t first, size_t last, void *arg)
+    {
+        scan_t *s   = static_cast<scan_t *>(arg);
+        size_t sum  = 0;
+
+        for (lltl::iterator<char> it = s->hash->values(first, last); it; ++it)
+            sum        += ::strlen(it.get());
+
+        s->sum[thread]  = sum;
+    }
+
+    MTEST_MAIN
+    {
+        char buf[32];
+        lltl::pphash<char, char> h;
+        scan_t s;
+
+        printf("Generating %d items...\n", int(ITEMS));
+        for (size_t i=0; i<ITEMS; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "%lx", long(i * 7919));
+            MTEST_ASSERT(h.put(buf, ::strdup(buf), NULL));
+        }
+
+        s.hash      = &h;
+        s.bins      = h.capacity();
+
+        double base = 0.0;
+        size_t check = 0;
+        for (size_t threads=1; threads<=MAX_THREADS; ++threads)
+        {
+            size_t total = 0;
+            double start = lltl::perf::now();
+            for (size_t i=0; i<REPEATS; ++i)
+            {
+                size_t n = lltl::parallel_for(s.bins, threads, scan_range, &s);
+                for (size_t j=0; j<n; ++j)
+                    total      += s.sum[j];
+            }
+            double time = (lltl::perf::now() - start) * 1000.0 / REPEATS;
+
+            if (threads == 1)
+            {
+                base        = time;
+                check       = total;
+            }
+            MTEST_ASSERT(total == check);
+
+            printf("threads=%2d: %8.3f ms/scan, speedup x%.2f\n",
+                int(threads), time, base / time);
+        }
+
+        for (lltl::iterator<char> it = h.values(); it; )
+        {
+            ::free(it.get());
+            it.remove();
+        }
+    }
+
+MTEST_END
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/ihash.h>
+#include <lsp-plug.in/lltl/pphash.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "perf.h"
+
+#define OPERATIONS          4000000
+
+MTEST_BEGIN("lltl.perf", ihash)
+
+    typedef struct object_t
+    {
+        char               *name;
+        lltl::ihook         sHook;
+    } object_t;
+
+    void run(size_t count)
+    {
+        object_t *v     = static_cast<object_t *>(malloc(count * sizeof(object_t)));
+        size_t *ops     = static_cast<size_t *>(malloc(OPERATIONS * sizeof(size_t)));
+        MTEST_ASSERT(v != NULL);
+        MTEST_ASSERT(ops != NULL);
+
+        for (size_t i=0; i<count; ++i)
+        {
+            v[i].name       = static_cast<char *>(malloc(16));
+            MTEST_ASSERT(v[i].name != NULL);
+            sprintf(v[i].name, "object-%d", int(i));
+        }
+        for (size_t i=0; i<OPERATIONS; ++i)
+            ops[i]          = rand() % count;
+
+        lltl::ihash<char, object_t> ih(&object_t::sHook, &object_t::name);
+        lltl::pphash<char, object_t> ph;
+        size_t found[2] = { 0, 0 };
+
+        // Objects are linked on first access and unlinked on second access
+        double start = lltl::perf::now();
+        for (size_t i=0; i<OPERATIONS; ++i)
+        {
+            object_t *x     = &v[ops[i]];
+            if (ih.get(x->name) != NULL)
+            {
+                ih.remove(x);
+                ++found[0];
+            }
+            else
+                ih.create(x);
+        }
+        double t_ihash = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t i=0; i<OPERATIONS; ++i)
+        {
+            object_t *x     = &v[ops[i]];
+            if (ph.get(x->name) != NULL)
+            {
+                ph.remove(x->name, NULL);
+                ++found[1];
+            }
+            else
+                ph.create(x->name, x);
+        }
+        double t_pphash = lltl::perf::now() - start;
+
+        MTEST_ASSERT(found[0] == found[1]);
+        MTEST_ASSERT(ih.size() == ph.size());
+
+        printf("%8d %10.2f %10.2f %8.2f\n",
+            int(count),
+            OPERATIONS / (t_ihash * 1e+6),
+            OPERATIONS / (t_pphash * 1e+6),
+            t_pphash / t_ihash);
+
+        ih.flush();
+        ph.flush();
+        for (size_t i=0; i<count; ++i)
+            free(v[i].name);
+        free(ops);
+        free(v);
+    }
+
+    MTEST_MAIN
+    {
+        srand(0);
+        printf("%8s %10s %10s %8s\n", "objects", "ihash", "pphash", "speedup");
+        printf("%8s %10s %10s %8s\n", "", "Mop/s", "Mop/s", "");
+        for (size_t count = 100; count <= 1000000; count *= 10)
+            run(count);
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/lru.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "perf.h"
+
+#define KEYS                100000
+#define REQUESTS            2000000
+#define SCAN_PERIOD         100000
+#define SCAN_SIZE           20000
+
+MTEST_BEGIN("lltl.perf", lru)
+
+    static const char *policy_name(lltl::cache_policy_t policy)
+    {
+        switch (policy)
+        {
+            case lltl::CACHE_LRU:       return "LRU";
+            case lltl::CACHE_CLOCK:     return "CLOCK";
+            case lltl::CACHE_S3FIFO:    return "S3-FIFO";
+            default: break;
+        }
+        return "unknown";
+    }
+
+    // Generate skewed (Zipf-like) request stream with periodic one-time scans
+    static void generate(size_t *requests)
+    {
+        size_t scan = KEYS;
+        for (size_t i=0; i<REQUESTS; ++i)
+        {
+            if ((i % SCAN_PERIOD) < SCAN_SIZE)
+            {
+                // Scan over keys that are never accessed again
+                requests[i]     = scan++;
+                continue;
+            }
+
+            double u        = (rand() + 1.0) / (RAND_MAX + 2.0);
+            requests[i]     = size_t(pow(double(KEYS), u)) - 1;
+        }
+    }
+
+    void run(lltl::cache_policy_t policy, size_t budget, char **keys, const size_t *requests)
+    {
+        lltl::lru<char, char> c(policy);
+        c.set_budget(budget);
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<REQUESTS; ++i)
+        {
+            char *key = keys[requests[i]];
+            if (c.get(key) == NULL)
+                c.put(key, key, 1);
+        }
+        double time = lltl::perf::now() - start;
+
+        printf("%-8s %8d %10.2f %12.1f\n",
+            policy_name(policy), int(budget),
+            (c.hits() * 100.0) / (c.hits() + c.misses()),
+            REQUESTS / (time * 1e+6));
+    }
+
+    MTEST_MAIN
+    {
+        static const lltl::cache_policy_t policies[] =
+        {
+            lltl::CACHE_LRU,
+            lltl::CACHE_CLOCK,
+            lltl::CACHE_S3FIFO
+        };
+        size_t nkeys    = KEYS + (REQUESTS / SCAN_PERIOD + 1) * SCAN_SIZE;
+        char **keys     = static_cast<char **>(malloc(nkeys * sizeof(char *)));
+        size_t *reqs    = static_cast<size_t *>(malloc(REQUESTS * sizeof(size_t)));
+        MTEST_ASSERT(keys != NULL);
+        MTEST_ASSERT(reqs != NULL);
+
+        for (size_t i=0; i<nkeys; ++i)
+        {
+            keys[i]         = static_cast<char *>(malloc(16));
+            MTEST_ASSERT(keys[i] != NULL);
+            sprintf(keys[i], "key-%d", int(i));
+        }
+
+        srand(0);
+        generate(reqs);
+
+        printf("%-8s %8s %10s %12s\n", "policy", "budget", "hit ratio", "Mreq/s");
+        for (size_t budget=1000; budget <= 100000; budget *= 10)
+            for (size_t i=0; i<sizeof(policies)/sizeof(policies[0]); ++i)
+                run(policies[i], budget, keys, reqs);
+
+        for (size_t i=0; i<nkeys; ++i)
+            free(keys[i]);
+        free(keys);
+        free(reqs);
+    }
+
+MTEST_END
+
+
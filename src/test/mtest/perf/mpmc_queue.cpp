@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/mpmc_queue.h>
+#include <pthread.h>
+#include <sched.h>
+#include "perf.h"
+
+#define MAX_THREADS         32
+#define OPERATIONS          4000000
+#define QUEUE_SIZE          4096
+
+MTEST_BEGIN("lltl.perf", mpmc_queue)
+
+    typedef struct job_t
+    {
+        uint32_t    id;
+        uint32_t    file;
+        uint64_t    offset;
+    } job_t;
+
+    typedef struct context_t
+    {
+        lltl::mpmc_queue<job_t>    *dqueue;
+        lltl::pmpmc_queue<job_t>   *pqueue;
+        job_t                      *jobs;
+        size_t                      ops;
+    } context_t;
+
+    // Each worker pushes and pops jobs in turn, like a worker of a pool that spawns subtasks
+    static void *data_worker(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        job_t job;
+        job.id      = 0;
+        job.file    = 0;
+        job.offset  = 0;
+
+        for (size_t i=0; i<ctx->ops; ++i)
+        {
+            while (!ctx->dqueue->push(&job))
+                sched_yield();
+            while (!ctx->dqueue->pop(&job))
+                sched_yield();
+        }
+
+        return NULL;
+    }
+
+    static void *ptr_worker(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        job_t *job = ctx->jobs;
+
+        for (size_t i=0; i<ctx->ops; ++i)
+        {
+            while (!ctx->pqueue->push(job))
+                sched_yield();
+            while ((job = ctx->pqueue->pop()) == NULL)
+                sched_yield();
+        }
+
+        return NULL;
+    }
+
+    void run(const char *title, void *(*func)(void *), size_t threads)
+    {
+        lltl::mpmc_queue<job_t> dq;
+        lltl::pmpmc_queue<job_t> pq;
+        job_t jobs[MAX_THREADS];
+        context_t ctx[MAX_THREADS];
+        pthread_t tid[MAX_THREADS];
+
+        MTEST_ASSERT(dq.reserve(QUEUE_SIZE));
+        MTEST_ASSERT(pq.reserve(QUEUE_SIZE));
+
+        for (size_t i=0; i<threads; ++i)
+        {
+            ctx[i].dqueue   = &dq;
+            ctx[i].pqueue   = &pq;
+            ctx[i].jobs     = &jobs[i];
+            ctx[i].ops      = OPERATIONS / threads;
+        }
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<threads; ++i)
+            MTEST_ASSERT(pthread_create(&tid[i], NULL, func, &ctx[i]) == 0);
+        for (size_t i=0; i<threads; ++i)
+            pthread_join(tid[i], NULL);
+        double time = lltl::perf::now() - start;
+
+        printf("%s threads=%2d: %8.3f Mops/s\n", title, int(threads), 2.0 * OPERATIONS / time * 1e-6);
+    }
+
+    MTEST_MAIN
+    {
+        for (size_t threads=1; threads<=MAX_THREADS; threads <<= 1)
+            run("data   ", data_worker, threads);
+        for (size_t threads=1; threads<=MAX_THREADS; threads <<= 1)
+            run("pointer", ptr_worker, threads);
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_MTEST_PERF_PERF_H_
+#define TEST_MTEST_PERF_PERF_H_
+
+#include <time.h>
+
+namespace lsp
+{
+    namespace lltl
+    {
+        namespace perf
+        {
+            /**
+             * Get the monotonic wall-clock time. Performance tests measure
+             * multithreaded code, so the CPU time can not be used
+             * @return time in seconds
+             */
+            inline double now()
+            {
+                struct timespec ts;
+                clock_gettime(CLOCK_MONOTONIC, &ts);
+                return ts.tv_sec + ts.tv_nsec * 1e-9;
+            }
+        } /* namespace perf */
+    } /* namespace lltl */
+} /* namespace lsp */
+
+#endif /* TEST_MTEST_PERF_PERF_H_ */
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include "perf.h"
+
+#define ITEMS               (1 << 22)
+#define MAX_THREADS         16
+
+namespace
+{
+    static ssize_t double_cmp(const double *a, const double *b)
+    {
+        return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
+    }
+}
+
+MTEST_BEGIN("lltl.perf", psort)
+
+    void fill(lltl::darray<double> *a)
+    {
+        double *v       = a->array();
+        uint32_t seed   = 1;
+        for (size_t i=0; i<ITEMS; ++i)
+        {
+            seed        = seed * 1103515245 + 12345;
+            v[i]        = double(seed) * 1e-3;
+        }
+    }
+
+    void check(lltl::darray<double> *a)
+    {
+        for (size_t i=1; i<ITEMS; ++i)
+            MTEST_ASSERT(*a->uget(i-1) <= *a->uget(i));
+    }
+
+    MTEST_MAIN
+    {
+        lltl::darray<double> a;
+        lltl::parray<double> p;
+        MTEST_ASSERT(a.append_n(ITEMS) != NULL);
+        MTEST_ASSERT(p.reserve(ITEMS));
+
+        printf("Sorting %d elements\n", int(ITEMS));
+
+        fill(&a);
+        double start = lltl::perf::now();
+        a.qsort(double_cmp);
+        double base = lltl::perf::now() - start;
+        check(&a);
+        printf("darray qsort:            %8.3f ms\n", base * 1e+3);
+
+        for (size_t threads=1; threads<=MAX_THREADS; threads <<= 1)
+        {
+            fill(&a);
+            start       = lltl::perf::now();
+            a.psort(double_cmp, threads);
+            double time = lltl::perf::now() - start;
+            check(&a);
+            printf("darray psort threads=%2d: %8.3f ms, speedup %.2f\n", int(threads), time * 1e+3, base / time);
+        }
+
+        // Sort pointers to shuffled elements
+        fill(&a);
+        p.clear();
+        for (size_t i=0; i<ITEMS; ++i)
+            MTEST_ASSERT(p.add(a.uget(i)));
+
+        start = lltl::perf::now();
+        p.qsort(double_cmp);
+        base = lltl::perf::now() - start;
+        printf("parray qsort:            %8.3f ms\n", base * 1e+3);
+
+        for (size_t threads=1; threads<=MAX_THREADS; threads <<= 1)
+        {
+            p.clear();
+            for (size_t i=0; i<ITEMS; ++i)
+                MTEST_ASSERT(p.add(a.uget(i)));
+
+            start       = lltl::perf::now();
+            p.psort(double_cmp, threads);
+            double time = lltl::perf::now() - start;
+            for (size_t i=1; i<ITEMS; ++i)
+                MTEST_ASSERT(*p.uget(i-1) <= *p.uget(i));
+            printf("parray psort threads=%2d: %8.3f ms, speedup %.2f\n", int(threads), time * 1e+3, base / time);
+        }
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include "perf.h"
+
+#define ITEMS               (1 << 20)
+
+namespace
+{
+    typedef struct onset_t
+    {
+        uint64_t    timestamp;
+        float       level;
+        uint32_t    channel;
+    } onset_t;
+
+    static ssize_t u32_cmp(const uint32_t *a, const uint32_t *b)
+    {
+        return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
+    }
+
+    static ssize_t u64_cmp(const uint64_t *a, const uint64_t *b)
+    {
+        return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
+    }
+
+    static ssize_t f32_cmp(const float *a, const float *b)
+    {
+        return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
+    }
+
+    static ssize_t onset_cmp(const onset_t *a, const onset_t *b)
+    {
+        return (a->timestamp < b->timestamp) ? -1 : (a->timestamp > b->timestamp) ? 1 : 0;
+    }
+}
+
+MTEST_BEGIN("lltl.perf", radix_sort)
+
+    template <class T>
+        void fill(lltl::darray<T> *a, void (*func)(T *item, uint32_t seed))
+        {
+            a->clear();
+            uint32_t seed   = 1;
+            T *v            = a->append_n(ITEMS);
+            MTEST_ASSERT(v != NULL);
+
+            for (size_t i=0; i<ITEMS; ++i)
+            {
+                seed            = seed * 1103515245 + 12345;
+                func(&v[i], seed);
+            }
+        }
+
+    static void gen_u32(uint32_t *v, uint32_t seed)     { *v = seed; }
+    static void gen_u64(uint64_t *v, uint32_t seed)     { *v = (uint64_t(seed) << 32) | (seed ^ 0x55aa55aa); }
+    static void gen_f32(float *v, uint32_t seed)        { *v = float(int32_t(seed)) * 1e-6f; }
+    static void gen_onset(onset_t *v, uint32_t seed)
+    {
+        v->timestamp    = seed >> 4;
+        v->level        = float(seed & 0xff);
+        v->channel      = seed & 0x0f;
+    }
+
+    template <class T>
+        void bench(const char *name, void (*gen)(T *item, uint32_t seed), ssize_t (*cmp)(const T *a, const T *b),
+            size_t offset, size_t width, lltl::radix_key_t key)
+        {
+            lltl::darray<T> a;
+
+            fill(&a, gen);
+            double start = lltl::perf::now();
+            a.qsort(cmp);
+            double qtime = lltl::perf::now() - start;
+
+            fill(&a, gen);
+            start = lltl::perf::now();
+            MTEST_ASSERT(a.radix_sort(offset, width, key));
+            double rtime = lltl::perf::now() - start;
+
+            for (size_t i=1; i<ITEMS; ++i)
+                MTEST_ASSERT(cmp(a.uget(i-1), a.uget(i)) <= 0);
+
+            printf("%-10s qsort: %8.3f ms, radix_sort: %8.3f ms, speedup %.2f\n",
+                name, qtime * 1e+3, rtime * 1e+3, qtime / rtime);
+        }
+
+    MTEST_MAIN
+    {
+        printf("Sorting %d elements\n", int(ITEMS));
+
+        bench<uint32_t>("uint32_t", gen_u32, u32_cmp, 0, sizeof(uint32_t), lltl::RADIX_UNSIGNED);
+        bench<uint64_t>("uint64_t", gen_u64, u64_cmp, 0, sizeof(uint64_t), lltl::RADIX_UNSIGNED);
+        bench<float>("float", gen_f32, f32_cmp, 0, sizeof(float), lltl::RADIX_FLOAT);
+        bench<onset_t>("onset_t", gen_onset, onset_cmp, offsetof(onset_t, timestamp), sizeof(uint64_t), lltl::RADIX_UNSIGNED);
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/lltl/sarray.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "perf.h"
+
+#define PASSES              16
+#define CHURN               1000000
+
+MTEST_BEGIN("lltl.perf", sarray)
+
+    typedef struct object_t
+    {
+        float       gain;
+        float       phase;
+        float       freq;
+        float       pan;
+    } object_t;
+
+    void run(size_t count)
+    {
+        lltl::sarray<object_t> sa;
+        lltl::parray<object_t> pa;
+        size_t *ops     = static_cast<size_t *>(malloc(CHURN * sizeof(size_t)));
+        MTEST_ASSERT(ops != NULL);
+        for (size_t i=0; i<CHURN; ++i)
+            ops[i]          = rand() % count;
+
+        // Allocation of objects with stable addresses
+        double start = lltl::perf::now();
+        for (size_t i=0; i<count; ++i)
+        {
+            object_t *x     = sa.add();
+            x->gain         = 1.0f;
+            x->phase        = 0.0f;
+            x->freq         = i;
+            x->pan          = 0.5f;
+        }
+        double t_sa_alloc = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t i=0; i<count; ++i)
+        {
+            object_t *x     = static_cast<object_t *>(malloc(sizeof(object_t)));
+            x->gain         = 1.0f;
+            x->phase        = 0.0f;
+            x->freq         = i;
+            x->pan          = 0.5f;
+            pa.add(x);
+        }
+        double t_pa_alloc = lltl::perf::now() - start;
+
+        // Replace objects: remove the object and allocate another one
+        start = lltl::perf::now();
+        for (size_t i=0; i<CHURN; ++i)
+        {
+            size_t idx      = sa.limit();
+            while (sa.get(idx = ops[i] % sa.limit()) == NULL)
+                ++ops[i];
+            sa.remove(idx);
+            object_t *x     = sa.add();
+            x->phase        = 0.0f;
+        }
+        double t_sa_churn = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t i=0; i<CHURN; ++i)
+        {
+            object_t *x     = pa.qremove(ops[i] % pa.size());
+            free(x);
+            x               = static_cast<object_t *>(malloc(sizeof(object_t)));
+            x->phase        = 0.0f;
+            pa.add(x);
+        }
+        double t_pa_churn = lltl::perf::now() - start;
+
+        // Iterate over objects
+        float sum[2] = { 0.0f, 0.0f };
+        start = lltl::perf::now();
+        for (size_t p=0; p<PASSES; ++p)
+            for (lltl::iterator<object_t> it = sa.values(); it; ++it)
+                sum[0]         += it->phase;
+        double t_sa_iter = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t p=0; p<PASSES; ++p)
+            for (size_t i=0, n=sa.limit(); i<n; ++i)
+            {
+                const object_t *x   = sa.get(i);
+                if (x != NULL)
+                    sum[0]             += x->phase;
+            }
+        double t_sa_index = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t p=0; p<PASSES; ++p)
+            for (size_t i=0, n=pa.size(); i<n; ++i)
+                sum[1]         += pa.uget(i)->phase;
+        double t_pa_iter = lltl::perf::now() - start;
+        MTEST_ASSERT(sum[0] == sum[1] * 2);
+
+        printf("%8d %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+            int(count),
+            count / (t_sa_alloc * 1e+6), count / (t_pa_alloc * 1e+6),
+            CHURN / (t_sa_churn * 1e+6), CHURN / (t_pa_churn * 1e+6),
+            (count * PASSES) / (t_sa_iter * 1e+6), (count * PASSES) / (t_sa_index * 1e+6),
+            (count * PASSES) / (t_pa_iter * 1e+6));
+
+        for (size_t i=0, n=pa.size(); i<n; ++i)
+            free(pa.uget(i));
+        free(ops);
+    }
+
+    MTEST_MAIN
+    {
+        srand(0);
+        printf("%8s %21s %21s %32s\n", "", "alloc, Mop/s", "churn, Mop/s", "iterate, Mitem/s");
+        printf("%8s %10s %10s %10s %10s %10s %10s %10s\n", "objects", "sarray", "parray", "sarray", "parray", "iterator", "get()", "parray");
+        for (size_t count = 1000; count <= 1000000; count *= 10)
+            run(count);
+    }
+
+MTEST_END
+
+
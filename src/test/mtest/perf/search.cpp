@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include "perf.h"
+
+#define ITERATIONS          200000
+#define NODES               300
+#define LARGE               (1 << 16)
+
+MTEST_BEGIN("lltl.perf", search)
+
+    typedef struct node_t
+    {
+        size_t      id;
+        float       value;
+    } node_t;
+
+    template <class T>
+        static ssize_t naive_find(const T *v, size_t n, const T &value)
+        {
+            for (size_t i=0; i<n; ++i)
+                if (v[i] == value)
+                    return i;
+            return -1;
+        }
+
+    void bench_contains()
+    {
+        node_t *nodes = new node_t[NODES * 2];
+        lltl::parray<node_t> graph;
+        for (size_t i=0; i<NODES; ++i)
+            MTEST_ASSERT(graph.add(&nodes[i * 2]));
+
+        // Look up present and absent nodes
+        size_t found = 0;
+        double start = lltl::perf::now();
+        for (size_t i=0; i<ITERATIONS; ++i)
+            found      += (naive_find<node_t *>(graph.array(), graph.size(), &nodes[i % (NODES * 2)]) >= 0) ? 1 : 0;
+        double naive = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t i=0; i<ITERATIONS; ++i)
+            found      += graph.contains(&nodes[i % (NODES * 2)]) ? 1 : 0;
+        double simd = lltl::perf::now() - start;
+
+        MTEST_ASSERT(found == ITERATIONS);
+        printf("parray<node_t> contains, %d nodes: naive %8.3f ms, simd %8.3f ms, speedup %.2f\n",
+            int(NODES), naive * 1e+3, simd * 1e+3, naive / simd);
+
+        delete [] nodes;
+    }
+
+    template <class T>
+        void bench_find(const char *name)
+        {
+            lltl::darray<T> a;
+            T *v = a.append_n(LARGE);
+            MTEST_ASSERT(v != NULL);
+            for (size_t i=0; i<LARGE; ++i)
+                v[i]        = T(i);
+
+            size_t iterations = ITERATIONS / 200;
+            ssize_t sum = 0;
+            double start = lltl::perf::now();
+            for (size_t i=0; i<iterations; ++i)
+                sum        += naive_find<T>(v, LARGE, T((i * 7919) % LARGE));
+            double naive = lltl::perf::now() - start;
+
+            start = lltl::perf::now();
+            for (size_t i=0; i<iterations; ++i)
+                sum        -= a.find(T((i * 7919) % LARGE));
+            double simd = lltl::perf::now() - start;
+
+            MTEST_ASSERT(sum == 0);
+            printf("darray<%s> find, %d elements: naive %8.3f ms, simd %8.3f ms, speedup %.2f\n",
+                name, int(LARGE), naive * 1e+3, simd * 1e+3, naive / simd);
+        }
+
+    MTEST_MAIN
+    {
+        bench_contains();
+        bench_find<uint32_t>("uint32_t");
+        bench_find<uint64_t>("uint64_t");
+        bench_find<float>("float");
+    }
+
+MTEST_END
+
+
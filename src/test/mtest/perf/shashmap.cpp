@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/shashmap.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <pthread.h>
+#include "perf.h"
+
+#define KEYS                100000
+#define MAX_THREADS         16
+#define OPERATIONS          2000000
+
+MTEST_BEGIN("lltl.perf", shashmap)
+
+    typedef struct context_t
+    {
+        lltl::shashmap<char, char> *smap;
+        lltl::pphash<char, char>   *hash;
+        pthread_mutex_t            *mutex;
+        char                      **keys;
+        size_t                      ops;
+        size_t                      seed;
+    } context_t;
+
+    static inline size_t next_random(size_t *seed)
+    {
+        *seed   = *seed * 1103515245 + 12345;
+        return (*seed >> 8);
+    }
+
+    // 90% of lookups and 10% of updates
+    static void *shashmap_worker(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        for (size_t i=0; i<ctx->ops; ++i)
+        {
+            size_t r    = next_random(&ctx->seed);
+            char *key   = ctx->keys[r % KEYS];
+            if ((r >> 20) % 10)
+                ctx->smap->get(key);
+            else
+                ctx->smap->put(key, key);
+        }
+        return NULL;
+    }
+
+    static void *mutex_worker(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        for (size_t i=0; i<ctx->ops; ++i)
+        {
+            size_t r    = next_random(&ctx->seed);
+            char *key   = ctx->keys[r % KEYS];
+            pthread_mutex_lock(ctx->mutex);
+            if ((r >> 20) % 10)
+                ctx->hash->get(key);
+            else
+                ctx->hash->put(key, key, NULL);
+            pthread_mutex_unlock(ctx->mutex);
+        }
+        return NULL;
+    }
+
+    double run(void *(*func)(void *), context_t *base, size_t threads)
+    {
+        context_t ctx[MAX_THREADS];
+        pthread_t tid[MAX_THREADS];
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<threads; ++i)
+        {
+            ctx[i]      = *base;
+            ctx[i].ops  = OPERATIONS / threads;
+            ctx[i].seed = i + 1;
+            MTEST_ASSERT(pthread_create(&tid[i], NULL, func, &ctx[i]) == 0);
+        }
+        for (size_t i=0; i<threads; ++i)
+            pthread_join(tid[i], NULL);
+
+        return OPERATIONS / (lltl::perf::now() - start) * 1e-6;
+    }
+
+    MTEST_MAIN
+    {
+        lltl::shashmap<char, char> smap;
+        lltl::pphash<char, char> hash;
+        pthread_mutex_t mutex;
+        char **keys = new char *[KEYS];
+        char buf[32];
+        context_t ctx;
+
+        MTEST_ASSERT(smap.init(64));
+        pthread_mutex_init(&mutex, NULL);
+
+        printf("Generating %d keys...\n", int(KEYS));
+        for (size_t i=0; i<KEYS; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "preset-%08x", int(i * 7919));
+            MTEST_ASSERT(keys[i] = ::strdup(buf));
+            MTEST_ASSERT(smap.put(keys[i], keys[i]));
+            MTEST_ASSERT(hash.put(keys[i], keys[i], NULL));
+        }
+
+        ctx.smap    = &smap;
+        ctx.hash    = &hash;
+        ctx.mutex   = &mutex;
+        ctx.keys    = keys;
+        ctx.ops     = 0;
+        ctx.seed    = 0;
+
+        for (size_t threads=1; threads<=MAX_THREADS; threads <<= 1)
+        {
+            double mutex_speed  = run(mutex_worker, &ctx, threads);
+            double shard_speed  = run(shashmap_worker, &ctx, threads);
+            printf("threads=%2d: mutex+pphash %8.3f Mops/s, shashmap %8.3f Mops/s\n",
+                int(threads), mutex_speed, shard_speed);
+        }
+
+        pthread_mutex_destroy(&mutex);
+        for (size_t i=0; i<KEYS; ++i)
+            ::free(keys[i]);
+        delete [] keys;
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/lltl/slotmap.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "perf.h"
+
+#define LOOKUPS             100000
+#define PASSES              16
+
+MTEST_BEGIN("lltl.perf", slotmap)
+
+    typedef struct node_t
+    {
+        float       value;
+        int         id;
+    } node_t;
+
+    void run(size_t count)
+    {
+        lltl::slotmap<node_t> sm;
+        lltl::parray<node_t> pa;
+        lltl::slot_handle_t *handles    = static_cast<lltl::slot_handle_t *>(malloc(count * sizeof(lltl::slot_handle_t)));
+        node_t **ptrs                   = static_cast<node_t **>(malloc(count * sizeof(node_t *)));
+        size_t *ops                     = static_cast<size_t *>(malloc(LOOKUPS * sizeof(size_t)));
+        MTEST_ASSERT(handles != NULL);
+        MTEST_ASSERT(ptrs != NULL);
+        MTEST_ASSERT(ops != NULL);
+
+        for (size_t i=0; i<count; ++i)
+        {
+            node_t n;
+            n.value         = 1.0f;
+            n.id            = i;
+            MTEST_ASSERT(sm.add(&n, &handles[i]) != NULL);
+
+            ptrs[i]         = static_cast<node_t *>(malloc(sizeof(node_t)));
+            MTEST_ASSERT(ptrs[i] != NULL);
+            *ptrs[i]        = n;
+            pa.add(ptrs[i]);
+        }
+        for (size_t i=0; i<LOOKUPS; ++i)
+            ops[i]          = rand() % count;
+
+        // Validate references before access
+        size_t found[2] = { 0, 0 };
+        double start = lltl::perf::now();
+        for (size_t i=0; i<LOOKUPS; ++i)
+        {
+            if (sm.get(handles[ops[i]]) != NULL)
+                ++found[0];
+        }
+        double t_sm_lookup = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t i=0; i<LOOKUPS; ++i)
+        {
+            if (pa.index_of(ptrs[ops[i]]) >= 0)
+                ++found[1];
+        }
+        double t_pa_lookup = lltl::perf::now() - start;
+        MTEST_ASSERT(found[0] == found[1]);
+
+        // Remove half of items
+        start = lltl::perf::now();
+        for (size_t i=0; i<count; i += 2)
+            sm.remove(handles[i]);
+        double t_sm_remove = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t i=0; i<count; i += 2)
+        {
+            pa.premove(ptrs[i]);
+            free(ptrs[i]);
+        }
+        double t_pa_remove = lltl::perf::now() - start;
+
+        // Iterate over remaining items
+        float sum[2] = { 0.0f, 0.0f };
+        start = lltl::perf::now();
+        for (size_t p=0; p<PASSES; ++p)
+        {
+            const node_t *v = sm.array();
+            for (size_t i=0, n=sm.size(); i<n; ++i)
+                sum[0]         += v[i].value;
+        }
+        double t_sm_iter = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t p=0; p<PASSES; ++p)
+            for (size_t i=0, n=pa.size(); i<n; ++i)
+                sum[1]         += pa.uget(i)->value;
+        double t_pa_iter = lltl::perf::now() - start;
+        MTEST_ASSERT(sum[0] == sum[1]);
+
+        printf("%8d %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+            int(count),
+            LOOKUPS / (t_sm_lookup * 1e+6), LOOKUPS / (t_pa_lookup * 1e+6),
+            (count / 2) / (t_sm_remove * 1e+6), (count / 2) / (t_pa_remove * 1e+6),
+            (sm.size() * PASSES) / (t_sm_iter * 1e+6), (pa.size() * PASSES) / (t_pa_iter * 1e+6));
+
+        for (size_t i=1; i<count; i += 2)
+            free(ptrs[i]);
+        free(ops);
+        free(ptrs);
+        free(handles);
+    }
+
+    MTEST_MAIN
+    {
+        srand(0);
+        printf("%8s %21s %21s %21s\n", "", "lookup, Mop/s", "remove, Mop/s", "iterate, Mitem/s");
+        printf("%8s %10s %10s %10s %10s %10s %10s\n", "nodes", "slotmap", "parray", "slotmap", "parray", "slotmap", "parray");
+        for (size_t count = 100; count <= 100000; count *= 10)
+            run(count);
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/soa.h>
+#include <stdio.h>
+#include "perf.h"
+
+#define UPDATES             (1 << 26)
+
+MTEST_BEGIN("lltl.perf", soa)
+
+    typedef struct voice_t
+    {
+        float       gain;
+        float       phase;
+        float       freq;
+        float       pan;
+        uint32_t    flags;
+        uint32_t    note;
+        void       *sample;
+    } voice_t;
+
+    typedef lltl::soa4<float, float, float, float> voices_t;
+
+    // Advance phase and envelope of each voice
+    static void process_aos(voice_t *v, size_t n)
+    {
+        for (size_t i=0; i<n; ++i)
+        {
+            float phase     = v[i].phase + v[i].freq;
+            v[i].phase      = (phase >= 1.0f) ? phase - 1.0f : phase;
+            v[i].gain       = v[i].gain * 0.999f + v[i].pan * 0.001f;
+        }
+    }
+
+    static void process_soa(float * __restrict gain, float * __restrict phase, const float * __restrict freq, const float * __restrict pan, size_t n)
+    {
+        for (size_t i=0; i<n; ++i)
+        {
+            float p         = phase[i] + freq[i];
+            phase[i]        = (p >= 1.0f) ? p - 1.0f : p;
+            gain[i]         = gain[i] * 0.999f + pan[i] * 0.001f;
+        }
+    }
+
+    void run(size_t count)
+    {
+        lltl::darray<voice_t> aos;
+        voices_t soa;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            voice_t *v      = aos.add();
+            MTEST_ASSERT(v != NULL);
+            v->gain         = 0.5f;
+            v->phase        = 0.0f;
+            v->freq         = (i % 100) * 0.001f;
+            v->pan          = 0.25f;
+            v->flags        = 0;
+            v->note         = i;
+            v->sample       = NULL;
+
+            MTEST_ASSERT(soa.add(v->gain, v->phase, v->freq, v->pan) >= 0);
+        }
+
+        size_t passes = UPDATES / count;
+
+        double start = lltl::perf::now();
+        for (size_t p=0; p<passes; ++p)
+            process_aos(aos.array(), count);
+        double t_aos = lltl::perf::now() - start;
+
+        start = lltl::perf::now();
+        for (size_t p=0; p<passes; ++p)
+            process_soa(soa.f0(), soa.f1(), soa.f2(), soa.f3(), count);
+        double t_soa = lltl::perf::now() - start;
+
+        // Both layouts should produce the same state
+        const voice_t *v = aos.array();
+        for (size_t i=0; i<count; ++i)
+        {
+            MTEST_ASSERT(v[i].phase == soa.f1()[i]);
+            MTEST_ASSERT(v[i].gain == soa.f0()[i]);
+        }
+
+        printf("%8d %10.2f %10.2f %8.2f\n",
+            int(count),
+            (passes * count) / (t_aos * 1e+6),
+            (passes * count) / (t_soa * 1e+6),
+            t_aos / t_soa);
+    }
+
+    MTEST_MAIN
+    {
+        printf("%8s %10s %10s %8s\n", "voices", "darray", "soa", "speedup");
+        printf("%8s %10s %10s %8s\n", "", "Mvoice/s", "Mvoice/s", "");
+        for (size_t count = 64; count <= 1024 * 1024; count *= 8)
+            run(count);
+    }
+
+MTEST_END
+
+
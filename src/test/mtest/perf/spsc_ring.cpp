@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/spsc_ring.h>
+#include <pthread.h>
+#include <sched.h>
+#include "perf.h"
+
+#define THROUGHPUT_ITEMS        4000000
+#define LATENCY_ROUNDS          100000
+#define RING_SIZE               1024
+
+MTEST_BEGIN("lltl.perf", spsc_ring)
+
+    typedef struct event_t
+    {
+        uint32_t    id;
+        uint32_t    type;
+        float       value;
+        uint32_t    flags;
+    } event_t;
+
+    typedef struct context_t
+    {
+        lltl::spsc_ring<event_t>    req;
+        lltl::spsc_ring<event_t>    resp;
+        size_t                      batch;
+        size_t                      items;
+    } context_t;
+
+    static void *producer_main(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        event_t ev[RING_SIZE];
+
+        for (size_t i=0; i<RING_SIZE; ++i)
+        {
+            ev[i].id    = i;
+            ev[i].type  = 1;
+            ev[i].value = 0.5f;
+            ev[i].flags = 0;
+        }
+
+        for (size_t sent = 0; sent < ctx->items; )
+        {
+            size_t n = ctx->items - sent;
+            if (n > ctx->batch)
+                n = ctx->batch;
+            size_t k = (n > 1) ? ctx->req.push_n(ev, n) : ctx->req.push(ev) ? 1 : 0;
+            if (k == 0)
+                sched_yield();
+            sent   += k;
+        }
+
+        return NULL;
+    }
+
+    static void *echo_main(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        event_t ev;
+
+        for (size_t i=0; i<ctx->items; ++i)
+        {
+            while (!ctx->req.pop(&ev))
+                sched_yield();
+            while (!ctx->resp.push(&ev))
+                sched_yield();
+        }
+
+        return NULL;
+    }
+
+    void test_throughput(size_t batch)
+    {
+        context_t ctx;
+        event_t ev[RING_SIZE];
+        pthread_t producer;
+
+        MTEST_ASSERT(ctx.req.reserve(RING_SIZE));
+        ctx.batch   = batch;
+        ctx.items   = THROUGHPUT_ITEMS;
+
+        double start = lltl::perf::now();
+        MTEST_ASSERT(pthread_create(&producer, NULL, producer_main, &ctx) == 0);
+        for (size_t received = 0; received < ctx.items; )
+        {
+            size_t k = (batch > 1) ? ctx.req.pop_n(ev, batch) : ctx.req.pop(ev) ? 1 : 0;
+            if (k == 0)
+                sched_yield();
+            received   += k;
+        }
+        pthread_join(producer, NULL);
+        double time = lltl::perf::now() - start;
+
+        printf("batch=%4d: %8.3f Mitems/s\n", int(batch), ctx.items / time * 1e-6);
+    }
+
+    void test_latency()
+    {
+        context_t ctx;
+        event_t ev;
+        pthread_t echo;
+
+        MTEST_ASSERT(ctx.req.reserve(RING_SIZE));
+        MTEST_ASSERT(ctx.resp.reserve(RING_SIZE));
+        ctx.batch   = 1;
+        ctx.items   = LATENCY_ROUNDS;
+        ev.id       = 0;
+        ev.type     = 0;
+        ev.value    = 0.0f;
+        ev.flags    = 0;
+
+        MTEST_ASSERT(pthread_create(&echo, NULL, echo_main, &ctx) == 0);
+        double start = lltl::perf::now();
+        for (size_t i=0; i<ctx.items; ++i)
+        {
+            ev.id       = i;
+            MTEST_ASSERT(ctx.req.push(&ev));
+            while (!ctx.resp.pop(&ev))
+                sched_yield();
+            MTEST_ASSERT(ev.id == i);
+        }
+        double time = lltl::perf::now() - start;
+        pthread_join(echo, NULL);
+
+        printf("round-trip latency: %8.3f us\n", time * 1e6 / ctx.items);
+    }
+
+    MTEST_MAIN
+    {
+        printf("Throughput for %d items:\n", int(THROUGHPUT_ITEMS));
+        test_throughput(1);
+        test_throughput(16);
+        test_throughput(256);
+
+        printf("Latency for %d round trips:\n", int(LATENCY_ROUNDS));
+        test_latency();
+    }
+
+MTEST_END
+
+
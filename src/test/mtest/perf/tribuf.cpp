@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/tribuf.h>
+#include <pthread.h>
+#include "perf.h"
+
+#define FRAMES              200000
+#define FRAME_SIZE          1024
+
+MTEST_BEGIN("lltl.perf", tribuf)
+
+    typedef struct context_t
+    {
+        lltl::tribuf<float>        *buf;
+        lltl::darray<float>        *shared;
+        pthread_mutex_t            *mutex;
+        size_t                      received;
+        bool                        done;
+    } context_t;
+
+    static void produce(float *dst, size_t id)
+    {
+        for (size_t i=0; i<FRAME_SIZE; ++i)
+            dst[i]      = float(id + i);
+    }
+
+    static float consume(const float *src)
+    {
+        float sum = 0.0f;
+        for (size_t i=0; i<FRAME_SIZE; ++i)
+            sum        += src[i];
+        return sum;
+    }
+
+    static void *tribuf_consumer(void *arg)
+    {
+        context_t *ctx  = static_cast<context_t *>(arg);
+        float sum       = 0.0f;
+
+        while (!__atomic_load_n(&ctx->done, __ATOMIC_ACQUIRE))
+        {
+            if (!ctx->buf->fetch())
+                continue;
+            sum        += consume(ctx->buf->front()->array());
+            ++ctx->received;
+        }
+
+        return (sum > 0.0f) ? NULL : arg;
+    }
+
+    static void *mutex_consumer(void *arg)
+    {
+        context_t *ctx  = static_cast<context_t *>(arg);
+        lltl::darray<float> local;
+        float sum       = 0.0f;
+
+        local.append_n(FRAME_SIZE);
+
+        while (!__atomic_load_n(&ctx->done, __ATOMIC_ACQUIRE))
+        {
+            pthread_mutex_lock(ctx->mutex);
+            bool fresh  = ctx->shared->size() > 0;
+            if (fresh)
+            {
+                local.swap(ctx->shared);
+                ctx->shared->clear();
+            }
+            pthread_mutex_unlock(ctx->mutex);
+
+            if (!fresh)
+                continue;
+            sum        += consume(local.array());
+            ++ctx->received;
+        }
+
+        return (sum > 0.0f) ? NULL : arg;
+    }
+
+    void run_tribuf()
+    {
+        lltl::tribuf<float> buf;
+        context_t ctx;
+        pthread_t tid;
+
+        // Pass each of three buffers through producer and consumer to allocate frames
+        MTEST_ASSERT(buf.reserve(FRAME_SIZE));
+        for (size_t i=0; i<3; ++i)
+        {
+            MTEST_ASSERT(buf.back()->append_n(FRAME_SIZE) != NULL);
+            buf.publish();
+            buf.fetch();
+        }
+
+        ctx.buf         = &buf;
+        ctx.received    = 0;
+        ctx.done        = false;
+        MTEST_ASSERT(pthread_create(&tid, NULL, tribuf_consumer, &ctx) == 0);
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<FRAMES; ++i)
+        {
+            produce(buf.back()->array(), i);
+            buf.publish();
+        }
+        double time = lltl::perf::now() - start;
+
+        __atomic_store_n(&ctx.done, true, __ATOMIC_RELEASE);
+        pthread_join(tid, NULL);
+
+        printf("tribuf:       %8.3f frames/ms published, %d frames received\n",
+            FRAMES / time * 1e-3, int(ctx.received));
+    }
+
+    void run_mutex()
+    {
+        lltl::darray<float> shared, local;
+        pthread_mutex_t mutex;
+        context_t ctx;
+        pthread_t tid;
+
+        MTEST_ASSERT(shared.reserve(FRAME_SIZE));
+        MTEST_ASSERT(local.reserve(FRAME_SIZE));
+        pthread_mutex_init(&mutex, NULL);
+
+        ctx.shared      = &shared;
+        ctx.mutex       = &mutex;
+        ctx.received    = 0;
+        ctx.done        = false;
+        MTEST_ASSERT(pthread_create(&tid, NULL, mutex_consumer, &ctx) == 0);
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<FRAMES; ++i)
+        {
+            local.clear();
+            produce(local.append_n(FRAME_SIZE), i);
+
+            pthread_mutex_lock(&mutex);
+            local.swap(&shared);
+            pthread_mutex_unlock(&mutex);
+        }
+        double time = lltl::perf::now() - start;
+
+        __atomic_store_n(&ctx.done, true, __ATOMIC_RELEASE);
+        pthread_join(tid, NULL);
+        pthread_mutex_destroy(&mutex);
+
+        printf("mutex+swap:   %8.3f frames/ms published, %d frames received\n",
+            FRAMES / time * 1e-3, int(ctx.received));
+    }
+
+    MTEST_MAIN
+    {
+        printf("Publishing %d frames of %d floats\n", int(FRAMES), int(FRAME_SIZE));
+        run_mutex();
+        run_tribuf();
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/dheap.h>
+#include <lsp-plug.in/lltl/twheel.h>
+#include <stdlib.h>
+#include "perf.h"
+
+#define BLOCK               64
+#define SAMPLES             (48000 * 60)
+#define MAX_DELAY           48000
+
+MTEST_BEGIN("lltl.perf", twheel)
+
+    typedef struct event_t
+    {
+        uint64_t    time;
+        size_t      id;
+    } event_t;
+
+    typedef struct context_t
+    {
+        lltl::twheel<event_t>  *wheel;
+        size_t                  fired;
+    } context_t;
+
+    static ssize_t cmp_event(const void *a, const void *b, size_t size)
+    {
+        const event_t *ea = static_cast<const event_t *>(a);
+        const event_t *eb = static_cast<const event_t *>(b);
+        return (ea->time < eb->time) ? -1 : (ea->time > eb->time) ? 1 : 0;
+    }
+
+    static bool on_event(uint64_t time, event_t *ev, context_t *ctx)
+    {
+        event_t next;
+        next.time   = time + 1 + rand() % MAX_DELAY;
+        next.id     = ev->id;
+        ctx->wheel->insert(next.time, next);
+        ++ctx->fired;
+        return true;
+    }
+
+    void run_heap(size_t count)
+    {
+        lltl::dheap<event_t> q(cmp_event);
+        event_t ev;
+        size_t fired = 0;
+
+        srand(0);
+        MTEST_ASSERT(q.reserve(count));
+        for (size_t i=0; i<count; ++i)
+        {
+            ev.time     = rand() % MAX_DELAY;
+            ev.id       = i;
+            MTEST_ASSERT(q.push(ev) >= 0);
+        }
+
+        double start = lltl::perf::now();
+        for (uint64_t t=0; t<SAMPLES; t += BLOCK)
+        {
+            uint64_t limit  = t + BLOCK;
+            while (q.top()->time < limit)
+            {
+                q.pop(&ev);
+                ev.time    += 1 + rand() % MAX_DELAY;
+                q.push(ev);
+                ++fired;
+            }
+        }
+        double time = lltl::perf::now() - start;
+
+        printf("dheap  events=%-6d: %10.3f blocks/ms, %10.3f events/ms\n",
+            int(count), (SAMPLES / BLOCK) / time * 1e-3, fired / time * 1e-3);
+    }
+
+    void run_wheel(size_t count)
+    {
+        lltl::twheel<event_t> w;
+        event_t ev;
+        context_t ctx;
+
+        srand(0);
+        MTEST_ASSERT(w.reserve(count));
+        for (size_t i=0; i<count; ++i)
+        {
+            ev.time     = rand() % MAX_DELAY;
+            ev.id       = i;
+            MTEST_ASSERT(w.insert(ev.time, ev) >= 0);
+        }
+
+        ctx.wheel       = &w;
+        ctx.fired       = 0;
+
+        double start = lltl::perf::now();
+        for (uint64_t t=0; t<SAMPLES; t += BLOCK)
+            w.advance(BLOCK, on_event, &ctx);
+        double time = lltl::perf::now() - start;
+
+        printf("twheel events=%-6d: %10.3f blocks/ms, %10.3f events/ms\n",
+            int(count), (SAMPLES / BLOCK) / time * 1e-3, ctx.fired / time * 1e-3);
+    }
+
+    MTEST_MAIN
+    {
+        static const size_t counts[] = { 100, 1000, 10000, 100000 };
+
+        printf("Processing %d samples by blocks of %d samples\n", int(SAMPLES), int(BLOCK));
+        for (size_t i=0; i<sizeof(counts)/sizeof(counts[0]); ++i)
+        {
+            run_heap(counts[i]);
+            run_wheel(counts[i]);
+        }
+    }
+
+MTEST_END
+
+
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <lsp-plug.in/lltl/wsdeque.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <math.h>
+#include <pthread.h>
+#include "perf.h"
+
+#define ITEMS               (1 << 22)
+#define GRAIN               256
+#define MAX_TASKS           (2 * ITEMS / GRAIN)
+#define MAX_THREADS         16
+
+MTEST_BEGIN("lltl.perf", wsdeque)
+
+    typedef struct task_t
+    {
+        size_t      first;
+        size_t      last;
+    } task_t;
+
+    typedef struct scheduler_t
+    {
+        lltl::wsdeque<task_t>  *deques;
+        lltl::parray<task_t>   *queue;
+        pthread_mutex_t        *mutex;
+        task_t                 *tasks;
+        size_t                  allocated;
+        size_t                  processed;
+        size_t                  threads;
+    } scheduler_t;
+
+    typedef struct context_t
+    {
+        scheduler_t            *sched;
+        size_t                  id;
+        double                  sum;
+    } context_t;
+
+    static task_t *alloc_task(scheduler_t *s, size_t first, size_t last)
+    {
+        task_t *t   = &s->tasks[__atomic_fetch_add(&s->allocated, 1, __ATOMIC_RELAXED)];
+        t->first    = first;
+        t->last     = last;
+        return t;
+    }
+
+    static double leaf(size_t first, size_t last)
+    {
+        double sum = 0.0;
+        for (size_t i=first; i<last; ++i)
+            sum        += sqrt(double(i));
+        return sum;
+    }
+
+    static void *wsdeque_worker(void *arg)
+    {
+        context_t *ctx          = static_cast<context_t *>(arg);
+        scheduler_t *s          = ctx->sched;
+        lltl::wsdeque<task_t> *own = &s->deques[ctx->id];
+        size_t victim           = ctx->id;
+
+        while (__atomic_load_n(&s->processed, __ATOMIC_ACQUIRE) < ITEMS)
+        {
+            // Take own task or steal from other thread
+            task_t *t = own->pop();
+            for (size_t i=1; (t == NULL) && (i < s->threads); ++i)
+            {
+                victim      = (victim + 1) % s->threads;
+                if (victim != ctx->id)
+                    t           = s->deques[victim].steal();
+            }
+            if (t == NULL)
+                continue;
+
+            // Split the task and leave the right half for others
+            size_t first = t->first, last = t->last;
+            while (last - first > GRAIN)
+            {
+                size_t mid  = (first + last) >> 1;
+                own->push(alloc_task(s, mid, last));
+                last        = mid;
+            }
+
+            ctx->sum   += leaf(first, last);
+            __atomic_fetch_add(&s->processed, last - first, __ATOMIC_RELEASE);
+        }
+
+        return NULL;
+    }
+
+    static void *central_worker(void *arg)
+    {
+        context_t *ctx          = static_cast<context_t *>(arg);
+        scheduler_t *s          = ctx->sched;
+
+        while (__atomic_load_n(&s->processed, __ATOMIC_ACQUIRE) < ITEMS)
+        {
+            task_t *t;
+            pthread_mutex_lock(s->mutex);
+            if (!s->queue->pop(&t))
+                t           = NULL;
+            pthread_mutex_unlock(s->mutex);
+            if (t == NULL)
+                continue;
+
+            size_t first = t->first, last = t->last;
+            while (last - first > GRAIN)
+            {
+                size_t mid  = (first + last) >> 1;
+                task_t *x   = alloc_task(s, mid, last);
+                pthread_mutex_lock(s->mutex);
+                s->queue->push(x);
+                pthread_mutex_unlock(s->mutex);
+                last        = mid;
+            }
+
+            ctx->sum   += leaf(first, last);
+            __atomic_fetch_add(&s->processed, last - first, __ATOMIC_RELEASE);
+        }
+
+        return NULL;
+    }
+
+    double run(bool stealing, size_t threads)
+    {
+        lltl::wsdeque<task_t> deques[MAX_THREADS];
+        lltl::parray<task_t> queue;
+        pthread_mutex_t mutex;
+        context_t ctx[MAX_THREADS];
+        pthread_t tid[MAX_THREADS];
+        scheduler_t s;
+
+        pthread_mutex_init(&mutex, NULL);
+        s.deques        = deques;
+        s.queue         = &queue;
+        s.mutex         = &mutex;
+        s.tasks         = new task_t[MAX_TASKS];
+        s.allocated     = 0;
+        s.processed     = 0;
+        s.threads       = threads;
+
+        for (size_t i=0; i<threads; ++i)
+            MTEST_ASSERT(deques[i].reserve(MAX_TASKS / threads));
+        MTEST_ASSERT(queue.reserve(MAX_TASKS));
+
+        // Put the root task
+        task_t *root    = alloc_task(&s, 0, ITEMS);
+        if (stealing)
+            deques[0].push(root);
+        else
+            queue.push(root);
+
+        double start = lltl::perf::now();
+        for (size_t i=0; i<threads; ++i)
+        {
+            ctx[i].sched    = &s;
+            ctx[i].id       = i;
+            ctx[i].sum      = 0.0;
+            MTEST_ASSERT(pthread_create(&tid[i], NULL, (stealing) ? wsdeque_worker : central_worker, &ctx[i]) == 0);
+        }
+        for (size_t i=0; i<threads; ++i)
+            pthread_join(tid[i], NULL);
+        double time = lltl::perf::now() - start;
+
+        delete [] s.tasks;
+        pthread_mutex_destroy(&mutex);
+
+        return time * 1e+3;
+    }
+
+    MTEST_MAIN
+    {
+        printf("Processing %d items with grain %d\n", int(ITEMS), int(GRAIN));
+        for (size_t threads=1; threads<=MAX_THREADS; threads <<= 1)
+        {
+            double central  = run(false, threads);
+            double stealing = run(true, threads);
+            printf("threads=%2d: central queue %8.3f ms, work stealing %8.3f ms\n",
+                int(threads), central, stealing);
+        }
+    }
+
+MTEST_END
+
+
@@ -301,6 +301,185 @@ UTEST_BEGIN("lltl", bitset)
         }
     }
 
+    void test_set_bytes()
+    {
+        lltl::bitset x;
+        uint8_t buf[0x100];
+
+        UTEST_FOREACH(size, 10, 128, 192, 255)
+        {
+            printf("Testing byte mask set for size %d...\n", int(size));
+
+            UTEST_ASSERT(x.resize(size));
+            for (size_t i=0; i<size; ++i)
+                buf[i] = (rand() % 2) ? rand() % 0x100 : 0;
+
+            for (size_t first=0; first<size; ++first)
+                for (size_t last=first; last<size; ++last)
+                {
+                    x.set_all();
+                    UTEST_ASSERT(x.set(first, last - first, buf) == (last - first));
+
+                    for (size_t i=0; i<size; ++i)
+                    {
+                        int b = (i >= first) && (i < last) ? buf[i-first] != 0 : 1;
+                        int v = x.get(i);
+                        UTEST_ASSERT_MSG(v == b, "bit at index %d is %d but expected to be %d first=%d, last=%d", int(i), v, b, int(first), int(last));
+                    }
+                }
+        }
+    }
+
+    void test_get_multi()
+    {
+        lltl::bitset x;
+        bool src[0x100], dst[0x101];
+        uint8_t bdst[0x101];
+
+        UTEST_FOREACH(size, 10, 128, 192, 255)
+        {
+            printf("Testing multiple get for size %d...\n", int(size));
+
+            UTEST_ASSERT(x.resize(size));
+            for (size_t i=0; i<size; ++i)
+                src[i] = rand() % 2;
+            UTEST_ASSERT(x.set(0, size, src) == size);
+            UTEST_ASSERT(x.get(size, 1, dst) == 0);
+
+            for (size_t first=0; first<size; ++first)
+                for (size_t last=first; last<size; ++last)
+                {
+                    size_t n = last - first;
+                    ::memset(dst, 0x55, sizeof(dst));
+                    ::memset(bdst, 0x55, sizeof(bdst));
+
+                    UTEST_ASSERT(x.get(first, n + 1, dst) == n + 1);
+                    UTEST_ASSERT(x.get(first, n + 1, bdst) == n + 1);
+                    for (size_t i=0; i<=n; ++i)
+                    {
+                        UTEST_ASSERT_MSG(dst[i] == src[first + i], "bool at index %d is %d but expected to be %d first=%d, last=%d",
+                            int(i), int(dst[i]), int(src[first + i]), int(first), int(last));
+                        UTEST_ASSERT_MSG(bdst[i] == src[first + i], "byte at index %d is %d but expected to be %d first=%d, last=%d",
+                            int(i), int(bdst[i]), int(src[first + i]), int(first), int(last));
+                    }
+                    UTEST_ASSERT(bdst[n + 1] == 0x55);
+                }
+
+            // Out of range requests should be truncated
+            UTEST_ASSERT(x.get(size - 3, 10, bdst) == 3);
+        }
+    }
+
+    void test_packed()
+    {
+        lltl::bitset x;
+        uint8_t src[0x20], dst[0x21];
+
+        UTEST_FOREACH(size, 10, 128, 192, 255)
+        {
+            printf("Testing packed set/get for size %d...\n", int(size));
+
+            UTEST_ASSERT(x.resize(size));
+            for (size_t i=0; i<sizeof(src); ++i)
+                src[i] = rand() % 0x100;
+
+            for (size_t first=0; first<size; ++first)
+                for (size_t last=first; last<size; ++last)
+                {
+                    size_t n = last - first;
+                    x.set_all();
+                    UTEST_ASSERT(x.set_packed(first, n, src) == n);
+
+                    for (size_t i=0; i<size; ++i)
+                    {
+                        int b = ((i >= first) && (i < last)) ? (src[(i-first) / 8] >> ((i-first) % 8)) & 1 : 1;
+                        int v = x.get(i);
+                        UTEST_ASSERT_MSG(v == b, "bit at index %d is %d but expected to be %d first=%d, last=%d", int(i), v, b, int(first), int(last));
+                    }
+
+                    ::memset(dst, 0x55, sizeof(dst));
+                    UTEST_ASSERT(x.get_packed(first, n, dst) == n);
+                    for (size_t i=0; i<n; ++i)
+                    {
+                        int b = (src[i / 8] >> (i % 8)) & 1;
+                        int v = (dst[i / 8] >> (i % 8)) & 1;
+                        UTEST_ASSERT_MSG(v == b, "packed bit %d is %d but expected to be %d first=%d, last=%d", int(i), v, b, int(first), int(last));
+                    }
+                    for (size_t i=n; i<((n + 7) & ~size_t(7)); ++i)
+                        UTEST_ASSERT_MSG(!(dst[i / 8] & (1 << (i % 8))), "unused packed bit %d is not cleared", int(i));
+                    UTEST_ASSERT(dst[(n + 7) / 8] == 0x55);
+                }
+        }
+    }
+
+    void test_raw_data()
+    {
+        printf("Testing raw data access...\n");
+        lltl::bitset x;
+
+        UTEST_ASSERT(x.data() == NULL);
+        UTEST_ASSERT(x.words() == 0);
+
+        UTEST_ASSERT(x.resize(UMWORD_BITS * 2 + 1));
+        UTEST_ASSERT(x.words() == 3);
+        UTEST_ASSERT(x.capacity() == x.words() * sizeof(umword_t));
+        UTEST_ASSERT(x.data() != NULL);
+
+        x.set(1);
+        x.set(UMWORD_BITS + 2);
+        x.set(UMWORD_BITS * 2);
+        const umword_t *w = x.data();
+        UTEST_ASSERT(w[0] == umword_t(2));
+        UTEST_ASSERT(w[1] == umword_t(4));
+        UTEST_ASSERT(w[2] == umword_t(1));
+    }
+
+    void test_scan()
+    {
+        lltl::bitset bs;
+
+        printf("Testing bit scanning...\n");
+        UTEST_ASSERT(bs.next_set(0) < 0);
+        UTEST_ASSERT(bs.next_unset(0) < 0);
+
+        UTEST_ASSERT(bs.resize(300));
+        UTEST_ASSERT(bs.next_set(0) < 0);
+        UTEST_ASSERT(bs.next_unset(0) == 0);
+        UTEST_ASSERT(bs.next_unset(299) == 299);
+        UTEST_ASSERT(bs.next_unset(300) < 0);
+
+        static const ssize_t bits[] = { 0, 1, 63, 64, 65, 127, 128, 200, 299 };
+        static const size_t nbits = sizeof(bits)/sizeof(bits[0]);
+        for (size_t i=0; i<nbits; ++i)
+            UTEST_ASSERT(!bs.set(bits[i]));
+
+        // Enumerate set bits
+        size_t n = 0;
+        for (ssize_t i = bs.next_set(0); i >= 0; i = bs.next_set(i + 1), ++n)
+        {
+            UTEST_ASSERT(n < nbits);
+            UTEST_ASSERT(i == bits[n]);
+        }
+        UTEST_ASSERT(n == nbits);
+
+        // Enumerate unset bits
+        bs.toggle_all();
+        n = 0;
+        for (ssize_t i = bs.next_unset(0); i >= 0; i = bs.next_unset(i + 1), ++n)
+        {
+            UTEST_ASSERT(n < nbits);
+            UTEST_ASSERT(i == bits[n]);
+        }
+        UTEST_ASSERT(n == nbits);
+
+        // Bits past the size should not be reported
+        bs.set_all();
+        UTEST_ASSERT(bs.resize(100));
+        UTEST_ASSERT(bs.next_unset(0) < 0);
+        UTEST_ASSERT(bs.next_set(99) == 99);
+        UTEST_ASSERT(bs.next_set(100) < 0);
+    }
+
     UTEST_MAIN
     {
         test_resize();
@@ -310,6 +489,11 @@ UTEST_BEGIN("lltl", bitset)
         test_multi_unset();
         test_multi_toggle();
         test_set_random();
+        test_set_bytes();
+        test_get_multi();
+        test_packed();
+        test_raw_data();
+        test_scan();
     }
 
 UTEST_END;
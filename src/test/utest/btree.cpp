@@ -0,0 +1,344 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/btree.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdlib.h>
+
+#define KEYS            5000
+
+UTEST_BEGIN("lltl", btree)
+
+    typedef struct small_t
+    {
+        int         key;
+        uint8_t     data[1];
+    } small_t;
+
+    typedef struct big_t
+    {
+        int         key;
+        uint8_t     data[300];
+    } big_t;
+
+    typedef lltl::btree<int, int>::iterator int_iterator;
+    typedef lltl::btree<int, big_t>::iterator big_iterator;
+
+    static ssize_t cmp_int(const void *a, const void *b, size_t size)
+    {
+        int ia = *static_cast<const int *>(a);
+        int ib = *static_cast<const int *>(b);
+        return (ia < ib) ? -1 : (ia > ib) ? 1 : 0;
+    }
+
+    template <class V>
+    void check_content(lltl::btree<int, V> &t, const bool *present)
+    {
+        typename lltl::btree<int, V>::iterator it = t.values();
+        size_t count = 0;
+
+        for (int k=0; k<KEYS; ++k)
+        {
+            if (!present[k])
+            {
+                UTEST_ASSERT(t.get(k) == NULL);
+                continue;
+            }
+
+            UTEST_ASSERT(it.valid());
+            UTEST_ASSERT(it.get() != NULL);
+            UTEST_ASSERT(*it.key() == k);
+            UTEST_ASSERT(it->key == k);
+            UTEST_ASSERT(t.get(k) == it.get());
+            ++it;
+            ++count;
+        }
+        UTEST_ASSERT(it.valid());
+        UTEST_ASSERT(it.end());
+        UTEST_ASSERT(count == t.size());
+    }
+
+    void test_basic()
+    {
+        lltl::btree<int, int> t(cmp_int);
+        int v;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(t.is_empty());
+        UTEST_ASSERT(t.get(1) == NULL);
+        UTEST_ASSERT(!t.remove(1));
+        UTEST_ASSERT(t.values().end());
+        UTEST_ASSERT(t.lower_bound(1).end());
+
+        UTEST_ASSERT(*t.put(10, 100) == 100);
+        UTEST_ASSERT(*t.put(10, 101) == 101);
+        UTEST_ASSERT(t.create(10, 102) == NULL);
+        UTEST_ASSERT(*t.create(20, 200) == 200);
+        UTEST_ASSERT(*t.replace(20, 201) == 201);
+        UTEST_ASSERT(t.replace(30, 300) == NULL);
+        UTEST_ASSERT(t.size() == 2);
+        UTEST_ASSERT(t.contains(10));
+        UTEST_ASSERT(!t.contains(30));
+
+        UTEST_ASSERT(t.remove(10, &v));
+        UTEST_ASSERT(v == 101);
+        UTEST_ASSERT(!t.contains(10));
+        UTEST_ASSERT(t.remove(20));
+        UTEST_ASSERT(t.is_empty());
+        UTEST_ASSERT(t.values().end());
+    }
+
+    void test_default_compare()
+    {
+        lltl::btree<int, int> t;
+        static const int keys[] = { -1, 1, 256 };
+
+        printf("Testing default comparator...\n");
+
+        // Arithmetic keys are ordered numerically
+        UTEST_ASSERT(t.put(256, 0) != NULL);
+        UTEST_ASSERT(t.put(1, 0) != NULL);
+        UTEST_ASSERT(t.put(-1, 0) != NULL);
+
+        size_t n = 0;
+        for (lltl::btree<int, int>::iterator it = t.values(); !it.end(); ++it, ++n)
+        {
+            UTEST_ASSERT(n < 3);
+            UTEST_ASSERT(*it.key() == keys[n]);
+        }
+        UTEST_ASSERT(n == 3);
+    }
+
+    void test_swap()
+    {
+        lltl::btree<int, int> t, o;
+
+        printf("Testing swap...\n");
+
+        // Swap invalidates iterators of both trees, even with equal modification counters
+        for (int i=0; i<3; ++i)
+        {
+            UTEST_ASSERT(t.put(i + 10, i) != NULL);
+            UTEST_ASSERT(o.put(i, i) != NULL);
+        }
+        lltl::btree<int, int>::iterator it1 = t.values();
+        lltl::btree<int, int>::iterator it2 = o.values();
+        UTEST_ASSERT(it1.valid() && it2.valid());
+        t.swap(o);
+        UTEST_ASSERT(!it1.valid());
+        UTEST_ASSERT(!it2.valid());
+        UTEST_ASSERT(*t.values().key() == 0);
+        UTEST_ASSERT(*o.values().key() == 10);
+    }
+
+    void test_bounds()
+    {
+        lltl::btree<int, int> t(cmp_int);
+
+        printf("Testing bounds and ranges...\n");
+
+        // Even keys 0..19998
+        for (int i=0; i<10000; ++i)
+            UTEST_ASSERT(t.put(i * 2, i) != NULL);
+
+        for (int k=-1; k<=20000; k += 7)
+        {
+            int lb = (k < 0) ? 0 : (k + 1) & ~1;
+            int ub = (k < 0) ? 0 : (k + 2) & ~1;
+            int fl = (k < 0) ? -1 : k & ~1;
+
+            int_iterator it = t.lower_bound(k);
+            if (lb >= 20000)
+            {
+                UTEST_ASSERT(it.end());
+            }
+            else
+            {
+                UTEST_ASSERT(*it.key() == lb);
+            }
+
+            it = t.upper_bound(k);
+            if (ub >= 20000)
+            {
+                UTEST_ASSERT(it.end());
+            }
+            else
+            {
+                UTEST_ASSERT(*it.key() == ub);
+            }
+
+            it = t.floor(k);
+            if (fl < 0)
+            {
+                UTEST_ASSERT(it.end());
+            }
+            else
+            {
+                UTEST_ASSERT(*it.key() == ((fl >= 20000) ? 19998 : fl));
+                UTEST_ASSERT(*it.get() == *it.key() / 2);
+            }
+        }
+
+        // Ranges with different steps
+        for (int first=-3; first<20010; first += 997)
+        {
+            for (int len=0; len<500; len += 37)
+            {
+                int last = first + len;
+                for (size_t step=1; step<=64; step <<= 1)
+                {
+                    int expect = (first <= 0) ? 0 : (first + 1) & ~1;
+                    for (int_iterator it = t.range(first, last); it; it += step)
+                    {
+                        UTEST_ASSERT(*it.key() == expect);
+                        UTEST_ASSERT(*it.key() < last);
+                        expect     += step * 2;
+                    }
+                    int end = (last <= 0) ? 0 : (last + 1) & ~1;
+                    if (end > 20000)
+                        end = 20000;
+                    UTEST_ASSERT_MSG(expect >= end, "Range [%d, %d) with step %d ended at %d", first, last, int(step), expect);
+                }
+            }
+        }
+
+        // Modification invalidates iterators
+        int_iterator it = t.values();
+        UTEST_ASSERT(it.valid());
+        UTEST_ASSERT(t.put(1, 1) != NULL);
+        UTEST_ASSERT(!it.valid());
+        UTEST_ASSERT(it.get() == NULL);
+    }
+
+    template <class V>
+    void test_random(const char *name)
+    {
+        lltl::btree<int, V> t(cmp_int);
+        bool present[KEYS];
+        V v;
+
+        printf("Testing random insertion and removal of %s...\n", name);
+
+        for (size_t i=0; i<KEYS; ++i)
+            present[i]  = false;
+
+        for (size_t i=0; i<100000; ++i)
+        {
+            int k       = rand() % KEYS;
+
+            // Keep the tree filled by half in average
+            if (rand() & 1)
+            {
+                v.key       = k;
+                v.data[0]   = uint8_t(k);
+                V *p        = t.put(k, v);
+                UTEST_ASSERT(p != NULL);
+                UTEST_ASSERT((p->key == k) && (p->data[0] == uint8_t(k)));
+                present[k]  = true;
+            }
+            else
+            {
+                UTEST_ASSERT(t.remove(k, &v) == present[k]);
+                if (present[k])
+                {
+                    UTEST_ASSERT((v.key == k) && (v.data[0] == uint8_t(k)));
+                }
+                present[k]  = false;
+            }
+
+            if ((i % 10000) == 0)
+                check_content(t, present);
+        }
+        check_content(t, present);
+
+        // Remove everything
+        for (int k=0; k<KEYS; ++k)
+        {
+            UTEST_ASSERT(t.remove(k) == present[k]);
+            present[k]  = false;
+        }
+        UTEST_ASSERT(t.is_empty());
+        check_content(t, present);
+    }
+
+    void test_load()
+    {
+        lltl::btree<int, big_t> t(cmp_int);
+        bool present[KEYS];
+        int *keys       = static_cast<int *>(malloc(KEYS * sizeof(int)));
+        big_t *values   = static_cast<big_t *>(malloc(KEYS * sizeof(big_t)));
+        UTEST_ASSERT((keys != NULL) && (values != NULL));
+
+        printf("Testing bulk load...\n");
+
+        for (size_t n=0; n<=KEYS; n = n * 3 + 1)
+        {
+            for (size_t i=0; i<KEYS; ++i)
+                present[i]  = (i < n);
+            for (size_t i=0; i<n; ++i)
+            {
+                keys[i]         = i;
+                values[i].key   = i;
+            }
+
+            UTEST_ASSERT(t.load(n, keys, values));
+            UTEST_ASSERT(t.size() == n);
+            check_content(t, present);
+
+            // The tree remains consistent after modifications
+            for (size_t i=0; i<n; i += 3)
+            {
+                UTEST_ASSERT(t.remove(int(i)));
+                present[i]  = false;
+            }
+            check_content(t, present);
+        }
+
+        // Unsorted input is rejected, the content remains
+        keys[0] = 1;
+        keys[1] = 1;
+        size_t size = t.size();
+        UTEST_ASSERT(!t.load(2, keys, values));
+        UTEST_ASSERT(t.size() == size);
+
+        t.clear();
+        UTEST_ASSERT(t.is_empty());
+
+        free(keys);
+        free(values);
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_basic();
+        test_default_compare();
+        test_swap();
+        test_bounds();
+        test_random<small_t>("small items");
+        test_random<big_t>("big items");
+        test_load();
+    }
+
+UTEST_END
+
+
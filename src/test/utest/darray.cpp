@@ -804,6 +804,356 @@ UTEST_BEGIN("lltl", darray)
         printf("\n");
     }
 
+    void test_psort()
+    {
+        static const size_t N = 100000;
+
+        printf("Testing parallel sort...\n");
+
+        lltl::darray<int> a, b;
+        int *v = a.append_n(N);
+        UTEST_ASSERT(v != NULL);
+
+        uint32_t seed = 1;
+        for (size_t threads=1; threads<=8; ++threads)
+        {
+            // Fill with values with many duplicates
+            for (size_t i=0; i<N; ++i)
+            {
+                seed    = seed * 1103515245 + 12345;
+                v[i]    = int((seed >> 8) % (N / 4));
+            }
+            b.clear();
+            UTEST_ASSERT(b.add_n(N, a.array()));
+            b.qsort(test_int_cmp);
+
+            // Compare with single-threaded sort
+            a.psort(test_int_cmp, threads, 1000);
+            v       = a.array();
+            UTEST_ASSERT(a.size() == N);
+            UTEST_ASSERT(::memcmp(a.array(), b.array(), N * sizeof(int)) == 0);
+
+            a.psort(test_int_cmp2, threads, 1000);
+            for (size_t i=1; i<N; ++i)
+                UTEST_ASSERT(v[i-1] >= v[i]);
+        }
+
+        // Small array is sorted by single thread
+        a.truncate(10);
+        a.psort(test_int_cmp, 4);
+        for (size_t i=1; i<a.size(); ++i)
+            UTEST_ASSERT(*a.uget(i-1) <= *a.uget(i));
+    }
+
+    typedef struct keyed_t
+    {
+        uint32_t    id;
+        int16_t     key;
+        uint16_t    pad;
+    } keyed_t;
+
+    template <class T>
+        bool check_radix_sort(const T *v, size_t n)
+        {
+            lltl::darray<T> a;
+            if (!a.add_n(n, v))
+                return false;
+            if (!a.radix_sort())
+                return false;
+            if (a.size() != n)
+                return false;
+            for (size_t i=1; i<n; ++i)
+                if (*a.uget(i-1) > *a.uget(i))
+                    return false;
+            return true;
+        }
+
+    void test_radix_sort()
+    {
+        static const size_t N = 10000;
+
+        printf("Testing radix sort...\n");
+
+        uint32_t *u32   = new uint32_t[N];
+        int *i32        = new int[N];
+        uint64_t *u64   = new uint64_t[N];
+        int64_t *i64    = new int64_t[N];
+        unsigned long long *ull = new unsigned long long[N];
+        long long *ll   = new long long[N];
+        float *f32      = new float[N];
+        double *f64     = new double[N];
+        uint8_t *u8     = new uint8_t[N];
+
+        uint32_t seed = 1;
+        for (size_t i=0; i<N; ++i)
+        {
+            seed        = seed * 1103515245 + 12345;
+            u32[i]      = seed;
+            i32[i]      = int32_t(seed);
+            u64[i]      = (uint64_t(seed) << 32) | (seed * 7);
+            i64[i]      = int64_t(u64[i]);
+            ull[i]      = u64[i];
+            ll[i]       = i64[i];
+            f32[i]      = float(int32_t(seed)) * 1e-5f;
+            f64[i]      = double(int32_t(seed)) * 1e+10;
+            u8[i]       = uint8_t(seed >> 16);
+        }
+        f32[0]  = 0.0f;
+        f32[1]  = -0.0f;
+        f32[2]  = 1.0f / f32[0];
+        f32[3]  = -1.0f / f32[0];
+        f64[0]  = -1e-300;
+
+        UTEST_ASSERT(check_radix_sort(u32, N));
+        UTEST_ASSERT(check_radix_sort(i32, N));
+        UTEST_ASSERT(check_radix_sort(u64, N));
+        UTEST_ASSERT(check_radix_sort(i64, N));
+        UTEST_ASSERT(check_radix_sort(ull, N));
+        UTEST_ASSERT(check_radix_sort(ll, N));
+        UTEST_ASSERT(check_radix_sort(f32, N));
+        UTEST_ASSERT(check_radix_sort(f64, N));
+        UTEST_ASSERT(check_radix_sort(u8, N));
+        UTEST_ASSERT(check_radix_sort(u32, 1));
+        UTEST_ASSERT(check_radix_sort(u32, 0));
+
+        // Sort structures by the key field, the sort should be stable
+        lltl::darray<keyed_t> k;
+        for (size_t i=0; i<N; ++i)
+        {
+            keyed_t *x  = k.add();
+            UTEST_ASSERT(x != NULL);
+            x->id       = i;
+            x->key      = int16_t(i32[i] % 100);
+            x->pad      = 0;
+        }
+        UTEST_ASSERT(k.radix_sort(offsetof(keyed_t, key), sizeof(int16_t), lltl::RADIX_SIGNED));
+        for (size_t i=1; i<N; ++i)
+        {
+            const keyed_t *a = k.uget(i-1), *b = k.uget(i);
+            UTEST_ASSERT((a->key < b->key) || ((a->key == b->key) && (a->id < b->id)));
+        }
+
+        // Invalid keys
+        UTEST_ASSERT(!k.radix_sort(offsetof(keyed_t, key), 3, lltl::RADIX_SIGNED));
+        UTEST_ASSERT(!k.radix_sort(offsetof(keyed_t, pad), sizeof(uint32_t), lltl::RADIX_UNSIGNED));
+        UTEST_ASSERT(!k.radix_sort(offsetof(keyed_t, key), sizeof(int16_t), lltl::RADIX_FLOAT));
+
+        delete [] u32;
+        delete [] i32;
+        delete [] u64;
+        delete [] i64;
+        delete [] ull;
+        delete [] ll;
+        delete [] f32;
+        delete [] f64;
+        delete [] u8;
+    }
+
+    static bool is_negative(const int *item, int *threshold)
+    {
+        return *item < *threshold;
+    }
+
+    void test_search()
+    {
+        printf("Testing search...\n");
+
+        lltl::darray<int> a;
+        lltl::darray<int64_t> b;
+        lltl::darray<keyed_t> k;
+        lltl::compare_spec<int> cmp;
+
+        UTEST_ASSERT(a.find(1) < 0);
+        UTEST_ASSERT(a.count(1) == 0);
+
+        for (int i=0; i<100; ++i)
+        {
+            UTEST_ASSERT(a.add(i % 10));
+            UTEST_ASSERT(b.add(int64_t(i % 10) << 40));
+            keyed_t *x = k.add();
+            UTEST_ASSERT(x != NULL);
+            x->id       = i;
+            x->key      = int16_t(i % 10);
+            x->pad      = 0;
+        }
+        UTEST_ASSERT(a.add(-1));
+
+        // Bitwise search
+        UTEST_ASSERT(a.find(7) == 7);
+        UTEST_ASSERT(a.find(7, 8) == 17);
+        UTEST_ASSERT(a.find(7, 98) < 0);
+        UTEST_ASSERT(a.find(-1) == 100);
+        UTEST_ASSERT(a.find(11) < 0);
+        UTEST_ASSERT(a.count(3) == 10);
+        UTEST_ASSERT(a.count(-1) == 1);
+        UTEST_ASSERT(a.count(11) == 0);
+
+        UTEST_ASSERT(b.find(int64_t(5) << 40) == 5);
+        UTEST_ASSERT(b.find(int64_t(5) << 40, 6) == 15);
+        UTEST_ASSERT(b.find(int64_t(5)) < 0);
+        UTEST_ASSERT(b.count(int64_t(9) << 40) == 10);
+
+        keyed_t x;
+        x.id = 42; x.key = 2; x.pad = 0;
+        UTEST_ASSERT(k.find(x) == 42);
+        UTEST_ASSERT(k.count(x) == 1);
+
+        // Search with comparator
+        int v = 4;
+        UTEST_ASSERT(a.find(&v, cmp) == 4);
+        UTEST_ASSERT(a.find(&v, cmp, 5) == 14);
+        UTEST_ASSERT(a.count(&v, cmp) == 10);
+
+        // Search with predicate
+        int threshold = 0;
+        UTEST_ASSERT(a.find_if(is_negative, &threshold) == 100);
+        threshold = 1;
+        UTEST_ASSERT(a.find_if(is_negative, &threshold, 1) == 10);
+        threshold = -1;
+        UTEST_ASSERT(a.find_if(is_negative, &threshold) < 0);
+    }
+
+    void test_range()
+    {
+        printf("Testing contiguous range...\n");
+
+        lltl::darray<int> x;
+        const lltl::darray<int> &cx = x;
+
+        UTEST_ASSERT(x.begin() == x.end());
+        UTEST_ASSERT(cx.begin() == cx.end());
+
+        for (int i=0; i<100; ++i)
+            UTEST_ASSERT(x.add(i));
+        UTEST_ASSERT(size_t(x.end() - x.begin()) == x.size());
+        UTEST_ASSERT(x.begin() == x.first());
+        UTEST_ASSERT(x.end() - 1 == x.last());
+
+        for (int *p = x.begin(), *e = x.end(); p < e; ++p)
+            *p     *= 2;
+
+        int sum = 0;
+        for (const int *p = cx.begin(), *e = cx.end(); p < e; ++p)
+            sum    += *p;
+        UTEST_ASSERT(sum == 99 * 100);
+    }
+
+    void test_iterator()
+    {
+        printf("Testing iterators...\n");
+
+        lltl::darray<int> x;
+        lltl::iterator<int> it = x.values();
+        UTEST_ASSERT(!it);
+        UTEST_ASSERT(it.get() == NULL);
+
+        for (int i=0; i<100; ++i)
+            UTEST_ASSERT(x.add(&i));
+
+        // Simple traversal
+        int n = 0;
+        for (it = x.values(); it; ++it, ++n)
+            UTEST_ASSERT(**it == n);
+        UTEST_ASSERT(n == 100);
+
+        // Advance
+        it = x.values();
+        it += 10;
+        UTEST_ASSERT(**it == 10);
+        lltl::iterator<int> prev = it++;
+        UTEST_ASSERT(**prev == 10);
+        UTEST_ASSERT(**it == 11);
+        it += 1000;
+        UTEST_ASSERT(!it);
+
+        // Remove odd elements while iterating
+        for (it = x.values(); it; )
+        {
+            if (**it & 1)
+                UTEST_ASSERT(it.remove())
+            else
+                ++it;
+        }
+        UTEST_ASSERT(x.size() == 50);
+        for (int i=0; i<50; ++i)
+            UTEST_ASSERT(*x.uget(i) == i*2);
+
+        // Invalidation by modification
+        it = x.values();
+        UTEST_ASSERT(it.valid());
+        UTEST_ASSERT(x.add(&n));
+        UTEST_ASSERT(!it.valid());
+        UTEST_ASSERT(!it);
+        UTEST_ASSERT(it.get() == NULL);
+    }
+
+    static inline bool is_aligned(const void *ptr, size_t align)
+    {
+        return (reinterpret_cast<uintptr_t>(ptr) & (align - 1)) == 0;
+    }
+
+    void test_alignment()
+    {
+        printf("Testing aligned storage...\n");
+
+        lltl::darray<float> d;
+        UTEST_ASSERT(d.alignment() == lltl::raw_darray::MALLOC_ALIGN);
+
+        // Alignment is kept across growth and truncation
+        lltl::darray<float> x(64);
+        UTEST_ASSERT(x.alignment() == 64);
+        for (int i=0; i<10000; ++i)
+        {
+            float v = i;
+            UTEST_ASSERT(x.add(&v));
+            UTEST_ASSERT(is_aligned(x.array(), 64));
+        }
+        UTEST_ASSERT(x.truncate(100));
+        UTEST_ASSERT(x.size() == 100);
+        UTEST_ASSERT(is_aligned(x.array(), 64));
+        for (int i=0; i<100; ++i)
+            UTEST_ASSERT(*x.uget(i) == i);
+
+        // Change of alignment moves the data
+        UTEST_ASSERT(x.set_alignment(4096));
+        UTEST_ASSERT(x.alignment() == 4096);
+        UTEST_ASSERT(is_aligned(x.array(), 4096));
+        UTEST_ASSERT(x.set_alignment(48));
+        UTEST_ASSERT(x.alignment() == 64);
+        UTEST_ASSERT(is_aligned(x.array(), 64));
+        for (int i=0; i<100; ++i)
+            UTEST_ASSERT(*x.uget(i) == i);
+
+        // Radix sort swaps the storage with aligned scratch buffer
+        for (int i=0; i<100; ++i)
+            *x.uget(i)  = 100 - i;
+        UTEST_ASSERT(x.radix_sort());
+        UTEST_ASSERT(is_aligned(x.array(), 64));
+        for (int i=0; i<100; ++i)
+            UTEST_ASSERT(*x.uget(i) == i + 1);
+
+        // Swap exchanges the storage together with alignment
+        x.swap(d);
+        UTEST_ASSERT(d.alignment() == 64);
+        UTEST_ASSERT(x.alignment() == lltl::raw_darray::MALLOC_ALIGN);
+        UTEST_ASSERT(d.size() == 100);
+
+        // Released data can be freed with free()
+        float *data = d.release();
+        UTEST_ASSERT(data != NULL);
+        for (int i=0; i<100; ++i)
+            UTEST_ASSERT(data[i] == i + 1);
+        UTEST_ASSERT(d.is_empty());
+        free(data);
+
+        // Reset to default allocation
+        UTEST_ASSERT(d.append_n(10) != NULL);
+        UTEST_ASSERT(is_aligned(d.array(), 64));
+        UTEST_ASSERT(d.set_alignment(0));
+        UTEST_ASSERT(d.alignment() == lltl::raw_darray::MALLOC_ALIGN);
+        UTEST_ASSERT(d.size() == 10);
+    }
+
     UTEST_MAIN
     {
         test_single();
@@ -814,6 +1164,12 @@ UTEST_BEGIN("lltl", darray)
         test_xswap();
         test_long_xswap();
         test_sort();
+        test_psort();
+        test_radix_sort();
+        test_search();
+        test_range();
+        test_iterator();
+        test_alignment();
     }
 
 UTEST_END
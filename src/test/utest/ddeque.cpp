@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/ddeque.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+UTEST_BEGIN("lltl", ddeque)
+
+    void test_basic()
+    {
+        lltl::ddeque<int> q;
+        int x;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(q.is_empty());
+        UTEST_ASSERT(q.first() == NULL);
+        UTEST_ASSERT(q.last() == NULL);
+        UTEST_ASSERT(!q.pop());
+        UTEST_ASSERT(!q.shift());
+        UTEST_ASSERT(q.shift(&x) == NULL);
+
+        // Push to both ends
+        for (int i=0; i<10; ++i)
+        {
+            UTEST_ASSERT(q.push(i) != NULL);
+            UTEST_ASSERT(q.unshift(-i - 1) != NULL);
+        }
+        UTEST_ASSERT(q.size() == 20);
+        UTEST_ASSERT(q.capacity() == 32);
+        for (int i=0; i<20; ++i)
+            UTEST_ASSERT(*q.get(i) == i - 10);
+        UTEST_ASSERT(q.get(20) == NULL);
+        UTEST_ASSERT(*q.first() == -10);
+        UTEST_ASSERT(*q.last() == 9);
+
+        // Remove from both ends
+        UTEST_ASSERT(q.shift(&x) == &x);
+        UTEST_ASSERT(x == -10);
+        UTEST_ASSERT(q.pop(x) == &x);
+        UTEST_ASSERT(x == 9);
+        UTEST_ASSERT(q.shift());
+        UTEST_ASSERT(q.pop());
+        UTEST_ASSERT(q.size() == 16);
+        UTEST_ASSERT(*q.first() == -8);
+        UTEST_ASSERT(*q.last() == 7);
+
+        // FIFO with wrapping, capacity should not change
+        for (int i=0; i<1000; ++i)
+        {
+            UTEST_ASSERT(q.push(i + 100) != NULL);
+            UTEST_ASSERT(q.shift(&x) != NULL);
+        }
+        UTEST_ASSERT(q.capacity() == 32);
+        UTEST_ASSERT(q.size() == 16);
+        for (int i=0; i<16; ++i)
+            UTEST_ASSERT(*q.get(i) == 1084 + i);
+
+        // Grow with wrapped content
+        for (int i=0; i<100; ++i)
+            UTEST_ASSERT(q.push(i + 1100) != NULL);
+        UTEST_ASSERT(q.size() == 116);
+        UTEST_ASSERT(q.capacity() == 128);
+        for (int i=0; i<116; ++i)
+            UTEST_ASSERT(*q.get(i) == 1084 + i);
+
+        q.clear();
+        UTEST_ASSERT(q.is_empty());
+        UTEST_ASSERT(q.capacity() == 128);
+        q.flush();
+        UTEST_ASSERT(q.capacity() == 0);
+    }
+
+    void test_bulk()
+    {
+        lltl::ddeque<int> q;
+        int v[100], r[100];
+        int *a, *b;
+        size_t na, nb;
+
+        printf("Testing bulk operations...\n");
+
+        for (int i=0; i<100; ++i)
+            v[i]    = i;
+
+        UTEST_ASSERT(q.segments(&a, &na, &b, &nb) == 0);
+        UTEST_ASSERT(q.reserve(64));
+        UTEST_ASSERT(q.capacity() == 64);
+
+        // Make the content wrap around the end of the buffer
+        UTEST_ASSERT(q.append_n(50, v));
+        UTEST_ASSERT(q.shift_n(40, r) == 40);
+        for (int i=0; i<40; ++i)
+            UTEST_ASSERT(r[i] == i);
+        UTEST_ASSERT(q.append_n(40, &v[50]));
+        UTEST_ASSERT(q.size() == 50);
+        UTEST_ASSERT(q.capacity() == 64);
+
+        UTEST_ASSERT(q.segments(&a, &na, &b, &nb) == 2);
+        UTEST_ASSERT(na == 24);
+        UTEST_ASSERT(nb == 26);
+        UTEST_ASSERT(a[0] == 40);
+        UTEST_ASSERT(b[0] == 64);
+        UTEST_ASSERT(b[nb - 1] == 89);
+
+        // Prepend and pop in bulk
+        UTEST_ASSERT(q.prepend_n(10, &v[30]));
+        UTEST_ASSERT(q.size() == 60);
+        for (int i=0; i<60; ++i)
+            UTEST_ASSERT(*q.get(i) == i + 30);
+        UTEST_ASSERT(q.pop_n(5, r) == 5);
+        for (int i=0; i<5; ++i)
+            UTEST_ASSERT(r[i] == 85 + i);
+
+        // Grow on bulk insertion
+        UTEST_ASSERT(q.append_n(100, v));
+        UTEST_ASSERT(q.size() == 155);
+        UTEST_ASSERT(q.capacity() == 256);
+        UTEST_ASSERT(q.segments(&a, &na, &b, &nb) == 1);
+        UTEST_ASSERT(na == 155);
+        UTEST_ASSERT(a[54] == 84);
+        UTEST_ASSERT(a[55] == 0);
+
+        UTEST_ASSERT(q.shift_n(1000) == 155);
+        UTEST_ASSERT(q.is_empty());
+    }
+
+    void test_pdeque()
+    {
+        lltl::pdeque<int> q;
+        int v[100];
+        int **a, **b;
+        size_t na, nb;
+
+        printf("Testing pointer deque...\n");
+
+        UTEST_ASSERT(q.pop() == NULL);
+        UTEST_ASSERT(q.shift() == NULL);
+        UTEST_ASSERT(q.first() == NULL);
+
+        for (int i=0; i<100; ++i)
+        {
+            v[i]    = i;
+            UTEST_ASSERT((i & 1) ? q.push(&v[i]) : q.unshift(&v[i]));
+        }
+        UTEST_ASSERT(q.size() == 100);
+        UTEST_ASSERT(q.first() == &v[98]);
+        UTEST_ASSERT(q.last() == &v[99]);
+        UTEST_ASSERT(q[49] == &v[0]);
+        UTEST_ASSERT(q[50] == &v[1]);
+
+        UTEST_ASSERT(q.segments(&a, &na, &b, &nb) > 0);
+        UTEST_ASSERT(na + nb == 100);
+
+        for (int i=98; i>=0; i -= 2)
+            UTEST_ASSERT(q.shift() == &v[i]);
+        for (int i=99; i>=1; i -= 2)
+            UTEST_ASSERT(q.pop() == &v[i]);
+        UTEST_ASSERT(q.is_empty());
+    }
+
+    UTEST_MAIN
+    {
+        test_basic();
+        test_bulk();
+        test_pdeque();
+    }
+
+UTEST_END
+
+
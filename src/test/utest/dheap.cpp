@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/dheap.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdlib.h>
+
+UTEST_BEGIN("lltl", dheap)
+
+    typedef struct event_t
+    {
+        size_t      time;
+        size_t      id;
+    } event_t;
+
+    static ssize_t cmp_int(const void *a, const void *b, size_t size)
+    {
+        int ia = *static_cast<const int *>(a);
+        int ib = *static_cast<const int *>(b);
+        return (ia < ib) ? -1 : (ia > ib) ? 1 : 0;
+    }
+
+    static ssize_t cmp_event(const void *a, const void *b, size_t size)
+    {
+        const event_t *ea = static_cast<const event_t *>(a);
+        const event_t *eb = static_cast<const event_t *>(b);
+        return (ea->time < eb->time) ? -1 : (ea->time > eb->time) ? 1 : 0;
+    }
+
+    void check_sorted(lltl::dheap<int> &h, size_t count)
+    {
+        int prev, x;
+
+        UTEST_ASSERT(h.size() == count);
+        for (size_t i=0; i<count; ++i)
+        {
+            UTEST_ASSERT(h.pop(&x) == &x);
+            if (i > 0)
+                UTEST_ASSERT(prev <= x);
+            prev    = x;
+        }
+        UTEST_ASSERT(h.is_empty());
+        UTEST_ASSERT(!h.pop());
+    }
+
+    void test_basic()
+    {
+        lltl::dheap<int> h(cmp_int);
+        int x;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(h.top() == NULL);
+        UTEST_ASSERT(h.top_handle() < 0);
+        UTEST_ASSERT(!h.pop());
+        UTEST_ASSERT(h.pop(&x) == NULL);
+
+        // Random values
+        for (size_t i=0; i<1000; ++i)
+            UTEST_ASSERT(h.push(int(rand() % 500)) >= 0);
+        UTEST_ASSERT(h.size() == 1000);
+        check_sorted(h, 1000);
+
+        // Descending values
+        for (int i=0; i<100; ++i)
+        {
+            UTEST_ASSERT(h.push(100 - i) >= 0);
+            UTEST_ASSERT(*h.top() == 100 - i);
+        }
+        check_sorted(h, 100);
+    }
+
+    void test_handles()
+    {
+        lltl::dheap<int> h(cmp_int);
+        ssize_t handles[100];
+        int x;
+
+        printf("Testing handles...\n");
+
+        for (int i=0; i<100; ++i)
+        {
+            handles[i]  = h.push(i * 10);
+            UTEST_ASSERT(handles[i] >= 0);
+        }
+        for (int i=0; i<100; ++i)
+        {
+            UTEST_ASSERT(h.contains(handles[i]));
+            UTEST_ASSERT(*h.get(handles[i]) == i * 10);
+        }
+        UTEST_ASSERT(!h.contains(100));
+        UTEST_ASSERT(h.get(100) == NULL);
+
+        // Decrease key
+        UTEST_ASSERT(h.update(handles[50], -1));
+        UTEST_ASSERT(*h.top() == -1);
+        UTEST_ASSERT(h.top_handle() == handles[50]);
+
+        // Increase key
+        UTEST_ASSERT(h.update(handles[50], 2000));
+        UTEST_ASSERT(*h.top() == 0);
+        UTEST_ASSERT(h.update(handles[0], 1995));
+        UTEST_ASSERT(*h.top() == 10);
+
+        // Remove by handle
+        UTEST_ASSERT(h.remove(handles[10], &x) == &x);
+        UTEST_ASSERT(x == 100);
+        UTEST_ASSERT(!h.contains(handles[10]));
+        UTEST_ASSERT(!h.remove(handles[10]));
+        UTEST_ASSERT(!h.update(handles[10], 0));
+        UTEST_ASSERT(h.size() == 99);
+
+        // Handles remain valid after other changes
+        for (int i=0; i<100; ++i)
+        {
+            if ((i == 0) || (i == 10) || (i == 50))
+                continue;
+            UTEST_ASSERT(*h.get(handles[i]) == i * 10);
+        }
+
+        // Handles of removed elements are reused
+        ssize_t nh  = h.push(5);
+        UTEST_ASSERT(nh == handles[10]);
+        UTEST_ASSERT(*h.top() == 5);
+
+        // Check the order
+        UTEST_ASSERT(h.pop(&x) != NULL);
+        UTEST_ASSERT(x == 5);
+        for (int i=1; i<100; ++i)
+        {
+            if ((i == 10) || (i == 50))
+                continue;
+            UTEST_ASSERT(h.pop(&x) != NULL);
+            UTEST_ASSERT(x == i * 10);
+        }
+        UTEST_ASSERT(h.pop(&x) != NULL);
+        UTEST_ASSERT(x == 1995);
+        UTEST_ASSERT(h.pop(&x) != NULL);
+        UTEST_ASSERT(x == 2000);
+        UTEST_ASSERT(h.is_empty());
+    }
+
+    void test_bulk()
+    {
+        lltl::dheap<int> h(cmp_int), o(cmp_int);
+        int v[1000];
+        size_t handles[1000];
+
+        printf("Testing bulk operations...\n");
+
+        for (size_t i=0; i<1000; ++i)
+            v[i]    = rand() % 10000;
+
+        // Heapify
+        UTEST_ASSERT(h.push_n(1000, v, handles));
+        for (size_t i=0; i<1000; ++i)
+            UTEST_ASSERT(*h.get(handles[i]) == v[i]);
+        check_sorted(h, 1000);
+
+        // Sift up
+        UTEST_ASSERT(h.push_n(900, v));
+        UTEST_ASSERT(h.push_n(100, &v[900], handles));
+        for (size_t i=0; i<100; ++i)
+            UTEST_ASSERT(*h.get(handles[i]) == v[900 + i]);
+        check_sorted(h, 1000);
+
+        // Merge
+        UTEST_ASSERT(h.push_n(500, v));
+        UTEST_ASSERT(o.push_n(500, &v[500]));
+        UTEST_ASSERT(h.merge(o));
+        UTEST_ASSERT(o.is_empty());
+        UTEST_ASSERT(o.top() == NULL);
+        check_sorted(h, 1000);
+
+        // Swap
+        UTEST_ASSERT(o.push(1) >= 0);
+        h.swap(o);
+        UTEST_ASSERT(o.is_empty());
+        UTEST_ASSERT(*h.top() == 1);
+        h.flush();
+        UTEST_ASSERT(h.capacity() == 0);
+    }
+
+    void test_default_compare()
+    {
+        lltl::dheap<int> h;
+        lltl::dheap<double> d;
+        int x;
+        double y;
+
+        printf("Testing default comparator...\n");
+
+        // Arithmetic types are ordered numerically
+        UTEST_ASSERT(h.push(256) >= 0);
+        UTEST_ASSERT(h.push(1) >= 0);
+        UTEST_ASSERT(h.push(-1) >= 0);
+        UTEST_ASSERT(h.pop(&x) && (x == -1));
+        UTEST_ASSERT(h.pop(&x) && (x == 1));
+        UTEST_ASSERT(h.pop(&x) && (x == 256));
+
+        UTEST_ASSERT(d.push(2.5) >= 0);
+        UTEST_ASSERT(d.push(-0.5) >= 0);
+        UTEST_ASSERT(d.push(-3.0) >= 0);
+        UTEST_ASSERT(d.push(1.0) >= 0);
+        UTEST_ASSERT(d.pop(&y) && (y == -3.0));
+        UTEST_ASSERT(d.pop(&y) && (y == -0.5));
+        UTEST_ASSERT(d.pop(&y) && (y == 1.0));
+        UTEST_ASSERT(d.pop(&y) && (y == 2.5));
+    }
+
+    void test_aliasing()
+    {
+        lltl::dheap<int> h(cmp_int);
+
+        printf("Testing push of own items...\n");
+
+        // Push the top item when the heap is at full capacity
+        UTEST_ASSERT(h.reserve(4));
+        while (h.size() < h.capacity())
+            UTEST_ASSERT(h.push(int(h.size()) + 10) >= 0);
+        size_t cap = h.capacity();
+        UTEST_ASSERT(h.push(*h.top()) >= 0);
+        UTEST_ASSERT(h.capacity() > cap);
+        UTEST_ASSERT(h.size() == cap + 1);
+        UTEST_ASSERT(*h.top() == 10);
+
+        // Bulk push of own item when the heap is at full capacity
+        while (h.size() < h.capacity())
+            UTEST_ASSERT(h.push(int(h.size()) + 10) >= 0);
+        cap = h.capacity();
+        UTEST_ASSERT(h.push_n(1, h.top()));
+        UTEST_ASSERT(h.capacity() > cap);
+        UTEST_ASSERT(*h.top() == 10);
+        check_sorted(h, cap + 1);
+    }
+
+    void test_pheap()
+    {
+        lltl::pheap<event_t> h(cmp_event);
+        event_t ev[100];
+        ssize_t handles[100];
+
+        printf("Testing pointer heap...\n");
+
+        UTEST_ASSERT(h.pop() == NULL);
+
+        for (size_t i=0; i<100; ++i)
+        {
+            ev[i].time  = (i * 37) % 100;
+            ev[i].id    = i;
+            handles[i]  = h.push(&ev[i]);
+            UTEST_ASSERT(handles[i] >= 0);
+        }
+        UTEST_ASSERT(h.top()->time == 0);
+
+        // Modify the object in place and update the position
+        ev[50].time = 1000;
+        UTEST_ASSERT(h.update(handles[50]));
+        UTEST_ASSERT(h.get(handles[50]) == &ev[50]);
+        UTEST_ASSERT(h.remove(handles[1]) == &ev[1]);
+
+        size_t prev = 0;
+        for (size_t i=0; i<98; ++i)
+        {
+            event_t *e  = h.pop();
+            UTEST_ASSERT(e != NULL);
+            UTEST_ASSERT(e->time >= prev);
+            UTEST_ASSERT(e != &ev[1]);
+            prev        = e->time;
+        }
+        UTEST_ASSERT(h.pop() == &ev[50]);
+        UTEST_ASSERT(h.is_empty());
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_basic();
+        test_handles();
+        test_bulk();
+        test_default_compare();
+        test_aliasing();
+        test_pheap();
+    }
+
+UTEST_END
+
+
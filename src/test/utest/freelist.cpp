@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/freelist.h>
+#include <lsp-plug.in/lltl/pphash.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <pthread.h>
+
+#define THREADS         4
+#define ITERATIONS      100000
+#define BATCH           16
+
+namespace
+{
+    typedef struct pkey_t
+    {
+        int     a;
+        int     b;
+
+        pkey_t(int a, int b)
+        {
+            this->a     = a;
+            this->b     = b;
+        }
+
+        pkey_t(const pkey_t *src)
+        {
+            a           = src->a;
+            b           = src->b;
+        }
+    } pkey_t;
+
+    typedef struct counted_t
+    {
+        static int  nInstances;
+        size_t      value;
+
+        counted_t()     { value = 0; ++nInstances; }
+        ~counted_t()    { --nInstances; }
+    } counted_t;
+
+    int counted_t::nInstances = 0;
+}
+
+namespace lsp
+{
+    namespace lltl
+    {
+        template <>
+            struct compare_spec<pkey_t>: public compare_iface
+            {
+                static ssize_t cmp(const void *a, const void *b, size_t size)
+                {
+                    return ::memcmp(a, b, size);
+                }
+
+                inline compare_spec()
+                {
+                    compare     = cmp;
+                }
+            };
+
+        template <>
+            struct allocator_spec<pkey_t>: public freelist_allocator<pkey_t>
+            {
+            };
+    }
+}
+
+UTEST_BEGIN("lltl", freelist)
+
+    typedef struct context_t
+    {
+        lltl::freelist<size_t> *list;
+        size_t                  id;
+        bool                    failed;
+    } context_t;
+
+    void test_basic()
+    {
+        lltl::freelist<counted_t> fl;
+        counted_t *vc[100];
+
+        printf("Testing basic functions...\n");
+
+        // Empty list
+        UTEST_ASSERT(fl.size() == 0);
+        UTEST_ASSERT(fl.capacity() == 0);
+        UTEST_ASSERT(fl.alloc() == NULL);
+        UTEST_ASSERT(fl.create() == NULL);
+        UTEST_ASSERT(fl.drain(vc, 10) == 0);
+
+        // Prefill
+        UTEST_ASSERT(fl.prefill(100));
+        UTEST_ASSERT(fl.size() >= 100);
+        size_t cap = fl.capacity();
+        UTEST_ASSERT(fl.size() == cap);
+
+        // Allocate all objects and check that they are unique and aligned
+        for (size_t i=0; i<cap; ++i)
+        {
+            counted_t *c = fl.create();
+            UTEST_ASSERT(c != NULL);
+            UTEST_ASSERT((reinterpret_cast<uintptr_t>(c) & 0x0f) == 0);
+            c->value    = i;
+            if (i < 100)
+                vc[i]       = c;
+        }
+        UTEST_ASSERT(fl.size() == 0);
+        UTEST_ASSERT(fl.alloc() == NULL);
+        UTEST_ASSERT(counted_t::nInstances == ssize_t(cap));
+        for (size_t i=0; i<100; ++i)
+            UTEST_ASSERT(vc[i]->value == i);
+
+        // Return objects in bulk and by one
+        for (size_t i=0; i<50; ++i)
+            vc[i]->~counted_t();
+        fl.fill(vc, 50);
+        UTEST_ASSERT(fl.size() == 50);
+        for (size_t i=50; i<100; ++i)
+            fl.destroy(vc[i]);
+        UTEST_ASSERT(fl.size() == 100);
+        UTEST_ASSERT(counted_t::nInstances == ssize_t(cap - 100));
+
+        // Drain objects
+        counted_t *vd[100];
+        UTEST_ASSERT(fl.drain(vd, 30) == 30);
+        UTEST_ASSERT(fl.size() == 70);
+        UTEST_ASSERT(fl.drain(&vd[30], 100) == 70);
+        UTEST_ASSERT(fl.size() == 0);
+        for (size_t i=0; i<100; ++i)
+            for (size_t j=i+1; j<100; ++j)
+                UTEST_ASSERT(vd[i] != vd[j]);
+        fl.fill(vd, 100);
+
+        // Grow the list
+        UTEST_ASSERT(fl.prefill(cap * 4));
+        UTEST_ASSERT(fl.size() >= cap * 4);
+        UTEST_ASSERT(fl.capacity() > cap);
+
+        fl.flush();
+        UTEST_ASSERT(fl.size() == 0);
+        UTEST_ASSERT(fl.capacity() == 0);
+        counted_t::nInstances = 0;
+    }
+
+    void test_allocator()
+    {
+        lltl::pphash<pkey_t, int> h;
+        lltl::freelist<pkey_t> *pool = lltl::freelist_allocator<pkey_t>::pool();
+        int v[4];
+
+        printf("Testing allocator for hash keys...\n");
+
+        UTEST_ASSERT(pool->prefill(64));
+        size_t free = pool->size();
+
+        pkey_t k1(1, 2), k2(3, 4), k3(5, 6);
+        UTEST_ASSERT(h.put(&k1, &v[0], NULL));
+        UTEST_ASSERT(h.put(&k2, &v[1], NULL));
+        UTEST_ASSERT(h.put(&k3, &v[2], NULL));
+        UTEST_ASSERT(pool->size() == free - 3);
+
+        UTEST_ASSERT(h.get(&k1) == &v[0]);
+        UTEST_ASSERT(h.get(&k2) == &v[1]);
+        UTEST_ASSERT(h.get(&k3) == &v[2]);
+
+        UTEST_ASSERT(h.remove(&k2, NULL));
+        UTEST_ASSERT(pool->size() == free - 2);
+
+        h.flush();
+        UTEST_ASSERT(pool->size() == free);
+    }
+
+    static void *worker_main(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        size_t *items[BATCH];
+
+        for (size_t i=0; i<ITERATIONS; ++i)
+        {
+            // Take objects, mark them as owned and check that nobody else owns them
+            size_t n = ((i & 1) == 0) ? ctx->list->drain(items, BATCH) : 0;
+            for ( ; n < BATCH; ++n)
+            {
+                if ((items[n] = ctx->list->alloc()) == NULL)
+                    break;
+            }
+
+            for (size_t j=0; j<n; ++j)
+                *items[j]       = ctx->id;
+            for (size_t j=0; j<n; ++j)
+                if (*items[j] != ctx->id)
+                    ctx->failed     = true;
+
+            if ((i & 2) == 0)
+                ctx->list->fill(items, n);
+            else
+            {
+                for (size_t j=0; j<n; ++j)
+                    ctx->list->free(items[j]);
+            }
+        }
+
+        return NULL;
+    }
+
+    void test_concurrent()
+    {
+        lltl::freelist<size_t> fl;
+        context_t ctx[THREADS];
+        pthread_t tid[THREADS];
+
+        printf("Testing concurrent access...\n");
+        UTEST_ASSERT(fl.prefill(THREADS * BATCH / 2));
+        size_t cap = fl.capacity();
+
+        for (size_t i=0; i<THREADS; ++i)
+        {
+            ctx[i].list     = &fl;
+            ctx[i].id       = i + 1;
+            ctx[i].failed   = false;
+            UTEST_ASSERT(pthread_create(&tid[i], NULL, worker_main, &ctx[i]) == 0);
+        }
+        for (size_t i=0; i<THREADS; ++i)
+        {
+            pthread_join(tid[i], NULL);
+            UTEST_ASSERT(!ctx[i].failed);
+        }
+
+        // All objects should be returned back
+        UTEST_ASSERT(fl.size() == cap);
+        size_t **items = new size_t *[cap];
+        UTEST_ASSERT(fl.drain(items, cap) == cap);
+        for (size_t i=0; i<cap; ++i)
+            for (size_t j=i+1; j<cap; ++j)
+                UTEST_ASSERT(items[i] != items[j]);
+        delete [] items;
+    }
+
+    UTEST_MAIN
+    {
+        test_basic();
+        test_allocator();
+        test_concurrent();
+    }
+
+UTEST_END
+
+
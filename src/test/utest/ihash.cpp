@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/ihash.h>
+#include <lsp-plug.in/lltl/ilist.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+UTEST_BEGIN("lltl", ihash)
+
+    typedef struct voice_t
+    {
+        int                 note;       // Key stored by value
+        char               *name;       // Key stored by pointer
+        lltl::ihook         sByNote;
+        lltl::ihook         sByName;
+        lltl::ilink         sState;
+    } voice_t;
+
+    void test_basic()
+    {
+        voice_t v[4];
+        char names[4][16];
+        voice_t *ov;
+        lltl::ihash<int, voice_t> by_note(&voice_t::sByNote, &voice_t::note);
+        lltl::ihash<char, voice_t> by_name(&voice_t::sByName, &voice_t::name);
+        lltl::ilist<voice_t> active(&voice_t::sState);
+
+        printf("Testing basic functions...\n");
+
+        for (int i=0; i<4; ++i)
+        {
+            sprintf(names[i], "voice-%d", i);
+            v[i].note       = 60 + i;
+            v[i].name       = names[i];
+        }
+
+        int key = 60;
+        UTEST_ASSERT(by_note.is_empty());
+        UTEST_ASSERT(by_note.get(&key) == NULL);
+        UTEST_ASSERT(!by_note.remove(&v[0]));
+
+        // One object in several containers
+        for (int i=0; i<3; ++i)
+        {
+            UTEST_ASSERT(by_note.create(&v[i]));
+            UTEST_ASSERT(by_name.put(&v[i], &ov));
+            UTEST_ASSERT(ov == NULL);
+            UTEST_ASSERT(active.add(&v[i]));
+        }
+        UTEST_ASSERT(by_note.size() == 3);
+        UTEST_ASSERT(by_name.size() == 3);
+
+        for (int i=0; i<3; ++i)
+        {
+            key             = 60 + i;
+            UTEST_ASSERT(by_note.get(&key) == &v[i]);
+            UTEST_ASSERT(by_name.get(names[i]) == &v[i]);
+        }
+        UTEST_ASSERT(by_name.contains("voice-1"));
+        UTEST_ASSERT(!by_name.contains("voice-3"));
+        UTEST_ASSERT(by_name.get("voice-3", &v[3]) == &v[3]);
+
+        // Create fails for existing key, put replaces the object
+        v[3].note       = 61;
+        UTEST_ASSERT(!by_note.create(&v[3]));
+        UTEST_ASSERT(by_note.put(&v[3], &ov));
+        UTEST_ASSERT(ov == &v[1]);
+        key             = 61;
+        UTEST_ASSERT(by_note.get(&key) == &v[3]);
+        UTEST_ASSERT(by_note.size() == 3);
+        UTEST_ASSERT(!by_note.remove(&v[1]));
+        UTEST_ASSERT(by_note.put(&v[3], &ov));
+        UTEST_ASSERT(ov == NULL);
+
+        // Removal
+        UTEST_ASSERT(by_name.remove("voice-1", &ov));
+        UTEST_ASSERT(ov == &v[1]);
+        UTEST_ASSERT(!by_name.remove("voice-1"));
+        UTEST_ASSERT(by_name.remove(&v[0]));
+        UTEST_ASSERT(by_name.size() == 1);
+        UTEST_ASSERT(active.size() == 3);
+        UTEST_ASSERT(by_note.size() == 3);
+
+        // Iteration
+        size_t count = 0, mask = 0;
+        for (lltl::iterator<voice_t> it = by_note.values(); it; ++it, ++count)
+            mask           |= 1 << (it->note - 60);
+        UTEST_ASSERT(count == 3);
+        UTEST_ASSERT(mask == 0x7);
+
+        for (lltl::iterator<voice_t> it = by_note.values(); it; )
+        {
+            if (it->note == 61)
+            {
+                UTEST_ASSERT(it.remove());
+            }
+            else
+                ++it;
+        }
+        UTEST_ASSERT(by_note.size() == 2);
+        key             = 61;
+        UTEST_ASSERT(by_note.get(&key) == NULL);
+
+        // Swap
+        lltl::ihash<int, voice_t> other(&voice_t::sByNote, &voice_t::note);
+        by_note.swap(other);
+        UTEST_ASSERT(by_note.is_empty());
+        UTEST_ASSERT(other.size() == 2);
+        key             = 62;
+        UTEST_ASSERT(other.get(&key) == &v[2]);
+        UTEST_ASSERT(by_note.create(&v[1]));
+
+        by_note.clear();
+        by_name.flush();
+        active.clear();
+        UTEST_ASSERT(by_note.is_empty());
+        UTEST_ASSERT(by_name.is_empty());
+    }
+
+    void test_swap()
+    {
+        voice_t v[5];
+        lltl::ihash<int, voice_t> a(&voice_t::sByNote, &voice_t::note);
+        lltl::ihash<int, voice_t> b(&voice_t::sByNote, &voice_t::note);
+
+        printf("Testing swap...\n");
+
+        // Swap invalidates iterators of both maps regardless of modification counters
+        for (size_t i=0; i<5; ++i)
+        {
+            v[i].note       = int(i);
+            UTEST_ASSERT(((i < 3) ? a : b).create(&v[i]));
+        }
+        lltl::iterator<voice_t> ia = a.values();
+        lltl::iterator<voice_t> ib = b.values();
+        UTEST_ASSERT(ia.valid() && ib.valid());
+        a.swap(b);
+        UTEST_ASSERT(!ia.valid());
+        UTEST_ASSERT(!ib.valid());
+        UTEST_ASSERT(a.size() == 2);
+        UTEST_ASSERT(b.size() == 3);
+
+        a.clear();
+        b.clear();
+    }
+
+    void test_random()
+    {
+        static const size_t N = 4096;
+        voice_t *v = static_cast<voice_t *>(malloc(N * sizeof(voice_t)));
+        bool *linked = static_cast<bool *>(malloc(N * sizeof(bool)));
+        lltl::ihash<int, voice_t> hash(&voice_t::sByNote, &voice_t::note);
+        size_t n = 0;
+
+        printf("Testing random operations...\n");
+
+        UTEST_ASSERT(v != NULL);
+        UTEST_ASSERT(linked != NULL);
+        for (size_t i=0; i<N; ++i)
+        {
+            v[i].note       = int(i * 7919);
+            linked[i]       = false;
+        }
+
+        for (size_t iter=0; iter<100000; ++iter)
+        {
+            size_t idx      = rand() % N;
+            voice_t *x      = &v[idx];
+
+            switch (rand() % 3)
+            {
+                case 0:
+                    UTEST_ASSERT(hash.create(x) == !linked[idx]);
+                    if (!linked[idx])
+                        ++n;
+                    linked[idx]     = true;
+                    break;
+                case 1:
+                    UTEST_ASSERT(hash.remove(&x->note) == linked[idx]);
+                    if (linked[idx])
+                        --n;
+                    linked[idx]     = false;
+                    break;
+                default:
+                    UTEST_ASSERT(hash.get(&x->note) == ((linked[idx]) ? x : NULL));
+                    break;
+            }
+
+            UTEST_ASSERT(hash.size() == n);
+        }
+
+        size_t count = 0;
+        for (lltl::iterator<voice_t> it = hash.values(); it; ++it, ++count)
+            UTEST_ASSERT(linked[it.get() - v]);
+        UTEST_ASSERT(count == n);
+
+        hash.flush();
+        free(linked);
+        free(v);
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_basic();
+        test_swap();
+        test_random();
+    }
+
+UTEST_END
+
+
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/ilist.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdlib.h>
+#include <string.h>
+
+UTEST_BEGIN("lltl", ilist)
+
+    typedef struct voice_t
+    {
+        int                 id;
+        lltl::ilink         sState;     // Link in active or free list
+        lltl::ilink         sAll;       // Link in list of all voices
+    } voice_t;
+
+    void check_list(lltl::ilist<voice_t> &list, const int *ids, size_t n)
+    {
+        UTEST_ASSERT(list.size() == n);
+        UTEST_ASSERT(list.is_empty() == (n == 0));
+
+        // Forward traversal
+        size_t i = 0;
+        for (voice_t *v = list.first(); v != NULL; v = list.next(v), ++i)
+        {
+            UTEST_ASSERT(i < n);
+            UTEST_ASSERT_MSG(v->id == ids[i], "Item %d: expected %d, got %d", int(i), ids[i], v->id);
+        }
+        UTEST_ASSERT(i == n);
+
+        // Backward traversal
+        for (voice_t *v = list.last(); v != NULL; v = list.prev(v))
+        {
+            UTEST_ASSERT(i > 0);
+            UTEST_ASSERT(v->id == ids[--i]);
+        }
+        UTEST_ASSERT(i == 0);
+
+        // Iterator
+        for (lltl::iterator<voice_t> it = list.values(); it; ++it, ++i)
+        {
+            UTEST_ASSERT(i < n);
+            UTEST_ASSERT(it->id == ids[i]);
+        }
+        UTEST_ASSERT(i == n);
+    }
+
+    void test_basic()
+    {
+        voice_t v[8];
+        lltl::ilist<voice_t> active(&voice_t::sState), all(&voice_t::sAll);
+
+        printf("Testing basic functions...\n");
+
+        for (int i=0; i<8; ++i)
+            v[i].id     = i;
+
+        check_list(active, NULL, 0);
+        UTEST_ASSERT(active.first() == NULL);
+        UTEST_ASSERT(active.pop() == NULL);
+        UTEST_ASSERT(active.shift() == NULL);
+
+        // Insertion
+        UTEST_ASSERT(active.append(&v[1]));
+        UTEST_ASSERT(active.add(&v[2]));
+        UTEST_ASSERT(active.prepend(&v[0]));
+        UTEST_ASSERT(active.insert_after(&v[2], &v[4]));
+        UTEST_ASSERT(active.insert_before(&v[4], &v[3]));
+        UTEST_ASSERT(!active.append(&v[3]));
+        UTEST_ASSERT(active.linked(&v[3]));
+        UTEST_ASSERT(!active.linked(&v[5]));
+        {
+            static const int ids[] = { 0, 1, 2, 3, 4 };
+            check_list(active, ids, 5);
+        }
+
+        // The same objects in another list
+        for (int i=7; i>=0; --i)
+            UTEST_ASSERT(all.push(&v[i]));
+        {
+            static const int ids[] = { 7, 6, 5, 4, 3, 2, 1, 0 };
+            check_list(all, ids, 8);
+        }
+
+        // Reordering
+        UTEST_ASSERT(active.move_last(&v[1]));
+        UTEST_ASSERT(active.move_first(&v[3]));
+        UTEST_ASSERT(active.move_first(&v[3]));
+        UTEST_ASSERT(active.move_before(&v[2], &v[4]));
+        UTEST_ASSERT(!active.move_last(&v[5]));
+        {
+            static const int ids[] = { 3, 0, 4, 2, 1 };
+            check_list(active, ids, 5);
+        }
+
+        // Removal
+        UTEST_ASSERT(active.remove(&v[4]));
+        UTEST_ASSERT(!active.remove(&v[4]));
+        UTEST_ASSERT(!active.linked(&v[4]));
+        UTEST_ASSERT(active.shift() == &v[3]);
+        UTEST_ASSERT(active.pop() == &v[1]);
+        {
+            static const int ids[] = { 0, 2 };
+            check_list(active, ids, 2);
+        }
+        {
+            static const int ids[] = { 7, 6, 5, 4, 3, 2, 1, 0 };
+            check_list(all, ids, 8);
+        }
+
+        // Removal with iterator
+        for (lltl::iterator<voice_t> it = all.values(); it; )
+        {
+            if (it->id & 1)
+            {
+                UTEST_ASSERT(it.remove());
+            }
+            else
+                ++it;
+        }
+        {
+            static const int ids[] = { 6, 4, 2, 0 };
+            check_list(all, ids, 4);
+        }
+
+        // Swap
+        active.swap(all);
+        {
+            static const int ids[] = { 6, 4, 2, 0 };
+            check_list(active, ids, 4);
+        }
+        {
+            static const int ids[] = { 0, 2 };
+            check_list(all, ids, 2);
+        }
+        UTEST_ASSERT(active.first()->sAll.linked());
+
+        // Clear resets hooks
+        active.clear();
+        check_list(active, NULL, 0);
+        for (int i=0; i<8; ++i)
+            UTEST_ASSERT(!v[i].sAll.linked());
+        UTEST_ASSERT(active.append(&v[6]));
+        all.clear();
+        check_list(all, NULL, 0);
+        active.clear();
+    }
+
+    void test_random()
+    {
+        static const size_t N = 256;
+        voice_t *v = static_cast<voice_t *>(malloc(N * sizeof(voice_t)));
+        int *ids = static_cast<int *>(malloc(N * sizeof(int)));
+        size_t n = 0;
+        lltl::ilist<voice_t> list(&voice_t::sState);
+
+        printf("Testing random operations...\n");
+
+        UTEST_ASSERT(v != NULL);
+        UTEST_ASSERT(ids != NULL);
+        for (size_t i=0; i<N; ++i)
+        {
+            v[i].id     = int(i);
+            v[i].sState.init();
+        }
+
+        for (size_t iter=0; iter<20000; ++iter)
+        {
+            voice_t *x  = &v[rand() % N];
+            size_t pos  = 0;
+            while ((pos < n) && (ids[pos] != x->id))
+                ++pos;
+
+            if (pos >= n)
+            {
+                // Insert at the random position
+                size_t at   = rand() % (n + 1);
+                voice_t *p  = (at < n) ? &v[ids[at]] : NULL;
+                UTEST_ASSERT(list.insert_before(p, x));
+                memmove(&ids[at + 1], &ids[at], (n - at) * sizeof(int));
+                ids[at]     = x->id;
+                ++n;
+            }
+            else if (rand() & 1)
+            {
+                UTEST_ASSERT(list.remove(x));
+                memmove(&ids[pos], &ids[pos + 1], (n - pos - 1) * sizeof(int));
+                --n;
+            }
+            else
+            {
+                UTEST_ASSERT(list.move_last(x));
+                memmove(&ids[pos], &ids[pos + 1], (n - pos - 1) * sizeof(int));
+                ids[n-1]    = x->id;
+            }
+
+            if ((iter % 100) == 0)
+                check_list(list, ids, n);
+        }
+        check_list(list, ids, n);
+
+        list.clear();
+        free(ids);
+        free(v);
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_basic();
+        test_random();
+    }
+
+UTEST_END
+
+
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/lru.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+UTEST_BEGIN("lltl", lru)
+
+    typedef struct evicted_t
+    {
+        char        keys[64][16];
+        size_t      count;
+        size_t      cost;
+    } evicted_t;
+
+    static void on_evict(char *key, int *value, size_t cost, evicted_t *ev)
+    {
+        if (ev->count < 64)
+            strcpy(ev->keys[ev->count], key);
+        ++ev->count;
+        ev->cost       += cost;
+    }
+
+    static void init_evicted(evicted_t *ev)
+    {
+        ev->count       = 0;
+        ev->cost        = 0;
+    }
+
+    void test_basic()
+    {
+        lltl::lru<char, int> c;
+        int a = 1, b = 2, *ov;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(c.is_empty());
+        UTEST_ASSERT(c.get("a") == NULL);
+        UTEST_ASSERT(c.misses() == 1);
+
+        UTEST_ASSERT(c.put("a", &a, 10, &ov));
+        UTEST_ASSERT(ov == NULL);
+        UTEST_ASSERT(c.put("b", &b, 20));
+        UTEST_ASSERT(c.size() == 2);
+        UTEST_ASSERT(c.cost() == 30);
+        UTEST_ASSERT(!c.put("c", NULL, 1));
+
+        UTEST_ASSERT(c.get("a") == &a);
+        UTEST_ASSERT(c.peek("b") == &b);
+        UTEST_ASSERT(c.contains("b"));
+        UTEST_ASSERT(!c.contains("c"));
+        UTEST_ASSERT(c.get("c", &a) == &a);
+        UTEST_ASSERT(c.hits() == 1);
+        UTEST_ASSERT(c.misses() == 2);
+
+        // Replace
+        UTEST_ASSERT(c.put("a", &b, 5, &ov));
+        UTEST_ASSERT(ov == &a);
+        UTEST_ASSERT(c.get("a") == &b);
+        UTEST_ASSERT(c.cost() == 25);
+
+        // Remove
+        UTEST_ASSERT(c.remove("a", &ov));
+        UTEST_ASSERT(ov == &b);
+        UTEST_ASSERT(!c.remove("a"));
+        UTEST_ASSERT(c.size() == 1);
+        UTEST_ASSERT(c.cost() == 20);
+
+        c.reset_stats();
+        UTEST_ASSERT((c.hits() == 0) && (c.misses() == 0) && (c.evictions() == 0));
+        c.clear();
+        UTEST_ASSERT(c.is_empty());
+        UTEST_ASSERT(c.cost() == 0);
+    }
+
+    void test_lru()
+    {
+        lltl::lru<char, int> c(lltl::CACHE_LRU);
+        evicted_t ev;
+        int values[20];
+        char key[16];
+
+        printf("Testing LRU policy...\n");
+
+        init_evicted(&ev);
+        c.on_evict(on_evict, &ev);
+        c.set_budget(100);
+
+        for (int i=0; i<10; ++i)
+        {
+            sprintf(key, "k%d", i);
+            UTEST_ASSERT(c.put(key, &values[i], 10));
+        }
+        UTEST_ASSERT(c.cost() == 100);
+        UTEST_ASSERT(ev.count == 0);
+
+        // Access the oldest entry, the next one becomes the least recently used
+        UTEST_ASSERT(c.get("k0") == &values[0]);
+        UTEST_ASSERT(c.put("k10", &values[10], 10));
+        UTEST_ASSERT(ev.count == 1);
+        UTEST_ASSERT(strcmp(ev.keys[0], "k1") == 0);
+
+        // Expensive entry evicts several entries
+        UTEST_ASSERT(c.put("k11", &values[11], 35));
+        UTEST_ASSERT(ev.count == 5);
+        UTEST_ASSERT(strcmp(ev.keys[1], "k2") == 0);
+        UTEST_ASSERT(strcmp(ev.keys[4], "k5") == 0);
+        UTEST_ASSERT(c.cost() == 95);
+        UTEST_ASSERT(c.evictions() == 5);
+
+        // Entry which exceeds the budget is rejected
+        UTEST_ASSERT(!c.put("k12", &values[12], 101));
+        UTEST_ASSERT(ev.count == 5);
+
+        // Shrink the budget
+        c.set_budget(50);
+        UTEST_ASSERT(c.cost() <= 50);
+        UTEST_ASSERT(c.contains("k11"));
+        UTEST_ASSERT(c.contains("k10"));
+        UTEST_ASSERT(!c.contains("k0"));
+
+        c.set_budget(0);
+        UTEST_ASSERT(c.is_empty());
+        UTEST_ASSERT(ev.cost == 10 * 10 + 10 + 35);
+    }
+
+    void test_clock()
+    {
+        lltl::lru<char, int> c(lltl::CACHE_CLOCK);
+        evicted_t ev;
+        int values[4];
+
+        printf("Testing CLOCK policy...\n");
+
+        init_evicted(&ev);
+        c.on_evict(on_evict, &ev);
+        c.set_budget(3);
+
+        UTEST_ASSERT(c.put("a", &values[0], 1));
+        UTEST_ASSERT(c.put("b", &values[1], 1));
+        UTEST_ASSERT(c.put("c", &values[2], 1));
+        UTEST_ASSERT(c.get("a") != NULL);
+        UTEST_ASSERT(c.put("d", &values[3], 1));
+
+        UTEST_ASSERT(ev.count == 1);
+        UTEST_ASSERT(strcmp(ev.keys[0], "b") == 0);
+        UTEST_ASSERT(c.contains("a"));
+    }
+
+    size_t scan_workload(lltl::lru<char, int> &c)
+    {
+        static int value;
+        char key[16];
+
+        c.set_budget(100);
+
+        // Hot set of 50 keys accessed repeatedly, then single scan of 1000 keys
+        for (int pass=0; pass<4; ++pass)
+        {
+            for (int i=0; i<50; ++i)
+            {
+                sprintf(key, "hot%d", i);
+                if (c.get(key) == NULL)
+                    c.put(key, &value, 1);
+            }
+        }
+        for (int i=0; i<1000; ++i)
+        {
+            sprintf(key, "scan%d", i);
+            if (c.get(key) == NULL)
+                c.put(key, &value, 1);
+        }
+
+        // Count hot keys which survived the scan
+        size_t hot = 0;
+        for (int i=0; i<50; ++i)
+        {
+            sprintf(key, "hot%d", i);
+            if (c.contains(key))
+                ++hot;
+        }
+        return hot;
+    }
+
+    void test_s3fifo()
+    {
+        lltl::lru<char, int> c1(lltl::CACHE_LRU), c2(lltl::CACHE_S3FIFO);
+
+        printf("Testing S3-FIFO policy...\n");
+
+        size_t lru  = scan_workload(c1);
+        size_t s3   = scan_workload(c2);
+        printf("  hot keys after scan: LRU=%d, S3-FIFO=%d\n", int(lru), int(s3));
+        UTEST_ASSERT(lru == 0);
+        UTEST_ASSERT(s3 == 50);
+        UTEST_ASSERT(c2.cost() <= 100);
+    }
+
+    void test_random(lltl::cache_policy_t policy)
+    {
+        lltl::lru<char, int> c(policy);
+        evicted_t ev;
+        int values[1000];
+        char key[16];
+        size_t added = 0, removed = 0;
+
+        init_evicted(&ev);
+        c.on_evict(on_evict, &ev);
+        c.set_budget(5000);
+
+        for (size_t i=0; i<100000; ++i)
+        {
+            int k       = rand() % 1000;
+            sprintf(key, "%d", k);
+
+            switch (rand() % 4)
+            {
+                case 0:
+                {
+                    int *ov;
+                    if (c.remove(key, &ov))
+                    {
+                        UTEST_ASSERT(ov == &values[k]);
+                        ++removed;
+                    }
+                    break;
+                }
+                case 1:
+                {
+                    int *ov;
+                    UTEST_ASSERT(c.put(key, &values[k], 1 + rand() % 20, &ov));
+                    if (ov == NULL)
+                        ++added;
+                    else
+                        UTEST_ASSERT(ov == &values[k]);
+                    break;
+                }
+                default:
+                {
+                    int *v = c.get(key);
+                    UTEST_ASSERT((v == NULL) || (v == &values[k]));
+                    break;
+                }
+            }
+
+            UTEST_ASSERT(c.cost() <= 5000);
+            UTEST_ASSERT(c.size() == added - removed - ev.count);
+        }
+        UTEST_ASSERT(c.hits() + c.misses() > 0);
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_basic();
+        test_lru();
+        test_clock();
+        test_s3fifo();
+
+        printf("Testing random operations...\n");
+        test_random(lltl::CACHE_LRU);
+        test_random(lltl::CACHE_CLOCK);
+        test_random(lltl::CACHE_S3FIFO);
+    }
+
+UTEST_END
+
+
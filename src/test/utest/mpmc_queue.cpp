@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/mpmc_queue.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define STRESS_THREADS      4
+#define STRESS_ITEMS        200000
+
+UTEST_BEGIN("lltl", mpmc_queue)
+
+    typedef struct job_t
+    {
+        uint32_t    id;
+        uint32_t    check;
+        uint8_t     tag;
+    } job_t;
+
+    typedef struct context_t
+    {
+        lltl::mpmc_queue<job_t>    *queue;
+        size_t                      received;
+        uint64_t                    sum;
+        bool                        failed;
+    } context_t;
+
+    void test_single()
+    {
+        lltl::mpmc_queue<job_t> q;
+        job_t job;
+
+        printf("Testing single-threaded operations...\n");
+
+        // Not reserved queue
+        job.id      = 0;
+        job.check   = 0;
+        job.tag     = 0;
+        UTEST_ASSERT(q.capacity() == 0);
+        UTEST_ASSERT(!q.push(job));
+        UTEST_ASSERT(!q.pop(job));
+
+        // Fill the queue
+        UTEST_ASSERT(q.reserve(50));
+        UTEST_ASSERT(q.capacity() == 64);
+        for (uint32_t i=0; i<64; ++i)
+        {
+            job.id      = i;
+            job.check   = ~i;
+            job.tag     = i & 0xff;
+            UTEST_ASSERT(q.push(&job));
+        }
+        UTEST_ASSERT(!q.push(&job));
+        UTEST_ASSERT(q.size() == 64);
+
+        // Drain half and grow
+        for (uint32_t i=0; i<32; ++i)
+        {
+            UTEST_ASSERT(q.pop(&job));
+            UTEST_ASSERT((job.id == i) && (job.check == ~i) && (job.tag == (i & 0xff)));
+        }
+        UTEST_ASSERT(q.reserve(128));
+        UTEST_ASSERT(q.capacity() == 128);
+        UTEST_ASSERT(q.size() == 32);
+
+        // Fill and drain
+        for (uint32_t i=64; i<160; ++i)
+        {
+            job.id      = i;
+            job.check   = ~i;
+            job.tag     = i & 0xff;
+            UTEST_ASSERT(q.push(&job));
+        }
+        UTEST_ASSERT(!q.push(&job));
+        for (uint32_t i=32; i<160; ++i)
+        {
+            UTEST_ASSERT(q.pop(&job));
+            UTEST_ASSERT((job.id == i) && (job.check == ~i) && (job.tag == (i & 0xff)));
+        }
+        UTEST_ASSERT(!q.pop(&job));
+        UTEST_ASSERT(q.is_empty());
+    }
+
+    void test_pointers()
+    {
+        lltl::pmpmc_queue<int> q;
+        int v[100];
+
+        printf("Testing pointer queue...\n");
+        UTEST_ASSERT(q.pop() == NULL);
+        UTEST_ASSERT(q.reserve(100));
+        UTEST_ASSERT(!q.push(NULL));
+
+        for (size_t k=0; k<10; ++k)
+        {
+            for (int i=0; i<100; ++i)
+            {
+                v[i]    = i;
+                UTEST_ASSERT(q.push(&v[i]));
+            }
+            UTEST_ASSERT(q.size() == 100);
+            for (int i=0; i<100; ++i)
+                UTEST_ASSERT(q.pop() == &v[i]);
+            UTEST_ASSERT(q.pop() == NULL);
+        }
+    }
+
+    static void *producer_main(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        job_t job;
+
+        for (uint32_t i=0; i<STRESS_ITEMS; ++i)
+        {
+            job.id      = i;
+            job.check   = ~i;
+            job.tag     = 0;
+            while (!ctx->queue->push(&job))
+                sched_yield();
+        }
+
+        return NULL;
+    }
+
+    static void *consumer_main(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        job_t job;
+
+        while (ctx->received < STRESS_ITEMS)
+        {
+            if (!ctx->queue->pop(&job))
+            {
+                sched_yield();
+                continue;
+            }
+            if (job.check != ~job.id)
+                ctx->failed     = true;
+            ctx->sum       += job.id;
+            ++ctx->received;
+        }
+
+        return NULL;
+    }
+
+    void test_concurrent()
+    {
+        lltl::mpmc_queue<job_t> q;
+        pthread_t producers[STRESS_THREADS], consumers[STRESS_THREADS];
+        context_t ctx[STRESS_THREADS * 2];
+
+        printf("Testing %d producers and %d consumers...\n", int(STRESS_THREADS), int(STRESS_THREADS));
+        UTEST_ASSERT(q.reserve(1024));
+
+        for (size_t i=0; i<STRESS_THREADS*2; ++i)
+        {
+            ctx[i].queue    = &q;
+            ctx[i].received = 0;
+            ctx[i].sum      = 0;
+            ctx[i].failed   = false;
+        }
+        for (size_t i=0; i<STRESS_THREADS; ++i)
+        {
+            UTEST_ASSERT(pthread_create(&consumers[i], NULL, consumer_main, &ctx[i + STRESS_THREADS]) == 0);
+            UTEST_ASSERT(pthread_create(&producers[i], NULL, producer_main, &ctx[i]) == 0);
+        }
+        for (size_t i=0; i<STRESS_THREADS; ++i)
+        {
+            pthread_join(producers[i], NULL);
+            pthread_join(consumers[i], NULL);
+        }
+
+        uint64_t sum = 0;
+        for (size_t i=STRESS_THREADS; i<STRESS_THREADS*2; ++i)
+        {
+            UTEST_ASSERT(!ctx[i].failed);
+            sum    += ctx[i].sum;
+        }
+        UTEST_ASSERT(sum == uint64_t(STRESS_ITEMS - 1) * STRESS_ITEMS / 2 * STRESS_THREADS);
+        UTEST_ASSERT(q.is_empty());
+    }
+
+    UTEST_MAIN
+    {
+        test_single();
+        test_pointers();
+        test_concurrent();
+    }
+
+UTEST_END
+
+
@@ -779,6 +779,172 @@ UTEST_BEGIN("lltl", parray)
         printf("\n");
     }
 
+    void test_psort()
+    {
+        static const size_t N = 100000;
+
+        printf("Testing parallel sort...\n");
+
+        int *v = new int[N];
+        lltl::parray<int> a;
+
+        uint32_t seed = 1;
+        for (size_t i=0; i<N; ++i)
+        {
+            seed    = seed * 1103515245 + 12345;
+            v[i]    = int((seed >> 8) % (N / 4));
+        }
+
+        for (size_t threads=1; threads<=8; ++threads)
+        {
+            a.clear();
+            for (size_t i=0; i<N; ++i)
+                UTEST_ASSERT(a.add(&v[(i * 7919) % N]));
+
+            a.psort(test_int_cmp, threads, 1000);
+            UTEST_ASSERT(a.size() == N);
+            for (size_t i=1; i<N; ++i)
+                UTEST_ASSERT(*a.uget(i-1) <= *a.uget(i));
+
+            a.psort(test_int_cmp2, threads, 1000);
+            for (size_t i=1; i<N; ++i)
+                UTEST_ASSERT(*a.uget(i-1) >= *a.uget(i));
+
+            // Each pointer should be present exactly once
+            a.psort(lltl::ptr_cmp_func, threads, 1000);
+            for (size_t i=0; i<N; ++i)
+                UTEST_ASSERT(a.uget(i) == &v[i]);
+        }
+
+        delete [] v;
+    }
+
+    static bool is_greater(const int *item, int *threshold)
+    {
+        return (item != NULL) && (*item > *threshold);
+    }
+
+    void test_search()
+    {
+        printf("Testing search...\n");
+
+        int v[300], other = 0;
+        lltl::parray<int> a;
+
+        UTEST_ASSERT(a.index_of(&other) < 0);
+        UTEST_ASSERT(a.count(&other) == 0);
+        UTEST_ASSERT(a.find(&other) < 0);
+
+        for (size_t i=0; i<300; ++i)
+        {
+            v[i]    = i % 100;
+            UTEST_ASSERT(a.add(&v[i]));
+        }
+        UTEST_ASSERT(a.add(&v[7]));
+        UTEST_ASSERT(a.add(static_cast<int *>(NULL)));
+
+        // Search by pointer
+        for (size_t i=0; i<300; ++i)
+        {
+            UTEST_ASSERT(a.index_of(&v[i]) == ssize_t(i));
+            UTEST_ASSERT(a.contains(&v[i]));
+        }
+        UTEST_ASSERT(a.count(&v[7]) == 2);
+        UTEST_ASSERT(a.count(&v[8]) == 1);
+        UTEST_ASSERT(a.count(NULL) == 1);
+        UTEST_ASSERT(a.index_of(NULL) == 301);
+        UTEST_ASSERT(!a.contains(&other));
+
+        // Search by value
+        int x = 42;
+        UTEST_ASSERT(a.find(&x) == 42);
+        UTEST_ASSERT(a.find(&x, 43) == 142);
+        UTEST_ASSERT(a.find(&x, 243) < 0);
+        UTEST_ASSERT(a.find(static_cast<int *>(NULL)) == 301);
+        x = 100;
+        UTEST_ASSERT(a.find(&x) < 0);
+
+        // Search with predicate
+        int threshold = 98;
+        UTEST_ASSERT(a.find_if(is_greater, &threshold) == 99);
+        UTEST_ASSERT(a.find_if(is_greater, &threshold, 100) == 199);
+        threshold = 99;
+        UTEST_ASSERT(a.find_if(is_greater, &threshold) < 0);
+    }
+
+    void test_range()
+    {
+        printf("Testing contiguous range...\n");
+
+        int v[100];
+        lltl::parray<int> x;
+        const lltl::parray<int> &cx = x;
+
+        UTEST_ASSERT(x.begin() == x.end());
+        UTEST_ASSERT(cx.begin() == cx.end());
+
+        for (int i=0; i<100; ++i)
+        {
+            v[i]    = i;
+            UTEST_ASSERT(x.add(&v[i]));
+        }
+        UTEST_ASSERT(size_t(x.end() - x.begin()) == x.size());
+        UTEST_ASSERT(*x.begin() == x.first());
+        UTEST_ASSERT(*(x.end() - 1) == x.last());
+
+        for (int **p = x.begin(), **e = x.end(); p < e; ++p)
+            **p    *= 2;
+
+        int sum = 0;
+        for (int * const *p = cx.begin(), * const *e = cx.end(); p < e; ++p)
+            sum    += **p;
+        UTEST_ASSERT(sum == 99 * 100);
+    }
+
+    void test_iterator()
+    {
+        printf("Testing iterators...\n");
+
+        int v[100];
+        lltl::parray<int> x;
+        lltl::iterator<int> it = x.values();
+        UTEST_ASSERT(!it);
+
+        for (int i=0; i<100; ++i)
+        {
+            v[i]    = i;
+            UTEST_ASSERT(x.add(&v[i]));
+        }
+
+        // Simple traversal
+        int n = 0;
+        for (it = x.values(); it; ++it, ++n)
+        {
+            UTEST_ASSERT(it.get() == &v[n]);
+            UTEST_ASSERT(**it == n);
+        }
+        UTEST_ASSERT(n == 100);
+
+        // Remove odd elements while iterating
+        for (it = x.values(); it; )
+        {
+            if (**it & 1)
+                UTEST_ASSERT(it.remove())
+            else
+                ++it;
+        }
+        UTEST_ASSERT(x.size() == 50);
+        for (int i=0; i<50; ++i)
+            UTEST_ASSERT(x.uget(i) == &v[i*2]);
+
+        // Invalidation by modification
+        it = x.values();
+        UTEST_ASSERT(it);
+        x.clear();
+        UTEST_ASSERT(!it.valid());
+        UTEST_ASSERT(it.get() == NULL);
+    }
+
     UTEST_MAIN
     {
         test_single();
@@ -788,6 +954,10 @@ UTEST_BEGIN("lltl", parray)
         test_multiple_parray();
         test_xswap();
         test_sort();
+        test_psort();
+        test_search();
+        test_range();
+        test_iterator();
     }
 
 UTEST_END
@@ -21,6 +21,7 @@
 
 #include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/lltl/phashset.h>
+#include <lsp-plug.in/lltl/parallel.h>
 #include <lsp-plug.in/lltl/spec.h>
 #include <lsp-plug.in/test-fw/utest.h>
 #include <lsp-plug.in/stdlib/string.h>
@@ -173,10 +174,153 @@ UTEST_BEGIN("lltl", phashset)
         UTEST_ASSERT(rv.size() == 100000);
     }
 
+    void test_iterator()
+    {
+        item_t *xv[1000];
+        lltl::phashset<item_t> s;
+        lltl::iterator<item_t> it;
+
+        printf("Testing iterators...\n");
+        UTEST_ASSERT(!s.values());
+
+        for (size_t i=0; i<1000; ++i)
+        {
+            UTEST_ASSERT(xv[i] = new item_t(i));
+            UTEST_ASSERT(s.put(xv[i]));
+        }
+
+        // Traverse values
+        size_t n = 0;
+        for (it = s.values(); it; ++it, ++n)
+            UTEST_ASSERT(it.get() == xv[it->v]);
+        UTEST_ASSERT(n == 1000);
+
+        // Remove half of items while iterating
+        for (it = s.values(); it; )
+        {
+            if (it->v & 1)
+                UTEST_ASSERT(it.remove())
+            else
+                ++it;
+        }
+        UTEST_ASSERT(s.size() == 500);
+        for (size_t i=0; i<1000; ++i)
+            UTEST_ASSERT(s.contains(xv[i]) == !(i & 1));
+
+        // Invalidation by modification
+        it = s.values();
+        UTEST_ASSERT(it);
+        UTEST_ASSERT(s.remove(it.get()));
+        UTEST_ASSERT(!it.valid());
+        UTEST_ASSERT(it.get() == NULL);
+
+        for (size_t i=0; i<1000; ++i)
+            delete xv[i];
+    }
+
+    typedef struct scan_t
+    {
+        lltl::phashset<item_t>     *set;
+        size_t                      count[8];
+        ssize_t                     sum[8];
+    } scan_t;
+
+    static void scan_range(size_t thread, size_t first, size_t last, void *arg)
+    {
+        scan_t *s = static_cast<scan_t *>(arg);
+        for (lltl::iterator<item_t> it = s->set->values(first, last); it; ++it)
+        {
+            ++s->count[thread];
+            s->sum[thread] += it->v;
+        }
+    }
+
+    void test_ranges()
+    {
+        item_t *xv[1000];
+        lltl::phashset<item_t> set;
+        scan_t s;
+
+        printf("Testing parallel range traversal...\n");
+
+        for (size_t i=0; i<1000; ++i)
+        {
+            UTEST_ASSERT(xv[i] = new item_t(i));
+            UTEST_ASSERT(set.put(xv[i]));
+        }
+
+        for (size_t threads=1; threads<=8; ++threads)
+        {
+            s.set       = &set;
+            for (size_t i=0; i<8; ++i)
+            {
+                s.count[i]      = 0;
+                s.sum[i]        = 0;
+            }
+            UTEST_ASSERT(lltl::parallel_for(set.capacity(), threads, scan_range, &s) == threads);
+
+            size_t count = 0;
+            ssize_t sum = 0;
+            for (size_t i=0; i<8; ++i)
+            {
+                count      += s.count[i];
+                sum        += s.sum[i];
+            }
+            UTEST_ASSERT(count == 1000);
+            UTEST_ASSERT(sum == 999 * 1000 / 2);
+        }
+
+        for (size_t i=0; i<1000; ++i)
+            delete xv[i];
+    }
+
+    static bool sum_values(item_t *item, ssize_t *sum)
+    {
+        *sum       += item->v;
+        return true;
+    }
+
+    void test_export()
+    {
+        item_t *xv[1000], *fv[1000];
+        lltl::phashset<item_t> s;
+        lltl::parray<item_t> vv;
+
+        printf("Testing bulk export...\n");
+
+        for (size_t i=0; i<1000; ++i)
+        {
+            UTEST_ASSERT(xv[i] = new item_t(i));
+            UTEST_ASSERT(s.put(xv[i]));
+        }
+
+        // Sorted export
+        UTEST_ASSERT(s.sorted_values(&vv));
+        UTEST_ASSERT(vv.size() == 1000);
+        for (size_t i=1; i<1000; ++i)
+            UTEST_ASSERT(vv.uget(i-1) < vv.uget(i));
+
+        // Export to flat buffer
+        UTEST_ASSERT(s.copy_values(fv, 1000, true) == 1000);
+        for (size_t i=0; i<1000; ++i)
+            UTEST_ASSERT(fv[i] == vv.uget(i));
+
+        // Visitor
+        ssize_t sum = 0;
+        UTEST_ASSERT(s.visit(sum_values, &sum) == 1000);
+        UTEST_ASSERT(sum == 999 * 1000 / 2);
+
+        for (size_t i=0; i<1000; ++i)
+            delete xv[i];
+    }
+
     UTEST_MAIN
     {
         test_basic();
         test_large();
+        test_iterator();
+        test_ranges();
+        test_export();
     }
 
 UTEST_END
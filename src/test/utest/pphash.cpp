@@ -21,6 +21,7 @@
 
 #include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/lltl/pphash.h>
+#include <lsp-plug.in/lltl/parallel.h>
 #include <lsp-plug.in/test-fw/utest.h>
 #include <lsp-plug.in/stdlib/string.h>
 
@@ -193,10 +194,220 @@ UTEST_BEGIN("lltl", pphash)
         UTEST_ASSERT(h.capacity() == 0x20000);
     }
 
+    void test_iterator()
+    {
+        char buf[32];
+        lltl::pphash<char, char> h;
+        lltl::iterator<char> it;
+
+        printf("Testing iterators...\n");
+        UTEST_ASSERT(!h.keys());
+        UTEST_ASSERT(!h.values());
+
+        for (size_t i=0; i<1000; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "%08lx", long(i));
+            UTEST_ASSERT(h.put(buf, ::strdup(buf), NULL));
+        }
+
+        // Traverse keys and values
+        size_t n = 0;
+        lltl::iterator<char> vi = h.values();
+        for (it = h.keys(); it; ++it, ++vi, ++n)
+        {
+            UTEST_ASSERT(vi);
+            UTEST_ASSERT(::strcmp(it.get(), vi.get()) == 0);
+            UTEST_ASSERT(h.get(it.get()) == vi.get());
+        }
+        UTEST_ASSERT(!vi);
+        UTEST_ASSERT(n == 1000);
+
+        // Remove half of items while iterating
+        for (it = h.values(); it; )
+        {
+            char *v = it.get();
+            if (::strtol(v, NULL, 16) & 1)
+            {
+                UTEST_ASSERT(it.remove());
+                ::free(v);
+            }
+            else
+                ++it;
+        }
+        UTEST_ASSERT(h.size() == 500);
+        for (size_t i=0; i<1000; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "%08lx", long(i));
+            UTEST_ASSERT(h.exists(buf) == !(i & 1));
+        }
+
+        // Invalidation by modification
+        it = h.keys();
+        UTEST_ASSERT(it);
+        UTEST_ASSERT(h.put("new key", NULL, NULL));
+        UTEST_ASSERT(!it.valid());
+        UTEST_ASSERT(it.get() == NULL);
+
+        // Cleanup
+        for (it = h.values(); it; )
+        {
+            ::free(it.get());
+            UTEST_ASSERT(it.remove());
+        }
+        UTEST_ASSERT(h.size() == 0);
+    }
+
+    typedef struct scan_t
+    {
+        lltl::pphash<char, char>   *hash;
+        size_t                      bins;
+        size_t                      count[4];
+        size_t                      matched[4];
+    } scan_t;
+
+    static void scan_range(size_t thread, size_t first, size_t last, void *arg)
+    {
+        scan_t *s = static_cast<scan_t *>(arg);
+        first   = (first * s->bins) / 4;
+        last    = (last * s->bins) / 4;
+
+        for (lltl::iterator<char> it = s->hash->keys(first, last); it; ++it)
+        {
+            ++s->count[thread];
+            if (::strcmp(it.get(), s->hash->get(it.get())) == 0)
+                ++s->matched[thread];
+        }
+    }
+
+    void test_ranges()
+    {
+        char buf[32];
+        lltl::pphash<char, char> h;
+        scan_t s;
+
+        printf("Testing parallel range traversal...\n");
+        UTEST_ASSERT(!h.keys(0, 16));
+
+        for (size_t i=0; i<10000; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "%08lx", long(i));
+            UTEST_ASSERT(h.put(buf, ::strdup(buf), NULL));
+        }
+
+        // Empty and out-of-capacity ranges
+        UTEST_ASSERT(!h.values(10, 10));
+        UTEST_ASSERT(!h.values(h.capacity(), h.capacity() + 10));
+
+        // Split traversal
+        s.hash      = &h;
+        s.bins      = h.capacity();
+        for (size_t i=0; i<4; ++i)
+        {
+            s.count[i]      = 0;
+            s.matched[i]    = 0;
+        }
+        UTEST_ASSERT(lltl::parallel_for(4, 4, scan_range, &s) == 4);
+
+        size_t total = 0;
+        for (size_t i=0; i<4; ++i)
+        {
+            UTEST_ASSERT(s.count[i] == s.matched[i]);
+            total      += s.count[i];
+        }
+        UTEST_ASSERT(total == h.size());
+
+        // Cleanup
+        for (lltl::iterator<char> it = h.values(); it; )
+        {
+            ::free(it.get());
+            UTEST_ASSERT(it.remove());
+        }
+    }
+
+    static bool count_matches(char *key, char *value, size_t *count)
+    {
+        if (::strcmp(key, value) == 0)
+            ++(*count);
+        return *count < 100;
+    }
+
+    void test_export()
+    {
+        char buf[32];
+        lltl::pphash<char, char> h;
+        lltl::parray<char> vk, vv;
+        lltl::darray< lltl::pair<char, char> > vp;
+        lltl::pair<char, char> fp[0x400];
+        char *fk[0x400], *fv[0x400];
+
+        printf("Testing bulk export...\n");
+
+        // Export of empty hash
+        UTEST_ASSERT(h.keys(&vk));
+        UTEST_ASSERT(vk.size() == 0);
+        UTEST_ASSERT(h.sorted_items(&vp));
+        UTEST_ASSERT(vp.size() == 0);
+        UTEST_ASSERT(h.copy_keys(fk, 0x400) == 0);
+
+        for (size_t i=0; i<1000; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "%08lx", long((i * 7) % 1000));
+            UTEST_ASSERT(h.put(buf, ::strdup(buf), NULL));
+        }
+
+        // Export to arrays
+        UTEST_ASSERT(h.items(&vk, &vv));
+        UTEST_ASSERT(vk.size() == 1000);
+        UTEST_ASSERT(vv.size() == 1000);
+        for (size_t i=0; i<1000; ++i)
+            UTEST_ASSERT(::strcmp(vk.uget(i), vv.uget(i)) == 0);
+
+        // Sorted export
+        UTEST_ASSERT(h.sorted_keys(&vk));
+        UTEST_ASSERT(vk.size() == 1000);
+        for (size_t i=1; i<1000; ++i)
+            UTEST_ASSERT(::strcmp(vk.uget(i-1), vk.uget(i)) < 0);
+
+        UTEST_ASSERT(h.sorted_items(&vk, &vv));
+        UTEST_ASSERT(h.sorted_items(&vp));
+        UTEST_ASSERT(vp.size() == 1000);
+        for (size_t i=0; i<1000; ++i)
+        {
+            lltl::pair<char, char> *p = vp.uget(i);
+            ::snprintf(buf, sizeof(buf), "%08lx", long(i));
+            UTEST_ASSERT(::strcmp(p->key, buf) == 0);
+            UTEST_ASSERT(p->value == h.get(buf));
+            UTEST_ASSERT(vk.uget(i) == p->key);
+            UTEST_ASSERT(vv.uget(i) == p->value);
+        }
+
+        // Export to flat buffers
+        UTEST_ASSERT(h.copy_keys(fk, 10) == 10);
+        UTEST_ASSERT(h.copy_items(fk, fv, 0x400) == 1000);
+        for (size_t i=0; i<1000; ++i)
+            UTEST_ASSERT(h.get(fk[i]) == fv[i]);
+        UTEST_ASSERT(h.copy_values(fv, 0x400) == 1000);
+        UTEST_ASSERT(h.copy_items(fp, 0x400, true) == 1000);
+        for (size_t i=0; i<1000; ++i)
+            UTEST_ASSERT(fp[i].key == vp.uget(i)->key);
+
+        // Visitor
+        size_t count = 0;
+        UTEST_ASSERT(h.visit(count_matches, &count) == 100);
+        UTEST_ASSERT(count == 100);
+
+        // Cleanup
+        for (size_t i=0; i<vv.size(); ++i)
+            ::free(vv.uget(i));
+    }
+
     UTEST_MAIN
     {
         test_basic();
         test_large();
+        test_iterator();
+        test_ranges();
+        test_export();
     }
 
 UTEST_END
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/rcu.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define VERSIONS        2000
+#define READERS         3
+
+namespace
+{
+    static int versions[VERSIONS];
+}
+
+UTEST_BEGIN("lltl", rcu)
+
+    typedef struct context_t
+    {
+        lltl::rcu_pphash<char, int>    *hash;
+        size_t                          reader;
+        size_t                          reads;
+        bool                            failed;
+        bool                           *done;
+    } context_t;
+
+    static bool fill(lltl::pphash<char, int> *h, int *value)
+    {
+        return h->put("a", value, NULL) &&
+            h->put("b", value, NULL) &&
+            h->put("c", value, NULL);
+    }
+
+    void test_basic()
+    {
+        lltl::rcu_pphash<char, int> r;
+        lltl::pphash<char, int> h;
+        const lltl::pphash<char, int> *s1, *s2;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(r.reserve(2));
+        UTEST_ASSERT(r.readers() == 2);
+        UTEST_ASSERT(r.lock(0) == NULL);
+        r.unlock(0);
+
+        // Publish first version
+        UTEST_ASSERT(fill(&h, &versions[0]));
+        UTEST_ASSERT(r.publish(h));
+        UTEST_ASSERT(h.size() == 0);
+        UTEST_ASSERT(r.reclaim() == 0);
+
+        UTEST_ASSERT(s1 = r.lock(0));
+        UTEST_ASSERT(s1->size() == 3);
+        UTEST_ASSERT(s1->get("a") == &versions[0]);
+
+        // Publish second version while the first one is in use
+        UTEST_ASSERT(fill(&h, &versions[1]));
+        UTEST_ASSERT(r.publish(&h));
+        UTEST_ASSERT(r.current() != s1);
+        UTEST_ASSERT(s1->get("b") == &versions[0]);
+        UTEST_ASSERT(r.reclaim() == 1);
+
+        // Another reader observes the second version
+        UTEST_ASSERT(s2 = r.lock(1));
+        UTEST_ASSERT(s2->get("c") == &versions[1]);
+        r.unlock(1);
+        UTEST_ASSERT(r.reclaim() == 1);
+
+        // Release the first version
+        r.unlock(0);
+        UTEST_ASSERT(r.reclaim() == 0);
+
+        r.flush();
+        UTEST_ASSERT(r.current() == NULL);
+    }
+
+    static void *reader_main(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        int *last = NULL;
+
+        while (!__atomic_load_n(ctx->done, __ATOMIC_ACQUIRE))
+        {
+            const lltl::pphash<char, int> *s = ctx->hash->lock(ctx->reader);
+            if (s != NULL)
+            {
+                int *a = s->get("a");
+                int *b = s->get("b");
+                int *c = s->get("c");
+                if ((a != b) || (a != c) || (a < last))
+                    ctx->failed     = true;
+                last            = a;
+                ++ctx->reads;
+            }
+            ctx->hash->unlock(ctx->reader);
+        }
+
+        return NULL;
+    }
+
+    void test_concurrent()
+    {
+        lltl::rcu_pphash<char, int> r;
+        lltl::pphash<char, int> h;
+        context_t ctx[READERS];
+        pthread_t tid[READERS];
+        bool done = false;
+
+        printf("Testing concurrent readers...\n");
+        UTEST_ASSERT(r.reserve(READERS));
+
+        for (size_t i=0; i<READERS; ++i)
+        {
+            ctx[i].hash     = &r;
+            ctx[i].reader   = i;
+            ctx[i].reads    = 0;
+            ctx[i].failed   = false;
+            ctx[i].done     = &done;
+            UTEST_ASSERT(pthread_create(&tid[i], NULL, reader_main, &ctx[i]) == 0);
+        }
+
+        for (size_t i=0; i<VERSIONS; ++i)
+        {
+            UTEST_ASSERT(fill(&h, &versions[i]));
+            UTEST_ASSERT(r.publish(h));
+            if (!(i % 16))
+                sched_yield();
+        }
+
+        __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+        for (size_t i=0; i<READERS; ++i)
+        {
+            pthread_join(tid[i], NULL);
+            UTEST_ASSERT(!ctx[i].failed);
+        }
+
+        UTEST_ASSERT(r.reclaim() == 0);
+    }
+
+    UTEST_MAIN
+    {
+        test_basic();
+        test_concurrent();
+    }
+
+UTEST_END
+
+
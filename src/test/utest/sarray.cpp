@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/sarray.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdlib.h>
+#include <string.h>
+
+UTEST_BEGIN("lltl", sarray)
+
+    typedef struct small_t
+    {
+        uint32_t    value;
+    } small_t;
+
+    typedef struct big_t
+    {
+        size_t      value;
+        uint8_t     data[5000];
+    } big_t;
+
+    template <class T>
+        void test_stable(const char *name)
+        {
+            static const size_t N = 10000;
+            lltl::sarray<T> a;
+            T **ptr = static_cast<T **>(malloc(N * sizeof(T *)));
+            UTEST_ASSERT(ptr != NULL);
+
+            printf("Testing stable addresses for %s...\n", name);
+
+            UTEST_ASSERT(a.is_empty());
+            UTEST_ASSERT(a.get(0) == NULL);
+            UTEST_ASSERT(a.values().end());
+
+            // Addresses and indices of items never change
+            for (size_t i=0; i<N; ++i)
+            {
+                size_t idx;
+                T *x            = a.append(&idx);
+                UTEST_ASSERT(x != NULL);
+                UTEST_ASSERT(idx == i);
+                x->value        = i;
+                ptr[i]          = x;
+            }
+            UTEST_ASSERT(a.size() == N);
+            UTEST_ASSERT(a.capacity() >= N);
+            for (size_t i=0; i<N; ++i)
+            {
+                UTEST_ASSERT(a.get(i) == ptr[i]);
+                UTEST_ASSERT(a[i]->value == i);
+                UTEST_ASSERT(a.index_of(ptr[i]) == ssize_t(i));
+            }
+
+            // Invalid pointers
+            T tmp;
+            UTEST_ASSERT(a.index_of(&tmp) < 0);
+            UTEST_ASSERT(a.index_of(NULL) < 0);
+            UTEST_ASSERT(a.index_of(reinterpret_cast<T *>(reinterpret_cast<uint8_t *>(ptr[1]) + 1)) < 0);
+            UTEST_ASSERT(!a.premove(&tmp));
+
+            // Remove odd items
+            for (size_t i=1; i<N; i += 2)
+            {
+                UTEST_ASSERT(a.remove(i, &tmp) == &tmp);
+                UTEST_ASSERT(tmp.value == i);
+            }
+            UTEST_ASSERT(!a.remove(1));
+            UTEST_ASSERT(a.get(1) == NULL);
+            UTEST_ASSERT(a.index_of(ptr[1]) < 0);
+            UTEST_ASSERT(a.size() == N / 2);
+
+            // Iteration skips holes
+            size_t count = 0;
+            for (lltl::iterator<T> it = a.values(); it; ++it, ++count)
+                UTEST_ASSERT(it.get() == ptr[count * 2]);
+            UTEST_ASSERT(count == N / 2);
+
+            // Removed slots are reused, other items keep their addresses
+            for (size_t i=1; i<N; i += 2)
+            {
+                size_t idx;
+                T *x            = a.append(&idx);
+                UTEST_ASSERT((idx & 1) && (idx < N));
+                UTEST_ASSERT(x == ptr[idx]);
+            }
+            UTEST_ASSERT(a.size() == N);
+            for (size_t i=0; i<N; i += 2)
+                UTEST_ASSERT(a.get(i) == ptr[i]);
+
+            // Remove with iterator
+            for (lltl::iterator<T> it = a.values(); it; )
+            {
+                if (a.index_of(it.get()) % 3)
+                {
+                    UTEST_ASSERT(it.remove());
+                }
+                else
+                    ++it;
+            }
+            UTEST_ASSERT(a.size() == (N + 2) / 3);
+            UTEST_ASSERT(a.premove(ptr[0]));
+            UTEST_ASSERT(a.get(3) == ptr[3]);
+
+            // Clear and swap
+            lltl::sarray<T> b;
+            a.swap(b);
+            UTEST_ASSERT(a.is_empty());
+            UTEST_ASSERT(b.get(3) == ptr[3]);
+            b.clear();
+            UTEST_ASSERT(b.is_empty());
+            UTEST_ASSERT(b.append() == ptr[0]);
+            b.flush();
+            UTEST_ASSERT(b.capacity() == 0);
+
+            free(ptr);
+        }
+
+    void test_swap()
+    {
+        lltl::sarray<small_t> a, b;
+
+        printf("Testing swap...\n");
+
+        // Swap invalidates iterators of both arrays regardless of modification counters
+        for (size_t i=0; i<3; ++i)
+        {
+            UTEST_ASSERT(a.append() != NULL);
+            if (i < 2)
+            {
+                UTEST_ASSERT(b.append() != NULL);
+            }
+        }
+        lltl::iterator<small_t> ia = a.values();
+        lltl::iterator<small_t> ib = b.values();
+        UTEST_ASSERT(ia.valid() && ib.valid());
+        a.swap(b);
+        UTEST_ASSERT(!ia.valid());
+        UTEST_ASSERT(!ib.valid());
+        UTEST_ASSERT(a.size() == 2);
+        UTEST_ASSERT(b.size() == 3);
+    }
+
+    void test_random()
+    {
+        static const size_t N = 2000;
+        lltl::sarray<small_t> a;
+        small_t **ptr = static_cast<small_t **>(malloc(N * sizeof(small_t *)));
+        UTEST_ASSERT(ptr != NULL);
+
+        printf("Testing random operations...\n");
+
+        for (size_t i=0; i<N; ++i)
+            ptr[i]          = NULL;
+
+        size_t n = 0;
+        for (size_t iter=0; iter<100000; ++iter)
+        {
+            if ((rand() % 3) != 0)
+            {
+                size_t idx;
+                small_t x;
+                x.value         = rand();
+                small_t *p      = a.append(&x, &idx);
+                if (idx >= N)
+                {
+                    UTEST_ASSERT(a.remove(idx));
+                    continue;
+                }
+                UTEST_ASSERT(p != NULL);
+                UTEST_ASSERT(ptr[idx] == NULL);
+                ptr[idx]        = p;
+                ++n;
+            }
+            else
+            {
+                size_t idx      = rand() % N;
+                UTEST_ASSERT(a.premove(ptr[idx]) == (ptr[idx] != NULL));
+                if (ptr[idx] != NULL)
+                    --n;
+                ptr[idx]        = NULL;
+            }
+            UTEST_ASSERT(a.size() == n);
+        }
+
+        size_t count = 0;
+        for (lltl::iterator<small_t> it = a.values(); it; ++it, ++count)
+        {
+            ssize_t idx     = a.index_of(it.get());
+            UTEST_ASSERT((idx >= 0) && (ptr[idx] == it.get()));
+        }
+        UTEST_ASSERT(count == n);
+
+        free(ptr);
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_stable<small_t>("small_t");
+        test_stable<big_t>("big_t");
+        test_swap();
+        test_random();
+    }
+
+UTEST_END
+
+
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/search.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define MAX_LENGTH      150
+
+UTEST_BEGIN("lltl", search)
+
+    template <class T>
+        ssize_t naive_find(const T *v, size_t n, T value)
+        {
+            for (size_t i=0; i<n; ++i)
+                if (v[i] == value)
+                    return i;
+            return -1;
+        }
+
+    template <class T>
+        size_t naive_count(const T *v, size_t n, T value)
+        {
+            size_t count = 0;
+            for (size_t i=0; i<n; ++i)
+                if (v[i] == value)
+                    ++count;
+            return count;
+        }
+
+    void test_u32()
+    {
+        uint32_t v[MAX_LENGTH + 1] = { 0 };
+
+        printf("Testing 32-bit search...\n");
+
+        for (size_t n=0; n<=MAX_LENGTH; ++n)
+        {
+            for (size_t i=0; i<n; ++i)
+                v[i]    = uint32_t(i * 0x10001);
+
+            // Search for each value placed at each position, search from unaligned address
+            for (size_t i=0; i<n; ++i)
+            {
+                UTEST_ASSERT(lltl::find_u32(v, n, v[i]) == ssize_t(i));
+                UTEST_ASSERT(lltl::count_u32(v, n, v[i]) == 1);
+                if (n > 0)
+                    UTEST_ASSERT(lltl::find_u32(&v[1], n - 1, v[i]) == naive_find(&v[1], n - 1, v[i]));
+            }
+            UTEST_ASSERT(lltl::find_u32(v, n, 0xffffffff) < 0);
+            UTEST_ASSERT(lltl::count_u32(v, n, 0xffffffff) == 0);
+
+            // Duplicates and values that match only partially
+            for (size_t i=0; i<n; ++i)
+                v[i]    = (i % 3 == 0) ? 0x12345678 : (i % 3 == 1) ? 0x12340000 : 0x00005678;
+            UTEST_ASSERT(lltl::find_u32(v, n, 0x12345678) == naive_find<uint32_t>(v, n, 0x12345678));
+            UTEST_ASSERT(lltl::find_u32(v, n, 0x00005678) == naive_find<uint32_t>(v, n, 0x00005678));
+            UTEST_ASSERT(lltl::count_u32(v, n, 0x12345678) == naive_count<uint32_t>(v, n, 0x12345678));
+            UTEST_ASSERT(lltl::count_u32(v, n, 0x12340000) == naive_count<uint32_t>(v, n, 0x12340000));
+        }
+    }
+
+    void test_u64()
+    {
+        uint64_t v[MAX_LENGTH + 1] = { 0 };
+
+        printf("Testing 64-bit search...\n");
+
+        for (size_t n=0; n<=MAX_LENGTH; ++n)
+        {
+            for (size_t i=0; i<n; ++i)
+                v[i]    = (uint64_t(i) << 32) | (i * 3);
+
+            for (size_t i=0; i<n; ++i)
+            {
+                UTEST_ASSERT(lltl::find_u64(v, n, v[i]) == ssize_t(i));
+                UTEST_ASSERT(lltl::count_u64(v, n, v[i]) == 1);
+            }
+            UTEST_ASSERT(lltl::find_u64(v, n, uint64_t(-1)) < 0);
+
+            // Values which match only with one 32-bit half
+            for (size_t i=0; i<n; ++i)
+                v[i]    = (i % 3 == 0) ? 0x1122334455667788ULL : (i % 3 == 1) ? 0x1122334400000000ULL : 0x0000000055667788ULL;
+            UTEST_ASSERT(lltl::find_u64(v, n, 0x0000000055667788ULL) == naive_find<uint64_t>(v, n, 0x0000000055667788ULL));
+            UTEST_ASSERT(lltl::find_u64(v, n, 0x1122334455667788ULL) == naive_find<uint64_t>(v, n, 0x1122334455667788ULL));
+            UTEST_ASSERT(lltl::find_u64(v, n, 0x1122334400000000ULL) == naive_find<uint64_t>(v, n, 0x1122334400000000ULL));
+            UTEST_ASSERT(lltl::count_u64(v, n, 0x1122334455667788ULL) == naive_count<uint64_t>(v, n, 0x1122334455667788ULL));
+            UTEST_ASSERT(lltl::count_u64(v, n, 0x0000000055667788ULL) == naive_count<uint64_t>(v, n, 0x0000000055667788ULL));
+            UTEST_ASSERT(lltl::count_u64(v, n, 0x0000000000000000ULL) == 0);
+        }
+    }
+
+    void test_ptr()
+    {
+        int x[MAX_LENGTH];
+        void *v[MAX_LENGTH];
+
+        printf("Testing pointer search...\n");
+
+        for (size_t i=0; i<MAX_LENGTH; ++i)
+            v[i]    = &x[i];
+        for (size_t i=0; i<MAX_LENGTH; ++i)
+            UTEST_ASSERT(lltl::find_ptr(v, MAX_LENGTH, &x[i]) == ssize_t(i));
+        UTEST_ASSERT(lltl::find_ptr(v, MAX_LENGTH, NULL) < 0);
+        UTEST_ASSERT(lltl::count_ptr(v, MAX_LENGTH, &x[3]) == 1);
+    }
+
+    UTEST_MAIN
+    {
+        test_u32();
+        test_u64();
+        test_ptr();
+    }
+
+UTEST_END
+
+
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/shashmap.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/stdlib/string.h>
+#include <pthread.h>
+
+#define THREADS         8
+#define THREAD_KEYS     5000
+
+UTEST_BEGIN("lltl", shashmap)
+
+    typedef struct context_t
+    {
+        lltl::shashmap<char, int>  *map;
+        int                        *values;
+        size_t                      id;
+        bool                        failed;
+    } context_t;
+
+    static bool count_item(const char *key, int *value, size_t *count)
+    {
+        ++(*count);
+        return *count < 10;
+    }
+
+    void test_basic()
+    {
+        lltl::shashmap<char, int> m;
+        lltl::parray<int> vv;
+        int v[4], *ov;
+        char buf[32];
+
+        printf("Testing basic functions...\n");
+
+        // Not initialized map
+        UTEST_ASSERT(m.shards() == 0);
+        UTEST_ASSERT(!m.put("key", &v[0]));
+        UTEST_ASSERT(m.get("key") == NULL);
+        UTEST_ASSERT(m.size() == 0);
+
+        UTEST_ASSERT(m.init(5));
+        UTEST_ASSERT(m.shards() == 8);
+
+        // Put and get
+        UTEST_ASSERT(m.put("key1", &v[0]));
+        UTEST_ASSERT(m.put("key2", &v[1]));
+        UTEST_ASSERT(m.put(NULL, &v[2]));
+        UTEST_ASSERT(m.size() == 3);
+        UTEST_ASSERT(m.get("key1") == &v[0]);
+        UTEST_ASSERT(m.get("key2") == &v[1]);
+        UTEST_ASSERT(m.get(NULL) == &v[2]);
+        UTEST_ASSERT(m.get("key3", &v[3]) == &v[3]);
+        UTEST_ASSERT(m.exists("key1"));
+        UTEST_ASSERT(!m.exists("key3"));
+
+        // Modifications
+        UTEST_ASSERT(m.put("key1", &v[3], &ov));
+        UTEST_ASSERT(ov == &v[0]);
+        UTEST_ASSERT(!m.create("key1", &v[0]));
+        UTEST_ASSERT(m.create("key3", &v[0]));
+        UTEST_ASSERT(!m.replace("key4", &v[0]));
+        UTEST_ASSERT(m.replace("key3", &v[1], &ov));
+        UTEST_ASSERT(ov == &v[0]);
+        UTEST_ASSERT(m.remove("key2", &ov));
+        UTEST_ASSERT(ov == &v[1]);
+        UTEST_ASSERT(!m.remove("key2"));
+        UTEST_ASSERT(m.size() == 3);
+
+        // Snapshot of values and visitor
+        for (size_t i=0; i<100; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "item%d", int(i));
+            UTEST_ASSERT(m.put(buf, &v[i & 3]));
+        }
+        UTEST_ASSERT(m.values(&vv));
+        UTEST_ASSERT(vv.size() == 103);
+
+        size_t count = 0;
+        UTEST_ASSERT(m.visit(count_item, &count) == 10);
+        UTEST_ASSERT(count == 10);
+
+        m.clear();
+        UTEST_ASSERT(m.size() == 0);
+        UTEST_ASSERT(m.get("key1") == NULL);
+    }
+
+    static void *worker_main(void *arg)
+    {
+        context_t *ctx = static_cast<context_t *>(arg);
+        char buf[32];
+
+        // Insert own keys and check that they are readable
+        for (size_t i=0; i<THREAD_KEYS; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "%d-%d", int(ctx->id), int(i));
+            if (!ctx->map->put(buf, &ctx->values[i]))
+                ctx->failed = true;
+            if (ctx->map->get(buf) != &ctx->values[i])
+                ctx->failed = true;
+        }
+
+        // Remove odd keys
+        for (size_t i=1; i<THREAD_KEYS; i += 2)
+        {
+            ::snprintf(buf, sizeof(buf), "%d-%d", int(ctx->id), int(i));
+            if (!ctx->map->remove(buf))
+                ctx->failed = true;
+        }
+
+        return NULL;
+    }
+
+    void test_concurrent()
+    {
+        lltl::shashmap<char, int> m;
+        context_t ctx[THREADS];
+        pthread_t tid[THREADS];
+        int *values = new int[THREAD_KEYS];
+        char buf[32];
+
+        printf("Testing concurrent access...\n");
+        UTEST_ASSERT(m.init());
+
+        for (size_t i=0; i<THREADS; ++i)
+        {
+            ctx[i].map      = &m;
+            ctx[i].values   = values;
+            ctx[i].id       = i;
+            ctx[i].failed   = false;
+            UTEST_ASSERT(pthread_create(&tid[i], NULL, worker_main, &ctx[i]) == 0);
+        }
+        for (size_t i=0; i<THREADS; ++i)
+        {
+            pthread_join(tid[i], NULL);
+            UTEST_ASSERT(!ctx[i].failed);
+        }
+
+        UTEST_ASSERT(m.size() == THREADS * THREAD_KEYS / 2);
+        for (size_t i=0; i<THREADS; ++i)
+            for (size_t j=0; j<THREAD_KEYS; ++j)
+            {
+                ::snprintf(buf, sizeof(buf), "%d-%d", int(i), int(j));
+                UTEST_ASSERT(m.get(buf) == ((j & 1) ? NULL : &values[j]));
+            }
+
+        delete [] values;
+    }
+
+    UTEST_MAIN
+    {
+        test_basic();
+        test_concurrent();
+    }
+
+UTEST_END
+
+
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/slotmap.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdlib.h>
+
+UTEST_BEGIN("lltl", slotmap)
+
+    typedef struct node_t
+    {
+        int                 id;
+        lltl::slot_handle_t link;       // Reference to another node
+    } node_t;
+
+    void test_basic()
+    {
+        lltl::slotmap<node_t> m;
+        lltl::slot_handle_t h[4];
+        node_t n, *p;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(m.is_empty());
+        UTEST_ASSERT(m.get(0) == NULL);
+        UTEST_ASSERT(!m.contains(0));
+        UTEST_ASSERT(m.handle_of(0) == 0);
+
+        for (int i=0; i<4; ++i)
+        {
+            n.id            = i;
+            n.link          = (i > 0) ? h[i-1] : 0;
+            UTEST_ASSERT((p = m.add(&n, &h[i])) != NULL);
+            UTEST_ASSERT(p->id == i);
+            UTEST_ASSERT(h[i] != 0);
+        }
+        UTEST_ASSERT(m.size() == 4);
+
+        for (int i=0; i<4; ++i)
+        {
+            UTEST_ASSERT(m.get(h[i])->id == i);
+            UTEST_ASSERT(m[h[i]] == m.uget(i));
+            UTEST_ASSERT(m.index_of(h[i]) == i);
+            UTEST_ASSERT(m.handle_of(i) == h[i]);
+        }
+        UTEST_ASSERT(m.get(m.get(h[3])->link)->id == 2);
+
+        // Remove from the middle, the last item takes its place
+        UTEST_ASSERT(m.remove(h[1], &n) == &n);
+        UTEST_ASSERT(n.id == 1);
+        UTEST_ASSERT(!m.remove(h[1]));
+        UTEST_ASSERT(m.get(h[1]) == NULL);
+        UTEST_ASSERT(m.get(m.get(h[2])->link) == NULL);
+        UTEST_ASSERT(m.size() == 3);
+        UTEST_ASSERT(m.array()[1].id == 3);
+        UTEST_ASSERT(m.index_of(h[3]) == 1);
+        UTEST_ASSERT(m.handle_of(1) == h[3]);
+        UTEST_ASSERT(m.get(h[3])->id == 3);
+
+        // Slot is reused with new generation
+        lltl::slot_handle_t nh;
+        UTEST_ASSERT((p = m.append(&nh)) != NULL);
+        p->id           = 10;
+        UTEST_ASSERT(nh != h[1]);
+        UTEST_ASSERT(uint32_t(nh) == uint32_t(h[1]));
+        UTEST_ASSERT(m.get(h[1]) == NULL);
+        UTEST_ASSERT(m.get(nh)->id == 10);
+
+        // Forged handles
+        UTEST_ASSERT(m.get(nh + 1) == NULL);
+        UTEST_ASSERT(m.get(nh + (lltl::slot_handle_t(1) << 32)) == NULL);
+
+        // Iteration and removal with iterator
+        size_t sum = 0, count = 0;
+        for (lltl::iterator<node_t> it = m.values(); it; ++it, ++count)
+            sum            += it->id;
+        UTEST_ASSERT(count == 4);
+        UTEST_ASSERT(sum == 0 + 2 + 3 + 10);
+
+        for (lltl::iterator<node_t> it = m.values(); it; )
+        {
+            if (it->id & 1)
+            {
+                UTEST_ASSERT(it.remove());
+            }
+            else
+                ++it;
+        }
+        UTEST_ASSERT(m.size() == 3);
+        UTEST_ASSERT(m.get(h[3]) == NULL);
+        UTEST_ASSERT(m.get(h[2])->id == 2);
+
+        // Swap and clear
+        lltl::slotmap<node_t> m2;
+        m.swap(m2);
+        UTEST_ASSERT(m.is_empty());
+        UTEST_ASSERT(m2.get(h[2])->id == 2);
+        m2.clear();
+        UTEST_ASSERT(m2.is_empty());
+        UTEST_ASSERT(m2.get(h[0]) == NULL);
+        UTEST_ASSERT(m2.get(h[2]) == NULL);
+        UTEST_ASSERT(m2.get(nh) == NULL);
+    }
+
+    void test_random()
+    {
+        static const size_t N = 1000;
+        lltl::slotmap<node_t> m;
+        lltl::slot_handle_t *live = static_cast<lltl::slot_handle_t *>(malloc(N * sizeof(lltl::slot_handle_t)));
+        lltl::slot_handle_t *dead = static_cast<lltl::slot_handle_t *>(malloc(N * sizeof(lltl::slot_handle_t)));
+        size_t nlive = 0, ndead = 0;
+        int id = 0;
+
+        printf("Testing random operations...\n");
+        UTEST_ASSERT(live != NULL);
+        UTEST_ASSERT(dead != NULL);
+        UTEST_ASSERT(m.reserve(N));
+
+        for (size_t iter=0; iter<100000; ++iter)
+        {
+            if ((nlive < N) && ((nlive == 0) || (rand() & 1)))
+            {
+                node_t n;
+                n.id            = id++;
+                n.link          = 0;
+                UTEST_ASSERT(m.add(&n, &live[nlive]) != NULL);
+                ++nlive;
+            }
+            else
+            {
+                size_t k        = rand() % nlive;
+                lltl::slot_handle_t h = live[k];
+                UTEST_ASSERT(m.remove(h));
+                live[k]         = live[--nlive];
+                dead[(ndead++) % N] = h;
+            }
+
+            UTEST_ASSERT(m.size() == nlive);
+        }
+
+        // All live handles resolve, all dead handles are stale
+        for (size_t i=0; i<nlive; ++i)
+        {
+            ssize_t idx     = m.index_of(live[i]);
+            UTEST_ASSERT((idx >= 0) && (m.handle_of(idx) == live[i]));
+        }
+        for (size_t i=0, n=(ndead < N) ? ndead : N; i<n; ++i)
+            UTEST_ASSERT(m.get(dead[i]) == NULL);
+
+        free(live);
+        free(dead);
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_basic();
+        test_random();
+    }
+
+UTEST_END
+
+
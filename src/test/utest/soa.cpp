@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/soa.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdlib.h>
+
+UTEST_BEGIN("lltl", soa)
+
+    typedef lltl::soa3<float, double, int> voices_t;
+    typedef lltl::soa2<uint8_t, float> small_t;
+
+    static ssize_t cmp_float(const float *a, const float *b)
+    {
+        return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
+    }
+
+    static ssize_t cmp_int(const int *a, const int *b)
+    {
+        return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
+    }
+
+    static inline bool aligned(const void *ptr, size_t align)
+    {
+        return (reinterpret_cast<uintptr_t>(ptr) & (align - 1)) == 0;
+    }
+
+    // Fields of each item should stay consistent with each other
+    void check_sync(voices_t &v)
+    {
+        const float *gain   = v.f0();
+        const double *phase = v.f1();
+        const int *id       = v.f2();
+        for (size_t i=0, n=v.size(); i<n; ++i)
+        {
+            UTEST_ASSERT_MSG(gain[i] == id[i] * 0.5f, "Item %d: gain=%f, id=%d", int(i), gain[i], id[i]);
+            UTEST_ASSERT(phase[i] == id[i] * 2.0);
+        }
+    }
+
+    void test_basic()
+    {
+        voices_t v;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(v.is_empty());
+        UTEST_ASSERT(v.alignment() == 64);
+        UTEST_ASSERT(!v.pop());
+        UTEST_ASSERT(!v.remove(0));
+        UTEST_ASSERT(!v.qremove(0));
+
+        for (int i=0; i<1000; ++i)
+        {
+            UTEST_ASSERT(v.append(i * 0.5f, i * 2.0, i) == i);
+            UTEST_ASSERT(aligned(v.f0(), 64));
+            UTEST_ASSERT(aligned(v.f1(), 64));
+            UTEST_ASSERT(aligned(v.f2(), 64));
+        }
+        UTEST_ASSERT(v.size() == 1000);
+        UTEST_ASSERT(v.capacity() >= 1000);
+        check_sync(v);
+
+        // Removal
+        UTEST_ASSERT(v.remove(0));
+        UTEST_ASSERT(v.f2()[0] == 1);
+        UTEST_ASSERT(v.remove_n(10, 90));
+        UTEST_ASSERT(v.f2()[10] == 101);
+        UTEST_ASSERT(!v.remove_n(900, 10));
+        UTEST_ASSERT(v.qremove(0));
+        UTEST_ASSERT(v.f2()[0] == 999);
+        UTEST_ASSERT(v.pop());
+        UTEST_ASSERT(v.size() == 907);
+        check_sync(v);
+
+        // Swap of items and sort
+        UTEST_ASSERT(v.xswap(1, 5));
+        UTEST_ASSERT(v.f2()[1] == 6);
+        UTEST_ASSERT(v.f2()[5] == 2);
+        UTEST_ASSERT(!v.xswap(1, 1000));
+        check_sync(v);
+
+        UTEST_ASSERT(v.sort2(cmp_int));
+        for (size_t i=1; i<v.size(); ++i)
+            UTEST_ASSERT(v.f2()[i-1] < v.f2()[i]);
+        check_sync(v);
+
+        // Append uninitialized items
+        ssize_t idx = v.append_n(3);
+        UTEST_ASSERT(idx == 907);
+        for (size_t i=0; i<3; ++i)
+        {
+            v.f0()[idx + i] = -0.5f * (i + 1);
+            v.f1()[idx + i] = -2.0 * (i + 1);
+            v.f2()[idx + i] = -int(i + 1);
+        }
+        UTEST_ASSERT(v.sort0(cmp_float));
+        UTEST_ASSERT(v.f2()[0] == -3);
+        UTEST_ASSERT(v.f2()[v.size() - 1] == 999);
+        check_sync(v);
+
+        // Truncate and swap
+        UTEST_ASSERT(v.truncate(100));
+        UTEST_ASSERT(v.size() == 100);
+        UTEST_ASSERT(v.capacity() == 100);
+        UTEST_ASSERT(aligned(v.f1(), 64));
+        check_sync(v);
+
+        voices_t v2;
+        v.swap(v2);
+        UTEST_ASSERT(v.is_empty());
+        UTEST_ASSERT(v2.size() == 100);
+        check_sync(v2);
+
+        v2.clear();
+        UTEST_ASSERT(v2.is_empty());
+        v2.flush();
+        UTEST_ASSERT(v2.capacity() == 0);
+    }
+
+    void test_alignment()
+    {
+        static const size_t align[] = { 0, 16, 32, 48, 64, 4096 };
+        static const size_t expect[] = { 16, 16, 32, 64, 64, 4096 };
+
+        printf("Testing alignment...\n");
+
+        for (size_t i=0; i<sizeof(align)/sizeof(align[0]); ++i)
+        {
+            small_t v(align[i]);
+            UTEST_ASSERT(v.alignment() == expect[i]);
+
+            for (size_t j=0; j<100; ++j)
+            {
+                UTEST_ASSERT(v.add(uint8_t(j), j * 0.25f) >= 0);
+                UTEST_ASSERT(aligned(v.f0(), expect[i]));
+                UTEST_ASSERT(aligned(v.f1(), expect[i]));
+            }
+
+            for (size_t j=0; j<100; ++j)
+            {
+                UTEST_ASSERT(v.f0()[j] == j);
+                UTEST_ASSERT(v.f1()[j] == j * 0.25f);
+            }
+        }
+
+        lltl::soa4<float, float, float, float> v4(32);
+        UTEST_ASSERT(v4.reserve(1000));
+        UTEST_ASSERT(v4.append(1.0f, 2.0f, 3.0f, 4.0f) == 0);
+        UTEST_ASSERT(aligned(v4.f3(), 32));
+        UTEST_ASSERT(v4.f3()[0] == 4.0f);
+    }
+
+    UTEST_MAIN
+    {
+        test_basic();
+        test_alignment();
+    }
+
+UTEST_END
+
+
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/spsc_ring.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <pthread.h>
+
+#define STRESS_ITEMS        1000000
+
+UTEST_BEGIN("lltl", spsc_ring)
+
+    typedef struct event_t
+    {
+        uint32_t    id;
+        uint32_t    data[3];
+    } event_t;
+
+    static void make_event(event_t *ev, uint32_t id)
+    {
+        ev->id      = id;
+        ev->data[0] = id * 3;
+        ev->data[1] = id * 5;
+        ev->data[2] = id * 7;
+    }
+
+    static bool check_event(const event_t *ev, uint32_t id)
+    {
+        return (ev->id == id) &&
+            (ev->data[0] == id * 3) &&
+            (ev->data[1] == id * 5) &&
+            (ev->data[2] == id * 7);
+    }
+
+    void test_single()
+    {
+        lltl::spsc_ring<event_t> r;
+        event_t ev;
+
+        printf("Testing single operations...\n");
+
+        // Not reserved ring
+        UTEST_ASSERT(r.capacity() == 0);
+        UTEST_ASSERT(r.is_empty());
+        make_event(&ev, 0);
+        UTEST_ASSERT(!r.push(ev));
+        UTEST_ASSERT(!r.pop(ev));
+        UTEST_ASSERT(r.front() == NULL);
+
+        // Reserve and fill
+        UTEST_ASSERT(r.reserve(40));
+        UTEST_ASSERT(r.capacity() == 64);
+        for (uint32_t i=0; i<64; ++i)
+        {
+            make_event(&ev, i);
+            UTEST_ASSERT(r.push(ev));
+        }
+        UTEST_ASSERT(r.is_full());
+        UTEST_ASSERT(!r.push(ev));
+        UTEST_ASSERT(r.size() == 64);
+
+        // Peek and pop
+        event_t *pev = r.front();
+        UTEST_ASSERT(pev != NULL);
+        UTEST_ASSERT(check_event(pev, 0));
+        UTEST_ASSERT(r.skip());
+        for (uint32_t i=1; i<32; ++i)
+        {
+            UTEST_ASSERT(r.pop(&ev));
+            UTEST_ASSERT(check_event(&ev, i));
+        }
+        UTEST_ASSERT(r.size() == 32);
+
+        // Grow with data wrapped around the end of storage
+        for (uint32_t i=64; i<80; ++i)
+        {
+            make_event(&ev, i);
+            UTEST_ASSERT(r.push(&ev));
+        }
+        UTEST_ASSERT(r.reserve(100));
+        UTEST_ASSERT(r.capacity() == 128);
+        UTEST_ASSERT(r.size() == 48);
+        for (uint32_t i=32; i<80; ++i)
+        {
+            UTEST_ASSERT(r.pop(&ev));
+            UTEST_ASSERT(check_event(&ev, i));
+        }
+        UTEST_ASSERT(r.is_empty());
+        UTEST_ASSERT(!r.skip());
+
+        r.flush();
+        UTEST_ASSERT(r.capacity() == 0);
+    }
+
+    void test_multiple()
+    {
+        lltl::spsc_ring<event_t> r;
+        event_t ev[100];
+        uint32_t wid = 0, rid = 0;
+
+        printf("Testing multiple operations...\n");
+        UTEST_ASSERT(r.reserve(64));
+
+        for (size_t k=0; k<1000; ++k)
+        {
+            // Push batch, it may be split by the end of storage
+            size_t n = (k * 17) % 50 + 1;
+            for (size_t i=0; i<n; ++i)
+                make_event(&ev[i], wid + i);
+            size_t pushed = r.push_n(ev, n);
+            UTEST_ASSERT(pushed <= n);
+            wid    += pushed;
+            UTEST_ASSERT(r.size() == wid - rid);
+
+            // Pop batch
+            n = (k * 13) % 60 + 1;
+            size_t popped = r.pop_n(ev, n);
+            UTEST_ASSERT(popped <= n);
+            for (size_t i=0; i<popped; ++i)
+                UTEST_ASSERT(check_event(&ev[i], rid + i));
+            rid    += popped;
+            UTEST_ASSERT(r.size() == wid - rid);
+        }
+
+        // Overflow and underflow
+        r.clear();
+        UTEST_ASSERT(r.push_n(ev, 100) == 64);
+        UTEST_ASSERT(r.pop_n(ev, 100) == 64);
+        UTEST_ASSERT(r.pop_n(ev, 100) == 0);
+    }
+
+    static void *producer_main(void *arg)
+    {
+        lltl::spsc_ring<event_t> *r = static_cast<lltl::spsc_ring<event_t> *>(arg);
+        event_t ev[16];
+
+        for (uint32_t id = 0; id < STRESS_ITEMS; )
+        {
+            size_t n = (id % 16) + 1;
+            if (n > STRESS_ITEMS - id)
+                n = STRESS_ITEMS - id;
+            for (size_t i=0; i<n; ++i)
+                make_event(&ev[i], id + i);
+            for (size_t off = 0; off < n; )
+                off    += r->push_n(&ev[off], n - off);
+            id     += n;
+        }
+
+        return NULL;
+    }
+
+    void test_concurrent()
+    {
+        lltl::spsc_ring<event_t> r;
+        event_t ev[32];
+        pthread_t producer;
+
+        printf("Testing concurrent producer and consumer...\n");
+        UTEST_ASSERT(r.reserve(256));
+        UTEST_ASSERT(pthread_create(&producer, NULL, producer_main, &r) == 0);
+
+        for (uint32_t id = 0; id < STRESS_ITEMS; )
+        {
+            size_t n = r.pop_n(ev, 32);
+            for (size_t i=0; i<n; ++i, ++id)
+                UTEST_ASSERT(check_event(&ev[i], id));
+        }
+
+        pthread_join(producer, NULL);
+        UTEST_ASSERT(r.is_empty());
+    }
+
+    UTEST_MAIN
+    {
+        test_single();
+        test_multiple();
+        test_concurrent();
+    }
+
+UTEST_END
+
+
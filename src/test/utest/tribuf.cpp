@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/tribuf.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <pthread.h>
+
+#define FRAMES          200000
+#define FRAME_SIZE      64
+
+UTEST_BEGIN("lltl", tribuf)
+
+    typedef struct context_t
+    {
+        lltl::tribuf<size_t>   *buf;
+        size_t                  received;
+        bool                    failed;
+        bool                    done;
+    } context_t;
+
+    static bool fill(lltl::darray<size_t> *frame, size_t id)
+    {
+        size_t *items = frame->append_n(id % FRAME_SIZE + 1);
+        if (items == NULL)
+            return false;
+        for (size_t i=0; i<=id % FRAME_SIZE; ++i)
+            items[i]    = id;
+        return true;
+    }
+
+    static bool check(lltl::darray<size_t> *frame, size_t id)
+    {
+        if (frame->size() != id % FRAME_SIZE + 1)
+            return false;
+        for (size_t i=0; i<frame->size(); ++i)
+            if (*frame->uget(i) != id)
+                return false;
+        return true;
+    }
+
+    void test_basic()
+    {
+        lltl::tribuf<size_t> tb;
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(tb.reserve(FRAME_SIZE));
+        UTEST_ASSERT(!tb.pending());
+        UTEST_ASSERT(!tb.fetch());
+        UTEST_ASSERT(tb.front()->is_empty());
+
+        // Publish one frame
+        lltl::darray<size_t> *w = tb.back();
+        UTEST_ASSERT(fill(w, 1));
+        tb.publish();
+        UTEST_ASSERT(tb.back() != w);
+        UTEST_ASSERT(tb.pending());
+
+        lltl::darray<size_t> *r = tb.read();
+        UTEST_ASSERT(r == w);
+        UTEST_ASSERT(check(r, 1));
+        UTEST_ASSERT(!tb.pending());
+        UTEST_ASSERT(!tb.fetch());
+        UTEST_ASSERT(tb.read() == r);
+
+        // Publish several frames, the consumer should get only the latest one
+        for (size_t i=2; i<10; ++i)
+        {
+            w = tb.back();
+            w->clear();
+            UTEST_ASSERT(w != r);
+            UTEST_ASSERT(fill(w, i));
+            tb.publish();
+        }
+        UTEST_ASSERT(tb.fetch());
+        r = tb.front();
+        UTEST_ASSERT(check(r, 9));
+        UTEST_ASSERT(!tb.fetch());
+
+        // All three buffers should differ
+        w = tb.back();
+        UTEST_ASSERT(w != r);
+
+        tb.clear();
+        UTEST_ASSERT(!tb.pending());
+        UTEST_ASSERT(tb.front()->is_empty());
+        tb.flush();
+    }
+
+    static void *consumer_main(void *arg)
+    {
+        context_t *ctx  = static_cast<context_t *>(arg);
+        size_t last     = 0;
+
+        while (true)
+        {
+            bool done       = __atomic_load_n(&ctx->done, __ATOMIC_ACQUIRE);
+            if (ctx->buf->fetch())
+            {
+                // Frames should be complete and should come in order
+                lltl::darray<size_t> *frame = ctx->buf->front();
+                size_t id       = *frame->uget(0);
+                if ((id <= last) || (!check(frame, id)))
+                    ctx->failed     = true;
+                last            = id;
+                ++ctx->received;
+            }
+            else if (done)
+                break;
+        }
+
+        if (last != FRAMES)
+            ctx->failed     = true;
+
+        return NULL;
+    }
+
+    void test_concurrent()
+    {
+        lltl::tribuf<size_t> tb;
+        context_t ctx;
+        pthread_t tid;
+
+        printf("Testing concurrent access...\n");
+        UTEST_ASSERT(tb.reserve(FRAME_SIZE));
+
+        ctx.buf         = &tb;
+        ctx.received    = 0;
+        ctx.failed      = false;
+        ctx.done        = false;
+        UTEST_ASSERT(pthread_create(&tid, NULL, consumer_main, &ctx) == 0);
+
+        for (size_t i=1; i<=FRAMES; ++i)
+        {
+            lltl::darray<size_t> *frame = tb.back();
+            frame->clear();
+            UTEST_ASSERT(fill(frame, i));
+            tb.publish();
+        }
+        __atomic_store_n(&ctx.done, true, __ATOMIC_RELEASE);
+
+        pthread_join(tid, NULL);
+        printf("Received %d of %d frames\n", int(ctx.received), int(FRAMES));
+        UTEST_ASSERT(!ctx.failed);
+    }
+
+    UTEST_MAIN
+    {
+        test_basic();
+        test_concurrent();
+    }
+
+UTEST_END
+
+
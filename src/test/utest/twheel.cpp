@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/twheel.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdlib.h>
+
+#define EVENTS          2000
+
+UTEST_BEGIN("lltl", twheel)
+
+    typedef struct event_t
+    {
+        uint64_t    time;
+        size_t      id;
+    } event_t;
+
+    typedef struct context_t
+    {
+        lltl::twheel<event_t>  *wheel;
+        uint64_t                last;
+        uint64_t                limit;
+        size_t                  count;
+        size_t                  period;
+        bool                   *pending;
+        bool                    failed;
+    } context_t;
+
+    static uint64_t random_delay()
+    {
+        switch (rand() % 5)
+        {
+            case 0: return rand() % 64;
+            case 1: return rand() % 4096;
+            case 2: return rand() % 1000000;
+            case 3: return uint64_t(rand() % 1000) << 20;
+            default: return uint64_t(rand() % 16) << 36;
+        }
+    }
+
+    static bool on_event(uint64_t time, event_t *ev, context_t *ctx)
+    {
+        if ((time != ev->time) || (time < ctx->last) || (time >= ctx->limit) || (!ctx->pending[ev->id]))
+            ctx->failed     = true;
+        ctx->pending[ev->id]    = false;
+        ctx->last       = time;
+        ++ctx->count;
+
+        // Reschedule periodic events
+        if ((ctx->period > 0) && (ev->id < 10))
+        {
+            event_t next;
+            next.time       = time + ctx->period;
+            next.id         = ev->id;
+            ctx->pending[ev->id]    = true;
+            if (ctx->wheel->insert(next.time, next) < 0)
+                ctx->failed     = true;
+        }
+
+        return true;
+    }
+
+    void test_basic()
+    {
+        lltl::twheel<event_t> w;
+        event_t ev;
+        uint64_t time;
+        ssize_t h[4];
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(w.is_empty());
+        UTEST_ASSERT(w.time() == 0);
+        UTEST_ASSERT(!w.pop(~uint64_t(0), &time, &ev));
+
+        w.reset(1000);
+        UTEST_ASSERT(w.time() == 1000);
+
+        // Events with the same time are fetched in order of insertion
+        for (size_t i=0; i<4; ++i)
+        {
+            ev.time     = (i < 2) ? 1010 : 1005;
+            ev.id       = i;
+            h[i]        = w.insert(ev.time, ev);
+            UTEST_ASSERT(h[i] >= 0);
+        }
+        UTEST_ASSERT(w.size() == 4);
+        UTEST_ASSERT(w.get(h[2])->id == 2);
+
+        UTEST_ASSERT(!w.pop(1005, &time, &ev));
+        UTEST_ASSERT(w.pop(1006, &time, &ev));
+        UTEST_ASSERT((time == 1005) && (ev.id == 2));
+        UTEST_ASSERT(w.time() == 1005);
+        UTEST_ASSERT(w.get(h[2]) == NULL);
+        UTEST_ASSERT(!w.cancel(h[2]));
+
+        // Cancel the event
+        UTEST_ASSERT(w.cancel(h[3], &ev) == &ev);
+        UTEST_ASSERT(ev.id == 3);
+        UTEST_ASSERT(w.size() == 2);
+
+        // Late event is fetched immediately
+        ev.time     = 10;
+        ev.id       = 4;
+        UTEST_ASSERT(w.insert(ev.time, ev) >= 0);
+        UTEST_ASSERT(w.pop(1006, &time, &ev));
+        UTEST_ASSERT((time == 10) && (ev.id == 4));
+        UTEST_ASSERT(w.time() == 1005);
+
+        UTEST_ASSERT(w.pop(2000, &time, &ev));
+        UTEST_ASSERT((time == 1010) && (ev.id == 0));
+        UTEST_ASSERT(w.pop(2000, &time, &ev));
+        UTEST_ASSERT((time == 1010) && (ev.id == 1));
+        UTEST_ASSERT(w.is_empty());
+
+        // Far events in overflow
+        ev.id       = 5;
+        UTEST_ASSERT(w.insert(uint64_t(1) << 50, ev) >= 0);
+        ev.id       = 6;
+        UTEST_ASSERT(w.insert(uint64_t(1) << 40, ev) >= 0);
+        UTEST_ASSERT(w.advance(uint64_t(1) << 39) == 0);
+        UTEST_ASSERT(w.pop(~uint64_t(0), &time, &ev));
+        UTEST_ASSERT((time == (uint64_t(1) << 40)) && (ev.id == 6));
+        UTEST_ASSERT(w.pop(~uint64_t(0), &time, &ev));
+        UTEST_ASSERT((time == (uint64_t(1) << 50)) && (ev.id == 5));
+
+        // Drop events
+        for (size_t i=0; i<10; ++i)
+            UTEST_ASSERT(w.insert(w.time() + i * 100, ev) >= 0);
+        UTEST_ASSERT(w.advance(450) == 5);
+        UTEST_ASSERT(w.size() == 5);
+        w.clear();
+        UTEST_ASSERT(w.is_empty());
+    }
+
+    void test_failed_pop()
+    {
+        lltl::twheel<event_t> w;
+        event_t ev;
+        uint64_t time;
+
+        printf("Testing failed pop...\n");
+
+        // Failed pop does not move the current time
+        ev.time     = 100;
+        ev.id       = 0;
+        UTEST_ASSERT(w.insert(ev.time, ev) >= 0);
+        UTEST_ASSERT(!w.pop(80, &time, &ev));
+        UTEST_ASSERT(w.time() == 0);
+
+        ev.time     = 50;
+        ev.id       = 1;
+        UTEST_ASSERT(w.insert(ev.time, ev) >= 0);
+        UTEST_ASSERT(w.pop(60, &time, &ev));
+        UTEST_ASSERT((time == 50) && (ev.id == 1));
+        UTEST_ASSERT(w.time() == 50);
+
+        UTEST_ASSERT(w.pop(101, &time, &ev));
+        UTEST_ASSERT((time == 100) && (ev.id == 0));
+        UTEST_ASSERT(w.time() == 100);
+
+        // Same for the overflow bucket
+        ev.time     = uint64_t(1) << 40;
+        ev.id       = 2;
+        UTEST_ASSERT(w.insert(ev.time, ev) >= 0);
+        UTEST_ASSERT(!w.pop(ev.time, &time, &ev));
+        UTEST_ASSERT(w.time() == 100);
+        UTEST_ASSERT(w.pop(~uint64_t(0), &time, &ev));
+        UTEST_ASSERT((time == (uint64_t(1) << 40)) && (ev.id == 2));
+        UTEST_ASSERT(w.is_empty());
+    }
+
+    void test_random()
+    {
+        lltl::twheel<event_t> w;
+        ssize_t handles[EVENTS];
+        bool pending[EVENTS];
+        event_t ev;
+        context_t ctx;
+
+        printf("Testing random scheduling...\n");
+
+        w.reset(12345);
+        for (size_t i=0; i<EVENTS; ++i)
+        {
+            ev.time     = w.time() + random_delay();
+            ev.id       = i;
+            handles[i]  = w.insert(ev.time, ev);
+            pending[i]  = true;
+            UTEST_ASSERT(handles[i] >= 0);
+        }
+
+        // Cancel some events
+        for (size_t i=0; i<EVENTS; i += 7)
+        {
+            UTEST_ASSERT(w.cancel(handles[i], &ev) != NULL);
+            UTEST_ASSERT(ev.id == i);
+            pending[i]  = false;
+        }
+
+        ctx.wheel       = &w;
+        ctx.last        = 0;
+        ctx.count       = 0;
+        ctx.period      = 0;
+        ctx.pending     = pending;
+        ctx.failed      = false;
+
+        // Process in blocks of different size
+        while (!w.is_empty())
+        {
+            uint64_t delta  = random_delay() + 1;
+            ctx.limit       = w.time() + delta;
+            w.advance(delta, on_event, &ctx);
+            UTEST_ASSERT(!ctx.failed);
+            UTEST_ASSERT(w.time() == ctx.limit);
+
+            // Nothing earlier than the limit should remain
+            for (size_t i=0; i<EVENTS; ++i)
+            {
+                if (pending[i])
+                    UTEST_ASSERT(w.get(handles[i])->time >= ctx.limit);
+            }
+        }
+        for (size_t i=0; i<EVENTS; ++i)
+            UTEST_ASSERT(!pending[i]);
+        UTEST_ASSERT(ctx.count == EVENTS - (EVENTS + 6) / 7);
+    }
+
+    void test_periodic()
+    {
+        lltl::twheel<event_t> w;
+        bool pending[10];
+        event_t ev;
+        context_t ctx;
+
+        printf("Testing periodic events...\n");
+
+        UTEST_ASSERT(w.reserve(64));
+        for (size_t i=0; i<10; ++i)
+        {
+            ev.time     = i;
+            ev.id       = i;
+            pending[i]  = true;
+            UTEST_ASSERT(w.insert(ev.time, ev) >= 0);
+        }
+
+        ctx.wheel       = &w;
+        ctx.last        = 0;
+        ctx.count       = 0;
+        ctx.period      = 100;
+        ctx.pending     = pending;
+        ctx.failed      = false;
+
+        // Each event is fired 100 times for 10000 samples
+        for (size_t i=0; i<10000; i += 64)
+        {
+            ctx.limit       = w.time() + 64;
+            w.advance(64, on_event, &ctx);
+            UTEST_ASSERT(!ctx.failed);
+        }
+        UTEST_ASSERT(w.size() == 10);
+        UTEST_ASSERT(ctx.count == 1010);
+    }
+
+    UTEST_MAIN
+    {
+        srand(0);
+        test_basic();
+        test_failed_pop();
+        test_random();
+        test_periodic();
+    }
+
+UTEST_END
+
+
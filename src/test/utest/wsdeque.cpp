@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-lltl-lib
+ * Created on: 19 окт. 2026 г.
+ *
+ * lsp-lltl-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-lltl-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-lltl-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/wsdeque.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <pthread.h>
+
+#define THIEVES         3
+#define TASKS           200000
+
+UTEST_BEGIN("lltl", wsdeque)
+
+    typedef struct context_t
+    {
+        lltl::wsdeque<size_t>  *deque;
+        size_t                 *counters;
+        size_t                  stolen;
+        bool                   *done;
+    } context_t;
+
+    void test_basic()
+    {
+        lltl::wsdeque<size_t> dq;
+        size_t v[1000];
+
+        printf("Testing basic functions...\n");
+
+        UTEST_ASSERT(dq.capacity() == 0);
+        UTEST_ASSERT(dq.is_empty());
+        UTEST_ASSERT(dq.pop() == NULL);
+        UTEST_ASSERT(dq.steal() == NULL);
+        UTEST_ASSERT(!dq.push(NULL));
+
+        // The owner works in LIFO order, thieves in FIFO order
+        for (size_t i=0; i<10; ++i)
+        {
+            v[i] = i;
+            UTEST_ASSERT(dq.push(&v[i]));
+        }
+        UTEST_ASSERT(dq.size() == 10);
+        UTEST_ASSERT(dq.capacity() == 32);
+        UTEST_ASSERT(dq.pop() == &v[9]);
+        UTEST_ASSERT(dq.steal() == &v[0]);
+        UTEST_ASSERT(dq.pop() == &v[8]);
+        UTEST_ASSERT(dq.steal() == &v[1]);
+        UTEST_ASSERT(dq.size() == 6);
+
+        for (size_t i=2; i<8; ++i)
+            UTEST_ASSERT(dq.steal() == &v[i]);
+        UTEST_ASSERT(dq.pop() == NULL);
+        UTEST_ASSERT(dq.steal() == NULL);
+        UTEST_ASSERT(dq.is_empty());
+
+        // Grow the array with wrapped positions
+        for (size_t i=0; i<20; ++i)
+        {
+            UTEST_ASSERT(dq.push(&v[i]));
+            UTEST_ASSERT(dq.steal() == &v[i]);
+        }
+        for (size_t i=0; i<1000; ++i)
+        {
+            v[i] = i;
+            UTEST_ASSERT(dq.push(&v[i]));
+        }
+        UTEST_ASSERT(dq.size() == 1000);
+        UTEST_ASSERT(dq.capacity() == 1024);
+        for (size_t i=0; i<500; ++i)
+            UTEST_ASSERT(dq.steal() == &v[i]);
+        for (size_t i=999; i>=500; --i)
+            UTEST_ASSERT(dq.pop() == &v[i]);
+        UTEST_ASSERT(dq.is_empty());
+
+        // Reserve
+        UTEST_ASSERT(dq.reserve(3000));
+        UTEST_ASSERT(dq.capacity() == 4096);
+
+        dq.flush();
+        UTEST_ASSERT(dq.capacity() == 0);
+    }
+
+    static void *thief_main(void *arg)
+    {
+        context_t *ctx  = static_cast<context_t *>(arg);
+
+        while (true)
+        {
+            bool done       = __atomic_load_n(ctx->done, __ATOMIC_ACQUIRE);
+            size_t *task    = ctx->deque->steal();
+            if (task != NULL)
+            {
+                __atomic_fetch_add(&ctx->counters[*task], 1, __ATOMIC_RELAXED);
+                ++ctx->stolen;
+            }
+            else if (done)
+                break;
+        }
+
+        return NULL;
+    }
+
+    void test_concurrent()
+    {
+        lltl::wsdeque<size_t> dq;
+        context_t ctx[THIEVES];
+        pthread_t tid[THIEVES];
+        size_t *tasks       = new size_t[TASKS];
+        size_t *counters    = new size_t[TASKS];
+        bool done           = false;
+        size_t popped       = 0;
+
+        printf("Testing concurrent access...\n");
+
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            tasks[i]        = i;
+            counters[i]     = 0;
+        }
+
+        for (size_t i=0; i<THIEVES; ++i)
+        {
+            ctx[i].deque    = &dq;
+            ctx[i].counters = counters;
+            ctx[i].stolen   = 0;
+            ctx[i].done     = &done;
+            UTEST_ASSERT(pthread_create(&tid[i], NULL, thief_main, &ctx[i]) == 0);
+        }
+
+        // Push tasks and execute some of them by the owner
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            UTEST_ASSERT(dq.push(&tasks[i]));
+            if ((i % 3) == 0)
+            {
+                size_t *task    = dq.pop();
+                if (task != NULL)
+                {
+                    __atomic_fetch_add(&counters[*task], 1, __ATOMIC_RELAXED);
+                    ++popped;
+                }
+            }
+        }
+
+        // Execute the rest of tasks
+        for (size_t *task; (task = dq.pop()) != NULL; ++popped)
+            __atomic_fetch_add(&counters[*task], 1, __ATOMIC_RELAXED);
+
+        __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+        size_t stolen   = 0;
+        for (size_t i=0; i<THIEVES; ++i)
+        {
+            pthread_join(tid[i], NULL);
+            stolen         += ctx[i].stolen;
+        }
+
+        // Each task should be executed exactly once
+        printf("Popped %d tasks, stolen %d tasks\n", int(popped), int(stolen));
+        UTEST_ASSERT(popped + stolen == TASKS);
+        for (size_t i=0; i<TASKS; ++i)
+            UTEST_ASSERT(counters[i] == 1);
+
+        delete [] tasks;
+        delete [] counters;
+    }
+
+    UTEST_MAIN
+    {
+        test_basic();
+        test_concurrent();
+    }
+
+UTEST_END
+
+